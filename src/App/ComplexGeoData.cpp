@@ -646,7 +646,7 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     restoreStream(reader, count);
 }
 
-unsigned int ComplexGeoData::getMemSize() const
+std::size_t ComplexGeoData::getMemSize() const
 {
     flushElementMap();
     if (_elementMap) {
@@ -379,7 +379,7 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void setPersistenceFileName(const char* name) const;
     virtual void beforeSave() const;
     bool isRestoreFailed() const
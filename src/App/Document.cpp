@@ -79,8 +79,14 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include <unordered_map>
 #include <unordered_set>
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <QCryptographicHash>
 #include <QCoreApplication>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
 
 #include <App/DocumentPy.h>
 #include <Base/Interpreter.h>
@@ -139,6 +145,15 @@ namespace App
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
 
+// Property change notifications of an object executed on a worker thread by
+// Document::_recomputeParallel(). They are handed over to the main thread,
+// which emits the signals of the document and of the object while the worker
+// waits. This way observers (e.g. the GUI or links) see them in their original
+// order and never from a foreign thread.
+using ChangeNotifier =
+    std::function<void(const DocumentObject*, const Property*, Document::ChangeSignal)>;
+static thread_local const ChangeNotifier* globalChangeNotifier;
+
 DocumentP::DocumentP()
 {
     Hasher = new StringHasher;
@@ -533,6 +548,16 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // drop the oldest steps until the stack fits into the memory limit
+        if (d->UndoMemSize > 0) {
+            std::size_t size = getUndoMemSize();
+            while (mUndoTransactions.size() > 1 && size > d->UndoMemSize) {
+                size -= mUndoTransactions.front()->getMemSize();
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -743,16 +768,28 @@ int Document::getUndoMode() const
     return d->iUndoMode;
 }
 
-unsigned int Document::getUndoMemSize() const
+std::size_t Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = 0;
+    for (auto transaction : mUndoTransactions) {
+        size += transaction->getMemSize();
+    }
+    for (auto transaction : mRedoTransactions) {
+        size += transaction->getMemSize();
+    }
+    return size;
 }
 
-void Document::setUndoLimit(unsigned int UndoMemSize)
+void Document::setUndoLimit(std::size_t UndoMemSize)
 {
     d->UndoMemSize = UndoMemSize;
 }
 
+std::size_t Document::getUndoLimit() const
+{
+    return d->UndoMemSize;
+}
+
 void Document::setMaxUndoStackSize(unsigned int UndoMaxStackSize)
 {
     d->UndoMaxStackSize = UndoMaxStackSize;
@@ -836,9 +873,13 @@ void Document::onChanged(const Property* prop)
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
     if (Who->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
-        signalBeforeChangeObject(*static_cast<const App::DocumentObject*>(Who), *What);
+        auto obj = static_cast<const App::DocumentObject*>(Who);
+        if (!_forwardChange(obj, What, BeforeChangeSignal)) {
+            signalBeforeChangeObject(*obj, *What);
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
+        std::lock_guard<std::recursive_mutex> lock(d->recomputeMutex);
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
@@ -848,7 +889,23 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
-    signalChangedObject(*Who, *What);
+    if (!_forwardChange(Who, What, ChangedSignal)) {
+        signalChangedObject(*Who, *What);
+    }
+}
+
+bool Document::_forwardChange(const DocumentObject* Who, const Property* What, ChangeSignal signal)
+{
+    if (!globalChangeNotifier) {
+        return false;
+    }
+    (*globalChangeNotifier)(Who, What, signal);
+    return true;
+}
+
+bool Document::_isForwardingChanges()
+{
+    return globalChangeNotifier != nullptr;
 }
 
 void Document::setTransactionMode(int iMode)
@@ -1694,9 +1751,9 @@ std::vector<App::DocumentObject*> Document::importObjects(Base::XMLReader& reade
     return objs;
 }
 
-unsigned int Document::getMemSize() const
+std::size_t Document::getMemSize() const
 {
-    unsigned int size = 0;
+    std::size_t size = 0;
 
     // size of the DocObjects in the document
     std::vector<DocumentObject*>::const_iterator it;
@@ -2186,11 +2243,20 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        if (hGrp->GetBool("ParallelCompression", false)) {
+            int threads = hGrp->GetInt("CompressionThreads", 0);
+            writer.setThreadCount(threads > 0 ? threads : QThread::idealThreadCount());
+        }
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        // Files with identical content are stored once. Older versions only restore the
+        // first object that refers to such a file, files of a single object stay compatible.
+        if (hGrp->GetBool("DeduplicateFiles", false)) {
+            writer.setMode("DeduplicateFiles");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2307,6 +2373,13 @@ void Document::restore(const char* filename,
         throw Base::FileException("Error reading compression file", filename);
     }
 
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    if (hGrp->GetBool("ParallelCompression", false)) {
+        int threads = hGrp->GetInt("CompressionThreads", 0);
+        reader.setThreadCount(threads > 0 ? threads : QThread::idealThreadCount());
+    }
+
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
 
@@ -3149,6 +3222,7 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     ParameterGrp::handle hGrp =
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
 
     std::set<App::DocumentObject*> filter;
     size_t idx = 0;
@@ -3164,6 +3238,15 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            if (passes == 0 && parallel) {
+                idx = topoSortedObjects.size();
+                // on abort the remaining passes are skipped like in the serial loop, but the
+                // still touched objects are checked below
+                if (_recomputeParallel(topoSortedObjects, filter, objectCount, hasError, seq.get())
+                    < 0) {
+                    passes = 2;
+                }
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -3515,6 +3598,305 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     return 0;
 }
 
+namespace
+{
+class RecomputeTask: public QRunnable
+{
+public:
+    explicit RecomputeTask(std::function<void()> func)
+        : func(std::move(func))
+    {}
+
+    void run() override
+    {
+        func();
+    }
+
+private:
+    std::function<void()> func;
+};
+}  // namespace
+
+int Document::_recomputeParallel(const std::vector<DocumentObject*>& topoSortedObjects,
+                                 std::set<DocumentObject*>& filter,
+                                 int& objectCount,
+                                 bool* hasError,
+                                 Base::SequencerLauncher* seq)
+{
+    // Count for each object the number of its dependencies that are part of
+    // this recompute and not finished yet. An object is ready once the count
+    // drops to zero.
+    std::unordered_map<DocumentObject*, std::size_t> pending;
+    std::unordered_map<DocumentObject*, std::vector<DocumentObject*>> dependents;
+    pending.reserve(topoSortedObjects.size());
+    for (auto obj : topoSortedObjects) {
+        pending[obj] = 0;
+    }
+    for (auto obj : topoSortedObjects) {
+        auto outList = obj->getOutList();
+        std::sort(outList.begin(), outList.end());
+        outList.erase(std::unique(outList.begin(), outList.end()), outList.end());
+        for (auto dep : outList) {
+            if (dep != obj && pending.count(dep)) {
+                ++pending[obj];
+                dependents[dep].push_back(obj);
+            }
+        }
+    }
+
+    std::deque<DocumentObject*> ready;
+    for (auto obj : topoSortedObjects) {
+        if (pending[obj] == 0) {
+            ready.push_back(obj);
+        }
+    }
+
+    struct Result
+    {
+        DocumentObject* obj;
+        int res;
+    };
+    struct Change
+    {
+        const DocumentObject* obj;
+        const Property* prop;
+        ChangeSignal signal;
+        bool done;
+    };
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::condition_variable changeDone;
+    std::vector<Result> results;
+    std::vector<Change*> changes;
+    std::size_t running = 0;
+    std::size_t finished = 0;
+    bool aborted = false;
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    QThreadPool pool;
+    int threads = hGrp->GetInt("RecomputeThreads", 0);
+    pool.setMaxThreadCount(threads > 0 ? threads : QThread::idealThreadCount());
+
+    // Lets the dependents of obj be scheduled
+    auto release = [&](DocumentObject* obj) {
+        ++finished;
+        for (auto dep : dependents[obj]) {
+            if (--pending[dep] == 0) {
+                ready.push_back(dep);
+            }
+        }
+    };
+
+    // Same bookkeeping as the serial loop in recompute(), always done on the
+    // main thread.
+    auto finish = [&](DocumentObject* obj, bool doRecompute, int res, bool next) {
+        release(obj);
+        if (res) {
+            if (hasError) {
+                *hasError = true;
+            }
+            if (res < 0) {
+                aborted = true;
+                return;
+            }
+            obj->getInListEx(filter, true);
+            filter.insert(obj);
+            return;
+        }
+        if (obj->isTouched() || doRecompute) {
+            signalRecomputedObject(*obj);
+            obj->purgeTouched();
+            for (auto inObjIt : obj->getInList()) {
+                inObjIt->enforceRecompute();
+            }
+        }
+        if (seq && next) {
+            seq->next(true);
+        }
+    };
+
+    // Called on the worker threads, blocks until the main thread has emitted the signal
+    ChangeNotifier notifier = [&](const DocumentObject* obj,
+                                  const Property* prop,
+                                  ChangeSignal signal) {
+        Change change {obj, prop, signal, false};
+        std::unique_lock<std::mutex> lock(mutex);
+        changes.push_back(&change);
+        cond.notify_one();
+        changeDone.wait(lock, [&] {
+            return change.done;
+        });
+    };
+
+    auto emitChanges = [&](const std::vector<Change*>& pendingChanges) {
+        for (auto change : pendingChanges) {
+            try {
+                const DocumentObject& obj = *change->obj;
+                const Property& prop = *change->prop;
+                switch (change->signal) {
+                    case BeforeChangeSignal:
+                        signalBeforeChangeObject(obj, prop);
+                        obj.signalBeforeChange(obj, prop);
+                        break;
+                    case EarlyChangeSignal:
+                        obj.signalEarlyChanged(obj, prop);
+                        break;
+                    case ChangedSignal:
+                        signalChangedObject(obj, prop);
+                        obj.signalChanged(obj, prop);
+                        break;
+                }
+            }
+            catch (...) {
+                // the worker must not be left waiting
+                FC_ERR("Exception in change notification of " << change->obj->getFullName());
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto change : pendingChanges) {
+            change->done = true;
+        }
+        changeDone.notify_all();
+    };
+
+    auto processResults = [&](bool wait, bool next) {
+        std::vector<Result> done;
+        std::vector<Change*> pendingChanges;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (wait) {
+                cond.wait(lock, [&] {
+                    return !results.empty() || !changes.empty();
+                });
+            }
+            done.swap(results);
+            pendingChanges.swap(changes);
+            running -= done.size();
+        }
+        if (!pendingChanges.empty()) {
+            emitChanges(pendingChanges);
+        }
+        for (auto& result : done) {
+            finish(result.obj, true, result.res, next);
+        }
+    };
+
+    auto waitForRunning = [&](bool next) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (running == 0 && results.empty()) {
+                    break;
+                }
+            }
+            processResults(true, next);
+        }
+    };
+
+    std::deque<DocumentObject*> serial;
+    try {
+        while (!aborted) {
+            processResults(false, true);
+
+            while (!ready.empty() && !aborted) {
+                auto obj = ready.front();
+                ready.pop_front();
+                if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
+                    // like the serial loop, leave them untouched
+                    release(obj);
+                    continue;
+                }
+                if (!obj->mustRecompute()) {
+                    finish(obj, false, 0, true);
+                    continue;
+                }
+                if (!obj->isExecuteThreadSafe() || obj->ExpressionEngine.numExpressions() > 0
+                    || pool.maxThreadCount() < 2) {
+                    serial.push_back(obj);
+                    continue;
+                }
+                ++objectCount;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++running;
+                }
+                pool.start(new RecomputeTask([this, obj, &mutex, &cond, &results, &notifier]() {
+                    globalChangeNotifier = &notifier;
+                    int res = 1;
+                    try {
+                        res = _recomputeFeature(obj);
+                    }
+                    catch (...) {
+                        // _recomputeFeature() doesn't catch everything in debug builds, but an
+                        // exception must never escape a worker thread
+                        FC_ERR("Unknown exception in " << obj->getFullName() << " thrown");
+                        d->addRecomputeLog("Unknown exception!", obj);
+                    }
+                    globalChangeNotifier = nullptr;
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results.push_back({obj, res});
+                    cond.notify_one();
+                }));
+            }
+            if (aborted) {
+                break;
+            }
+
+            bool idle = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                idle = running == 0 && results.empty();
+            }
+            if (!idle) {
+                processResults(true, true);
+                continue;
+            }
+            if (serial.empty()) {
+                break;
+            }
+            // objects that are not thread safe run exclusively on the main thread
+            auto obj = serial.front();
+            serial.pop_front();
+            ++objectCount;
+            finish(obj, true, _recomputeFeature(obj), true);
+        }
+        waitForRunning(false);
+    }
+    catch (...) {
+        waitForRunning(false);
+        throw;
+    }
+
+    if (aborted) {
+        return -1;
+    }
+
+    // Objects caught in a dependency cycle never become ready, leave them to
+    // the serial loop in their sorted order.
+    if (finished < topoSortedObjects.size()) {
+        FC_WARN("Parallel recompute could not schedule "
+                << topoSortedObjects.size() - finished << " objects of " << getName());
+        std::vector<DocumentObject*> unscheduled;
+        for (auto obj : topoSortedObjects) {
+            if (pending[obj] != 0) {
+                unscheduled.push_back(obj);
+            }
+        }
+        for (auto obj : unscheduled) {
+            if (obj->isAttachedToDocument() && filter.find(obj) == filter.end()
+                && obj->mustRecompute()) {
+                ++objectCount;
+                finish(obj, true, _recomputeFeature(obj), true);
+                if (aborted) {
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
 bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
 {
     // delete recompute log
@@ -4045,7 +4427,7 @@ Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, b
     // if not copying recursively then suppress possible warnings
     md.setVerbose(recursive);
 
-    unsigned int memsize = 1000;  // ~ for the meta-information
+    std::size_t memsize = 1000;  // ~ for the meta-information
     for (auto it : deps) {
         memsize += it->getMemSize();
     }
@@ -4053,11 +4435,13 @@ Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, b
     // if less than ~10 MB
     bool use_buffer = (memsize < 0xA00000);
     QByteArray res;
-    try {
-        res.reserve(memsize);
-    }
-    catch (const Base::MemoryException&) {
-        use_buffer = false;
+    if (use_buffer) {
+        try {
+            res.reserve(static_cast<int>(memsize));
+        }
+        catch (const Base::MemoryException&) {
+            use_buffer = false;
+        }
     }
 
     std::vector<App::DocumentObject*> imported;
@@ -34,11 +34,13 @@
 #include "PropertyStandard.h"
 
 #include <map>
+#include <set>
 #include <vector>
 #include <QString>
 
 namespace Base
 {
+class SequencerLauncher;
 class Writer;
 }
 
@@ -248,7 +250,7 @@ public:
 
     /// returns the complete document memory consumption, including all managed DocObjects and Undo
     /// Redo.
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Object handling  */
     //@{
@@ -422,10 +424,12 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
-    void setUndoLimit(unsigned int UndoMemSize = 0);
+    /// Set the Undo limit in Byte! The oldest steps are dropped on commit, 0 means no limit.
+    void setUndoLimit(std::size_t UndoMemSize = 0);
+    /// Returns the Undo limit in Byte
+    std::size_t getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
-    unsigned int getUndoMemSize() const;
+    std::size_t getUndoMemSize() const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize = 20);  // NOLINT
     /// Set the Undo limit as stack size
@@ -567,6 +571,14 @@ public:
     /// Indicate if there is any document restoring/importing
     static bool isAnyRestoring();
 
+    /// property change signals of an object that a parallel recompute emits on the main thread
+    enum ChangeSignal
+    {
+        BeforeChangeSignal,
+        EarlyChangeSignal,
+        ChangedSignal
+    };
+
     friend class Application;
     /// because of transaction handling
     friend class TransactionalObject;
@@ -596,9 +608,25 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject* Who, const Property* What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject* Who, const Property* What);
+    /** Hand a change signal over to the main thread if called on a recompute worker
+     * The main thread emits the signal of the document, if any, and then the one of
+     * the object \a Who.
+     * @return true if the signal was handed over, false if the caller must emit it.
+     */
+    static bool _forwardChange(const DocumentObject* Who, const Property* What, ChangeSignal);
+    /// true if called on a recompute worker, see _forwardChange()
+    static bool _isForwardingChanges();
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /// helper which recomputes the topologically sorted objects, running
+    /// independent thread safe objects concurrently on a thread pool.
+    /// @return -1 if aborted by user, 0 otherwise.
+    int _recomputeParallel(const std::vector<DocumentObject*>& topoSortedObjects,
+                           std::set<DocumentObject*>& filter,
+                           int& objectCount,
+                           bool* hasError,
+                           Base::SequencerLauncher* seq);
     void _clearRedos();
 
     /// refresh the internal dependency graph
@@ -811,7 +811,10 @@ void DocumentObject::onBeforeChange(const Property* prop)
         onBeforeChangeProperty(_pDoc, prop);
     }
 
-    signalBeforeChange(*this, *prop);
+    // on a recompute worker the document emits the signal on the main thread
+    if (!_pDoc || !Document::_isForwardingChanges()) {
+        signalBeforeChange(*this, *prop);
+    }
 }
 
 void DocumentObject::onEarlyChange(const Property* prop)
@@ -830,7 +833,9 @@ void DocumentObject::onEarlyChange(const Property* prop)
         }
     }
 
-    signalEarlyChanged(*this, *prop);
+    if (!_pDoc || !Document::_forwardChange(this, prop, Document::EarlyChangeSignal)) {
+        signalEarlyChanged(*this, *prop);
+    }
 }
 
 /// get called by the container when a Property was changed
@@ -884,7 +889,10 @@ void DocumentObject::onChanged(const Property* prop)
         _pDoc->onChangedProperty(this, prop);
     }
 
-    signalChanged(*this, *prop);
+    // on a recompute worker the document emits the signal on the main thread
+    if (!_pDoc || !Document::_isForwardingChanges()) {
+        signalChanged(*this, *prop);
+    }
 }
 
 void DocumentObject::clearOutListCache() const
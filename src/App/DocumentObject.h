@@ -514,6 +514,20 @@ public:
         return false;
     }
 
+    /** Return true if execute() may run on a worker thread
+     *
+     * This is only consulted when parallel recompute is enabled in the
+     * preferences. An object returning true promises that its execute() only
+     * reads from its (already recomputed) dependencies, does not touch the GUI
+     * and does not need the Python interpreter. Property change signals
+     * emitted while executing on a worker thread are delivered on the main
+     * thread while the worker waits.
+     */
+    virtual bool isExecuteThreadSafe() const
+    {
+        return false;
+    }
+
     /*** Called to let object itself control relabeling
      *
      * @param newLabel: input as the new label, which can be modified by object itself
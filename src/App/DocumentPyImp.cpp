@@ -903,7 +903,21 @@ void DocumentPy::setUndoMode(Py::Int arg)
 
 Py::Int DocumentPy::getUndoRedoMemSize() const
 {
-    return Py::Int((long)getDocumentPtr()->getUndoMemSize());
+    return Py::Long(static_cast<unsigned PY_LONG_LONG>(getDocumentPtr()->getUndoMemSize()));
+}
+
+Py::Int DocumentPy::getUndoLimit() const
+{
+    return Py::Long(static_cast<unsigned PY_LONG_LONG>(getDocumentPtr()->getUndoLimit()));
+}
+
+void DocumentPy::setUndoLimit(Py::Int arg)
+{
+    PY_LONG_LONG limit = arg.as_long_long();
+    if (limit < 0) {
+        throw Py::ValueError("Undo limit must not be negative");
+    }
+    getDocumentPtr()->setUndoLimit(static_cast<std::size_t>(limit));
 }
 
 Py::Int DocumentPy::getUndoCount() const
@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <array>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -585,7 +586,6 @@ MappedName ElementMap::setElementName(const IndexedName& element,
         sid = &_sid;
     }
 
-    std::ostringstream ss;
     Data::MappedName mappedName(name);
     for (int i = 0;;) {
         IndexedName existing;
@@ -610,6 +610,31 @@ MappedName ElementMap::setElementName(const IndexedName& element,
     }
 }
 
+namespace
+{
+/// Write \a value as lower case hex digits to \a cursor and return the end of the digits
+char* appendHex(char* cursor, unsigned long value)
+{
+    char digits[sizeof(value) * 2];
+    int count = 0;
+    do {
+        digits[count++] = "0123456789abcdef"[value & 0xfUL];
+        value >>= 4;
+    } while (value != 0);
+    while (count > 0) {
+        *cursor++ = digits[--count];
+    }
+    return cursor;
+}
+
+/// Append \a value as lower case hex digits to \a str
+void appendHex(std::string& str, unsigned long value)
+{
+    std::array<char, sizeof(value) * 2> digits {};
+    str.append(digits.data(), appendHex(digits.data(), value));
+}
+}  // namespace
+
 // try to hash element name while preserving the source tag
 void ElementMap::encodeElementName(char element_type,
                                    MappedName& name,
@@ -619,15 +644,30 @@ void ElementMap::encodeElementName(char element_type,
                                    const char* postfix,
                                    long tag,
                                    bool forceTag) const
+{
+    std::string buffer = ss.str();
+    std::size_t size = buffer.size();
+    encodeElementName(element_type, name, buffer, sids, masterTag, postfix, tag, forceTag);
+    ss.write(buffer.data() + size, static_cast<std::streamsize>(buffer.size() - size));
+}
+
+void ElementMap::encodeElementName(char element_type,
+                                   MappedName& name,
+                                   std::string& buffer,
+                                   ElementIDRefs* sids,
+                                   long masterTag,
+                                   const char* postfix,
+                                   long tag,
+                                   bool forceTag) const
 {
     if (postfix && (postfix[0] != 0)) {
         if (!boost::starts_with(postfix, ELEMENT_MAP_PREFIX)) {
-            ss << ELEMENT_MAP_PREFIX;
+            buffer += ELEMENT_MAP_PREFIX;
         }
-        ss << postfix;
+        buffer += postfix;
     }
     long inputTag = 0;
-    if (!forceTag && (ss.tellp() == 0)) {
+    if (!forceTag && buffer.empty()) {
         if ((tag == 0) || tag == masterTag) {
             return;
         }
@@ -663,28 +703,31 @@ void ElementMap::encodeElementName(char element_type,
 
     if (sids && this->hasher) {
         name = hashElementName(name, *sids);
-        if (!forceTag && (tag == 0) && (ss.tellp() != 0)) {
+        if (!forceTag && (tag == 0) && !buffer.empty()) {
             forceTag = true;
         }
     }
     if (forceTag || (tag != 0)) {
         assert(element_type);
-        auto pos = ss.tellp();
-        boost::io::ios_flags_saver ifs(ss);
-        ss << POSTFIX_TAG << std::hex;
+        // Format the tag directly, the stream's hex formatting is comparatively expensive
+        // and this runs for every element of a shape.
+        std::size_t pos = buffer.size();
+        buffer += POSTFIX_TAG;
         if (tag < 0) {
-            ss << '-' << -tag;
+            buffer += '-';
+            appendHex(buffer, static_cast<unsigned long>(-tag));
         }
         else if (tag != 0) {
-            ss << tag;
+            appendHex(buffer, static_cast<unsigned long>(tag));
         }
-        assert(pos >= 0);
         if (pos != 0) {
-            ss << ':' << pos;
+            buffer += ':';
+            appendHex(buffer, static_cast<unsigned long>(pos));
         }
-        ss << ',' << element_type;
+        buffer += ',';
+        buffer += element_type;
     }
-    name += ss.str();
+    name += buffer;
 }
 
 MappedName ElementMap::hashElementName(const MappedName& name, ElementIDRefs& sids) const
@@ -764,10 +807,11 @@ MappedName ElementMap::renameDuplicateElement(int index,
     (void)index;
     idx = _RDIST(_RGEN);
 #endif
-    std::ostringstream ss;
-    ss << ELEMENT_MAP_PREFIX << 'D' << std::hex << idx;
+    std::string postfix(ELEMENT_MAP_PREFIX);
+    postfix += 'D';
+    appendHex(postfix, static_cast<unsigned int>(idx));
     MappedName renamed(name);
-    encodeElementName(element.getType()[0], renamed, ss, &sids, masterTag);
+    encodeElementName(element.getType()[0], renamed, postfix, &sids, masterTag);
     if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
         FC_WARN("duplicate element mapping '"  // NOLINT
                 << name << " -> " << renamed << ' ' << element << '/' << element2);
@@ -1016,7 +1060,7 @@ void ElementMap::hashChildMaps(long masterTag)
     if (childElements.empty() || !this->hasher) {
         return;
     }
-    std::ostringstream ss;
+    std::string buffer;
     for (auto& indexedNameIndexedElements : this->indexedNames) {
         for (auto& indexedChild : indexedNameIndexedElements.second.children) {
             auto& child = indexedChild.second;
@@ -1029,12 +1073,12 @@ void ElementMap::hashChildMaps(long masterTag)
                 MappedName postfix =
                     hashElementName(MappedName::fromRawData(child.postfix.constData(), pos),
                                     child.sids);
-                ss.str("");
-                ss << MAPPED_CHILD_ELEMENTS_PREFIX << postfix;
+                buffer = MAPPED_CHILD_ELEMENTS_PREFIX;
+                postfix.appendToBuffer(buffer);
                 MappedName tmp;
                 encodeElementName(child.indexedName[0],
                                   tmp,
-                                  ss,
+                                  buffer,
                                   nullptr,
                                   masterTag,
                                   nullptr,
@@ -1082,8 +1126,7 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
 
 void ElementMap::addChildElements(long masterTag, const std::vector<MappedChildElements>& children)
 {
-    std::ostringstream ss;
-    ss << std::hex;
+    std::string buffer;
 
     // To avoid possibly very long recursive child map lookup, resulting very
     // long mapped names, we try to resolve the grand child map now.
@@ -1182,7 +1225,7 @@ void ElementMap::addChildElements(long masterTag, const std::vector<MappedChildE
             continue;
         }
 
-        ss.str("");
+        buffer.clear();
         MappedName tmp;
 
         ChildMapInfo* entry = nullptr;
@@ -1192,7 +1235,7 @@ void ElementMap::addChildElements(long masterTag, const std::vector<MappedChildE
         if (child.count >= threshold || !child.elementMap) {
             encodeElementName(child.indexedName[0],
                               tmp,
-                              ss,
+                              buffer,
                               nullptr,
                               masterTag,
                               child.postfix.constData(),
@@ -1226,10 +1269,10 @@ void ElementMap::addChildElements(long masterTag, const std::vector<MappedChildE
                     }
                     name = MappedName(childIdx);
                 }
-                ss.str("");
+                buffer.clear();
                 encodeElementName(idx[0],
                                   name,
-                                  ss,
+                                  buffer,
                                   &sids,
                                   masterTag,
                                   child.postfix.constData(),
@@ -1246,13 +1289,14 @@ void ElementMap::addChildElements(long masterTag, const std::vector<MappedChildE
             // other code that actually uses this postfix for indexing
             // purposes. Here, we just need some postfix for
             // disambiguation. We don't need to extract the index.
-            ss.str("");
-            ss << ELEMENT_MAP_PREFIX << ":C" << entry->index - 1;
+            buffer = ELEMENT_MAP_PREFIX;
+            buffer += ":C";
+            appendHex(buffer, static_cast<unsigned int>(entry->index - 1));
 
             tmp.clear();
             encodeElementName(child.indexedName[0],
                               tmp,
-                              ss,
+                              buffer,
                               nullptr,
                               masterTag,
                               child.postfix.constData(),
@@ -142,6 +142,18 @@ public:
                            long tag = 0,
                            bool forceTag = false) const;
 
+    /* Same as above, but the postfix is appended to `buffer`, which callers can reuse
+     * for several elements instead of allocating a stream for each.
+     */
+    void encodeElementName(char element_type,
+                           MappedName& name,
+                           std::string& buffer,
+                           ElementIDRefs* sids,
+                           long masterTag,
+                           const char* postfix = nullptr,
+                           long tag = 0,
+                           bool forceTag = false) const;
+
     /// Remove \c name from the map
     void erase(const MappedName& name);
 
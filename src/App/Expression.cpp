@@ -850,6 +850,712 @@ void Expression::Component::toString(std::ostream &ss, bool persistent) const {
 }
 
 
+//
+// Native numeric evaluation
+//
+
+namespace App {
+
+/* A numeric expression tree flattened into a small stack program.
+ *
+ * Arithmetic on numbers and quantities, scalar functions, conditionals and
+ * references to plain numeric properties are evaluated on Base::Quantity
+ * values without touching Python. Any other node is kept as a PushPython
+ * instruction and evaluated through getPyValue(). The program mirrors the
+ * Python number protocol used by the interpreted path, including the result
+ * type (bool, int, float or Quantity). Whenever the result could differ
+ * (integer overflow, division by zero, unit mismatch, ...) it gives up and the
+ * caller evaluates the expression through Python, so that both results and
+ * error messages stay the same.
+ */
+class ExpressionProgram
+{
+public:
+    struct Value
+    {
+        enum Type { Bool, Int, Float, Quant };
+
+        Type type = Int;
+        long ival = 0;
+        double dval = 0.0;
+        Unit unit;
+
+        bool isIntegral() const {
+            return type == Bool || type == Int;
+        }
+        double toDouble() const {
+            return isIntegral() ? static_cast<double>(ival) : dval;
+        }
+        Quantity toQuantity() const {
+            return type == Quant ? Quantity(dval, unit) : Quantity(toDouble());
+        }
+        bool isTrue() const {
+            return isIntegral() ? ival != 0 : dval != 0.0;
+        }
+        void setBool(bool v) {
+            type = Bool;
+            ival = v ? 1 : 0;
+        }
+        void setInt(long v) {
+            type = Int;
+            ival = v;
+        }
+        void setFloat(double v) {
+            type = Float;
+            dval = v;
+        }
+        void setQuantity(const Quantity &q) {
+            type = Quant;
+            dval = q.getValue();
+            unit = q.getUnit();
+        }
+    };
+
+    enum Status {
+        /// The program produced a result
+        Done,
+        /// The result has to be obtained through Python this time
+        Fallback,
+        /// The expression does not evaluate to a number, do not try again
+        Unsupported,
+    };
+
+    static std::unique_ptr<ExpressionProgram> compile(const Expression *expr);
+
+    Status run(Value &result) const;
+
+private:
+    enum OpCode {
+        PushConstant,
+        PushVariable,
+        PushPython,
+        Unary,
+        Binary,
+        Call,
+        JumpIfFalse,
+        Jump,
+    };
+
+    struct Instruction
+    {
+        OpCode code;
+        int op = 0;          // operator or function id
+        std::size_t arg = 0; // number of call arguments or jump target
+        const Expression *expr = nullptr;
+        Value value;
+    };
+
+    bool compileNode(const Expression *expr);
+    void compileArgument(const Expression *expr);
+    std::size_t emit(OpCode opcode, const Expression *expr=nullptr, int op=0, std::size_t arg=0);
+
+    static bool isScalarFunction(int f);
+    static Value fromQuantity(const Quantity &q);
+    static bool fromPython(const Py::Object &pyobj, Value &value);
+    static Status loadVariable(const VariableExpression *expr, Value &value);
+    static bool unary(int op, Value &value);
+    static bool binary(int op, const Value &left, const Value &right, Value &res);
+    static bool compare(int op, const Value &left, const Value &right, Value &res);
+    static bool integerOp(int op, long a, long b, Value &res);
+    static bool floatOp(int op, double a, double b, Value &res);
+    static bool quantityOp(int op, const Value &left, const Value &right, Value &res);
+
+    std::vector<Instruction> code;
+};
+
+} // namespace App
+
+// Largest magnitude for which a long converts to double without rounding
+static const double exactIntegerLimit = 9007199254740992.0;
+
+static inline bool addOverflow(long a, long b, long &res) {
+    if ((b > 0 && a > LONG_MAX - b) || (b < 0 && a < LONG_MIN - b))
+        return true;
+    res = a + b;
+    return false;
+}
+
+static inline bool mulOverflow(long a, long b, long &res) {
+    // Conservative check, anything close to the limit is left to Python. The
+    // limit is derived from LONG_MAX as long is only 32 bits wide on Windows.
+    static const double limit = static_cast<double>(LONG_MAX) / 2.0;
+    if (std::fabs(static_cast<double>(a) * static_cast<double>(b)) >= limit)
+        return true;
+    res = a * b;
+    return false;
+}
+
+// Python's float modulo, the result takes the sign of the divisor
+static inline double floatMod(double a, double b) {
+    double mod = std::fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0))
+            mod += b;
+    }
+    else
+        mod = std::copysign(0.0, b);
+    return mod;
+}
+
+std::unique_ptr<ExpressionProgram> ExpressionProgram::compile(const Expression *expr)
+{
+    if (!expr || !expr->getOwner())
+        return {};
+    std::unique_ptr<ExpressionProgram> program(new ExpressionProgram);
+    if (!program->compileNode(expr))
+        return {};
+    return program;
+}
+
+std::size_t ExpressionProgram::emit(OpCode opcode, const Expression *expr, int op, std::size_t arg)
+{
+    Instruction ins;
+    ins.code = opcode;
+    ins.expr = expr;
+    ins.op = op;
+    ins.arg = arg;
+    code.push_back(ins);
+    return code.size() - 1;
+}
+
+void ExpressionProgram::compileArgument(const Expression *expr)
+{
+    if (!compileNode(expr))
+        emit(PushPython, expr);
+}
+
+bool ExpressionProgram::isScalarFunction(int f)
+{
+    switch (f) {
+    case FunctionExpression::ACOS:
+    case FunctionExpression::ASIN:
+    case FunctionExpression::ATAN:
+    case FunctionExpression::ABS:
+    case FunctionExpression::EXP:
+    case FunctionExpression::LOG:
+    case FunctionExpression::LOG10:
+    case FunctionExpression::SIN:
+    case FunctionExpression::SINH:
+    case FunctionExpression::TAN:
+    case FunctionExpression::TANH:
+    case FunctionExpression::SQRT:
+    case FunctionExpression::CBRT:
+    case FunctionExpression::COS:
+    case FunctionExpression::COSH:
+    case FunctionExpression::ATAN2:
+    case FunctionExpression::MOD:
+    case FunctionExpression::POW:
+    case FunctionExpression::HYPOT:
+    case FunctionExpression::CATH:
+    case FunctionExpression::ROUND:
+    case FunctionExpression::TRUNC:
+    case FunctionExpression::CEIL:
+    case FunctionExpression::FLOOR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ExpressionProgram::compileNode(const Expression *expr)
+{
+    if (expr->hasComponent())
+        return false;
+
+    Base::Type type = expr->getTypeId();
+    if (type == ConstantExpression::getClassTypeId()) {
+        auto constant = static_cast<const ConstantExpression*>(expr);
+        std::string name = constant->getName();
+        if (name == "None")
+            return false;
+        std::size_t idx = emit(PushConstant);
+        if (name == "True" || name == "False")
+            code[idx].value.setBool(name == "True");
+        else
+            code[idx].value = fromQuantity(constant->getQuantity());
+        return true;
+    }
+    if (type == NumberExpression::getClassTypeId() || type == UnitExpression::getClassTypeId()) {
+        std::size_t idx = emit(PushConstant);
+        code[idx].value = fromQuantity(static_cast<const UnitExpression*>(expr)->getQuantity());
+        return true;
+    }
+    if (type == VariableExpression::getClassTypeId()) {
+        emit(PushVariable, expr);
+        return true;
+    }
+    if (type == OperatorExpression::getClassTypeId()) {
+        auto opExpr = static_cast<const OperatorExpression*>(expr);
+        int op = opExpr->getOperator();
+        switch (op) {
+        case OperatorExpression::NEG:
+        case OperatorExpression::POS:
+            compileArgument(opExpr->getLeft());
+            emit(Unary, expr, op);
+            return true;
+        case OperatorExpression::ADD:
+        case OperatorExpression::SUB:
+        case OperatorExpression::MUL:
+        case OperatorExpression::DIV:
+        case OperatorExpression::MOD:
+        case OperatorExpression::POW:
+        case OperatorExpression::EQ:
+        case OperatorExpression::NEQ:
+        case OperatorExpression::LT:
+        case OperatorExpression::GT:
+        case OperatorExpression::LTE:
+        case OperatorExpression::GTE:
+        case OperatorExpression::UNIT:
+            compileArgument(opExpr->getLeft());
+            compileArgument(opExpr->getRight());
+            emit(Binary, expr, op);
+            return true;
+        default:
+            return false;
+        }
+    }
+    if (type == FunctionExpression::getClassTypeId()) {
+        auto func = static_cast<const FunctionExpression*>(expr);
+        const auto &args = func->getArgs();
+        int f = func->getFunction();
+        if (args.empty())
+            return false;
+        if (f == FunctionExpression::HREF || f == FunctionExpression::HIDDENREF) {
+            compileArgument(args[0]);
+            return true;
+        }
+        if (!isScalarFunction(f) || args.size() > 3)
+            return false;
+        for (auto arg : args)
+            compileArgument(arg);
+        emit(Call, expr, f, args.size());
+        return true;
+    }
+    if (type == ConditionalExpression::getClassTypeId()) {
+        auto cond = static_cast<const ConditionalExpression*>(expr);
+        compileArgument(cond->getCondition());
+        std::size_t jumpFalse = emit(JumpIfFalse);
+        compileArgument(cond->getTrueExpr());
+        std::size_t jumpEnd = emit(Jump);
+        code[jumpFalse].arg = code.size();
+        compileArgument(cond->getFalseExpr());
+        code[jumpEnd].arg = code.size();
+        return true;
+    }
+    return false;
+}
+
+ExpressionProgram::Value ExpressionProgram::fromQuantity(const Quantity &q)
+{
+    // Same conversion as pyFromQuantity()
+    Value value;
+    if (!q.getUnit().isEmpty()) {
+        value.setQuantity(q);
+        return value;
+    }
+    long l;
+    int i;
+    if (essentiallyInteger(q.getValue(), l, i))
+        value.setInt(l);
+    else
+        value.setFloat(q.getValue());
+    return value;
+}
+
+bool ExpressionProgram::fromPython(const Py::Object &pyobj, Value &value)
+{
+    PyObject *obj = pyobj.ptr();
+    if (PyObject_TypeCheck(obj, &QuantityPy::Type))
+        value.setQuantity(*static_cast<QuantityPy*>(obj)->getQuantityPtr());
+    else if (PyBool_Check(obj))
+        value.setBool(obj == Py_True);
+    else if (PyLong_Check(obj)) {
+        int overflow = 0;
+        long l = PyLong_AsLongAndOverflow(obj, &overflow);
+        if (overflow)
+            return false;
+        value.setInt(l);
+    }
+    else if (PyFloat_Check(obj))
+        value.setFloat(PyFloat_AsDouble(obj));
+    else
+        return false;
+    return true;
+}
+
+ExpressionProgram::Status
+ExpressionProgram::loadVariable(const VariableExpression *expr, Value &value)
+{
+    const ObjectIdentifier &path = expr->getPath();
+    if (!path.getSubObjectName().empty())
+        return Unsupported;
+
+    int ptype = 0;
+    Property *prop = path.getProperty(&ptype);
+    if (!prop)
+        return Fallback;
+    if (ptype != 0 || (path.numComponents() != 1 && path.numSubComponents() != 1))
+        return Unsupported;
+
+    if (prop->isDerivedFrom(PropertyQuantity::getClassTypeId())) {
+        auto qprop = static_cast<PropertyQuantity*>(prop);
+        value.type = Value::Quant;
+        value.dval = qprop->getValue();
+        value.unit = qprop->getUnit();
+    }
+    else if (prop->isDerivedFrom(PropertyFloat::getClassTypeId()))
+        value.setFloat(static_cast<PropertyFloat*>(prop)->getValue());
+    else if (prop->isDerivedFrom(PropertyInteger::getClassTypeId()))
+        value.setInt(static_cast<PropertyInteger*>(prop)->getValue());
+    else if (prop->isDerivedFrom(PropertyBool::getClassTypeId()))
+        value.setBool(static_cast<PropertyBool*>(prop)->getValue());
+    else
+        return Unsupported;
+    return Done;
+}
+
+bool ExpressionProgram::unary(int op, Value &value)
+{
+    switch (value.type) {
+    case Value::Quant:
+    case Value::Float:
+        if (op == OperatorExpression::NEG)
+            value.dval = -value.dval;
+        return true;
+    default:
+        if (op == OperatorExpression::NEG) {
+            if (value.ival == LONG_MIN)
+                return false;
+            value.ival = -value.ival;
+        }
+        value.type = Value::Int;
+        return true;
+    }
+}
+
+bool ExpressionProgram::compare(int op, const Value &left, const Value &right, Value &res)
+{
+    if (left.type == Value::Quant && right.type == Value::Quant) {
+        // Same as QuantityPy::richCompare()
+        Quantity a = left.toQuantity();
+        Quantity b = right.toQuantity();
+        try {
+            switch (op) {
+            case OperatorExpression::EQ:
+                res.setBool(a == b);
+                break;
+            case OperatorExpression::NEQ:
+                res.setBool(!(a == b));
+                break;
+            case OperatorExpression::LT:
+                res.setBool(a < b);
+                break;
+            case OperatorExpression::LTE:
+                res.setBool(a < b || a == b);
+                break;
+            case OperatorExpression::GT:
+                res.setBool(!(a < b) && !(a == b));
+                break;
+            default:
+                res.setBool(!(a < b));
+                break;
+            }
+        }
+        catch (Base::Exception &) {
+            return false;
+        }
+        return true;
+    }
+
+    if (left.isIntegral() && right.isIntegral()) {
+        long a = left.ival;
+        long b = right.ival;
+        switch (op) {
+        case OperatorExpression::EQ:
+            res.setBool(a == b);
+            break;
+        case OperatorExpression::NEQ:
+            res.setBool(a != b);
+            break;
+        case OperatorExpression::LT:
+            res.setBool(a < b);
+            break;
+        case OperatorExpression::LTE:
+            res.setBool(a <= b);
+            break;
+        case OperatorExpression::GT:
+            res.setBool(a > b);
+            break;
+        default:
+            res.setBool(a >= b);
+            break;
+        }
+        return true;
+    }
+
+    // Python compares int and float exactly, which a plain conversion only
+    // guarantees for moderately sized integers
+    if ((left.isIntegral() && std::fabs(left.toDouble()) > exactIntegerLimit)
+            || (right.isIntegral() && std::fabs(right.toDouble()) > exactIntegerLimit))
+        return false;
+
+    double a = left.toDouble();
+    double b = right.toDouble();
+    switch (op) {
+    case OperatorExpression::EQ:
+        res.setBool(a == b);
+        break;
+    case OperatorExpression::NEQ:
+        res.setBool(a != b);
+        break;
+    case OperatorExpression::LT:
+        res.setBool(a < b);
+        break;
+    case OperatorExpression::LTE:
+        res.setBool(a <= b);
+        break;
+    case OperatorExpression::GT:
+        res.setBool(a > b);
+        break;
+    default:
+        res.setBool(a >= b);
+        break;
+    }
+    return true;
+}
+
+bool ExpressionProgram::integerOp(int op, long a, long b, Value &res)
+{
+    long l = 0;
+    switch (op) {
+    case OperatorExpression::ADD:
+        if (addOverflow(a, b, l))
+            return false;
+        break;
+    case OperatorExpression::SUB:
+        if (b == LONG_MIN || addOverflow(a, -b, l))
+            return false;
+        break;
+    case OperatorExpression::MUL:
+    case OperatorExpression::UNIT:
+        if (mulOverflow(a, b, l))
+            return false;
+        break;
+    case OperatorExpression::DIV:
+        if (b == 0 || std::fabs(static_cast<double>(a)) > exactIntegerLimit
+                   || std::fabs(static_cast<double>(b)) > exactIntegerLimit)
+            return false;
+        res.setFloat(static_cast<double>(a) / static_cast<double>(b));
+        return true;
+    case OperatorExpression::MOD:
+        if (b == 0 || (a == LONG_MIN && b == -1))
+            return false;
+        l = a % b;
+        if (l != 0 && ((l < 0) != (b < 0)))
+            l += b;
+        break;
+    case OperatorExpression::POW:
+        if (b < 0)
+            return floatOp(op, static_cast<double>(a), static_cast<double>(b), res);
+        l = 1;
+        while (b) {
+            if (b & 1) {
+                if (mulOverflow(l, a, l))
+                    return false;
+            }
+            b >>= 1;
+            if (b && mulOverflow(a, a, a))
+                return false;
+        }
+        break;
+    default:
+        return false;
+    }
+    res.setInt(l);
+    return true;
+}
+
+bool ExpressionProgram::floatOp(int op, double a, double b, Value &res)
+{
+    switch (op) {
+    case OperatorExpression::ADD:
+        res.setFloat(a + b);
+        return true;
+    case OperatorExpression::SUB:
+        res.setFloat(a - b);
+        return true;
+    case OperatorExpression::MUL:
+    case OperatorExpression::UNIT:
+        res.setFloat(a * b);
+        return true;
+    case OperatorExpression::DIV:
+        if (b == 0.0)
+            return false;
+        res.setFloat(a / b);
+        return true;
+    case OperatorExpression::MOD:
+        if (b == 0.0)
+            return false;
+        res.setFloat(floatMod(a, b));
+        return true;
+    case OperatorExpression::POW: {
+        // Leave the special cases (complex results, zero division, overflow,
+        // non-finite operands) to Python
+        if (!std::isfinite(a) || !std::isfinite(b))
+            return false;
+        if (b == 0.0) {
+            res.setFloat(1.0);
+            return true;
+        }
+        if ((a == 0.0 && b < 0.0) || (a < 0.0 && b != std::floor(b)))
+            return false;
+        double v = std::pow(a, b);
+        if (!std::isfinite(v))
+            return false;
+        res.setFloat(v);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool ExpressionProgram::quantityOp(int op, const Value &left, const Value &right, Value &res)
+{
+    // Same as the QuantityPy number protocol
+    try {
+        switch (op) {
+        case OperatorExpression::ADD:
+            res.setQuantity(left.toQuantity() + right.toQuantity());
+            return true;
+        case OperatorExpression::SUB:
+            res.setQuantity(left.toQuantity() - right.toQuantity());
+            return true;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            res.setQuantity(left.toQuantity() * right.toQuantity());
+            return true;
+        case OperatorExpression::DIV:
+            res.setQuantity(left.toQuantity() / right.toQuantity());
+            return true;
+        case OperatorExpression::MOD: {
+            if (left.type != Value::Quant || right.toDouble() == 0.0)
+                return false;
+            res.type = Value::Quant;
+            res.dval = floatMod(left.dval, right.toDouble());
+            res.unit = left.unit;
+            return true;
+        }
+        case OperatorExpression::POW:
+            if (left.type != Value::Quant)
+                return false;
+            if (right.type == Value::Quant)
+                res.setQuantity(left.toQuantity().pow(right.toQuantity()));
+            else
+                res.setQuantity(left.toQuantity().pow(right.toDouble()));
+            return true;
+        default:
+            return false;
+        }
+    }
+    catch (Base::Exception &) {
+        return false;
+    }
+}
+
+bool ExpressionProgram::binary(int op, const Value &left, const Value &right, Value &res)
+{
+    switch (op) {
+    case OperatorExpression::EQ:
+    case OperatorExpression::NEQ:
+    case OperatorExpression::LT:
+    case OperatorExpression::LTE:
+    case OperatorExpression::GT:
+    case OperatorExpression::GTE:
+        return compare(op, left, right, res);
+    default:
+        break;
+    }
+    if (left.type == Value::Quant || right.type == Value::Quant)
+        return quantityOp(op, left, right, res);
+    if (left.isIntegral() && right.isIntegral())
+        return integerOp(op, left.ival, right.ival, res);
+    return floatOp(op, left.toDouble(), right.toDouble(), res);
+}
+
+ExpressionProgram::Status ExpressionProgram::run(Value &result) const
+{
+    std::vector<Value> stack;
+    stack.reserve(code.size());
+
+    // Only taken if the program contains nodes that need Python
+    std::unique_ptr<Base::PyGILStateLocker> lock;
+
+    for (std::size_t pc = 0; pc < code.size(); ++pc) {
+        const Instruction &ins = code[pc];
+        switch (ins.code) {
+        case PushConstant:
+            stack.push_back(ins.value);
+            break;
+        case PushVariable: {
+            stack.emplace_back();
+            Status status = loadVariable(static_cast<const VariableExpression*>(ins.expr),
+                                         stack.back());
+            if (status != Done)
+                return status;
+            break;
+        }
+        case PushPython:
+            if (!lock)
+                lock = std::make_unique<Base::PyGILStateLocker>();
+            stack.emplace_back();
+            if (!fromPython(ins.expr->getPyValue(), stack.back()))
+                return Unsupported;
+            break;
+        case Unary:
+            if (!unary(ins.op, stack.back()))
+                return Fallback;
+            break;
+        case Binary: {
+            Value right = stack.back();
+            stack.pop_back();
+            Value res;
+            if (!binary(ins.op, stack.back(), right, res))
+                return Fallback;
+            stack.back() = res;
+            break;
+        }
+        case Call: {
+            if (!ins.expr->getOwner())
+                return Fallback;
+            auto first = stack.end() - static_cast<std::ptrdiff_t>(ins.arg);
+            Quantity args[3];
+            for (std::size_t i = 0; i < ins.arg; ++i)
+                args[i] = first[i].toQuantity();
+            Quantity res = FunctionExpression::evaluateScalar(
+                    ins.expr, ins.op, args[0], args[1], args[2], ins.arg);
+            stack.erase(first, stack.end());
+            stack.emplace_back();
+            stack.back().setQuantity(res);
+            break;
+        }
+        case JumpIfFalse: {
+            bool cond = stack.back().isTrue();
+            stack.pop_back();
+            if (!cond)
+                pc = ins.arg - 1;
+            break;
+        }
+        case Jump:
+            pc = ins.arg - 1;
+            break;
+        }
+    }
+    assert(stack.size() == 1);
+    result = stack.back();
+    return Done;
+}
+
 //
 // Expression base-class
 //
@@ -1106,7 +1812,34 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
     return ExpressionPtr(expr);
 }
 
+const ExpressionProgram *Expression::getProgram() const {
+    if(!programCompiled) {
+        programCompiled = true;
+        program = ExpressionProgram::compile(this);
+    }
+    return program.get();
+}
+
 App::any Expression::getValueAsAny() const {
+    if(auto prog = getProgram()) {
+        ExpressionProgram::Value value;
+        switch(prog->run(value)) {
+        case ExpressionProgram::Done:
+            switch(value.type) {
+            case ExpressionProgram::Value::Quant:
+                return App::any(value.toQuantity());
+            case ExpressionProgram::Value::Float:
+                return App::any(value.dval);
+            default:
+                return App::any(value.ival);
+            }
+        case ExpressionProgram::Unsupported:
+            program.reset();
+            break;
+        default:
+            break;
+        }
+    }
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
@@ -1128,6 +1861,8 @@ Py::Object Expression::getPyValue() const {
 void Expression::addComponent(Component *component) {
     assert(component);
     components.push_back(component);
+    program.reset();
+    programCompiled = false;
 }
 
 void Expression::visit(ExpressionVisitor &v) {
@@ -1138,6 +1873,24 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    if(auto prog = getProgram()) {
+        ExpressionProgram::Value value;
+        switch(prog->run(value)) {
+        case ExpressionProgram::Done:
+            // Same as expressionFromPy()
+            if(value.type == ExpressionProgram::Value::Bool) {
+                if(value.ival)
+                    return new ConstantExpression(owner,"True",Quantity(1.0));
+                return new ConstantExpression(owner,"False",Quantity(0.0));
+            }
+            return new NumberExpression(owner,value.toQuantity());
+        case ExpressionProgram::Unsupported:
+            program.reset();
+            break;
+        default:
+            break;
+        }
+    }
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
@@ -2407,6 +3160,29 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         v3 = pyToQuantity(e3,expr,"Invalid third argument.");
     }
 
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            v1.getValue() * M_PI / 180.0)));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    default:
+        break;
+    }
+
+    return Py::asObject(new QuantityPy(new Quantity(evaluateScalar(expr, f, v1, v2, v3, args.size()))));
+}
+
+Quantity FunctionExpression::evaluateScalar(const Expression *expr, int f, const Quantity &v1,
+        const Quantity &v2, const Quantity &v3, std::size_t numArgs)
+{
     double output;
     Unit unit;
     double scaler = 1;
@@ -2418,9 +3194,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2504,7 +3277,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case ATAN2:
-        if (e2.isNone())
+        if (numArgs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2513,12 +3286,12 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / M_PI;
         break;
     case MOD:
-        if (e2.isNone())
+        if (numArgs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         unit = v1.getUnit() / v2.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (numArgs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2536,23 +3309,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (numArgs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (numArgs > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
@@ -2617,11 +3384,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (numArgs > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (numArgs > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2636,19 +3403,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     default:
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
@@ -43,6 +43,7 @@ namespace App  {
 
 class DocumentObject;
 class Expression;
+class ExpressionProgram;
 class Document;
 
 using ExpressionPtr = std::unique_ptr<Expression>;
@@ -222,6 +223,13 @@ protected:
 public:
     std::string comment;
     // clang-format on
+
+private:
+    const ExpressionProgram *getProgram() const;
+
+    /// Numeric form of this expression evaluated without Python, compiled on first use
+    mutable std::unique_ptr<ExpressionProgram> program;
+    mutable bool programCompiled = false;
 };
 
 }
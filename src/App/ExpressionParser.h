@@ -270,6 +270,21 @@ public:
 
     int priority() const override;
 
+    Expression* getCondition() const
+    {
+        return condition;
+    }
+
+    Expression* getTrueExpr() const
+    {
+        return trueExpr;
+    }
+
+    Expression* getFalseExpr() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -393,6 +408,14 @@ public:
     static Py::Object
     evaluate(const Expression* owner, int type, const std::vector<Expression*>& args);
 
+    /// Evaluate a scalar function (sin, pow, hypot, ...) on already computed arguments
+    static Base::Quantity evaluateScalar(const Expression* owner,
+                                         int type,
+                                         const Base::Quantity& v1,
+                                         const Base::Quantity& v2,
+                                         const Base::Quantity& v3,
+                                         std::size_t numArgs);
+
     Function getFunction() const
     {
         return f;
@@ -457,7 +480,7 @@ public:
         return var.getPropertyName();
     }
 
-    ObjectIdentifier getPath() const
+    const ObjectIdentifier& getPath() const
     {
         return var;
     }
@@ -25,6 +25,7 @@
 #ifndef APP_MAPPED_NAME_H
 #define APP_MAPPED_NAME_H
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -644,18 +645,39 @@ public:
     /// data, the shorter array is considered "less than" the longer.
     int compare(const MappedName& other) const
     {
-        int thisSize = this->size();
-        int otherSize = other.size();
-        for (int i = 0, count = std::min(thisSize, otherSize); i < count; ++i) {
-            char thisChar = this->operator[](i);
-            char otherChar = other[i];
-            if (thisChar < otherChar) {
-                return -1;
+        // Walk both names one contiguous segment at a time instead of dispatching every byte
+        // through operator[], this is the hot path of the element map lookups.
+        const QByteArray* thisParts[] = {&this->data, &this->postfix};
+        const QByteArray* otherParts[] = {&other.data, &other.postfix};
+        int thisPart = 0;
+        int otherPart = 0;
+        int thisPos = 0;
+        int otherPos = 0;
+        for (;;) {
+            while (thisPart < 2 && thisPos >= thisParts[thisPart]->size()) {
+                ++thisPart;
+                thisPos = 0;
+            }
+            while (otherPart < 2 && otherPos >= otherParts[otherPart]->size()) {
+                ++otherPart;
+                otherPos = 0;
             }
-            if (thisChar > otherChar) {
-                return 1;
+            if (thisPart == 2 || otherPart == 2) {
+                break;
             }
+            const char* thisChars = thisParts[thisPart]->constData() + thisPos;
+            const char* otherChars = otherParts[otherPart]->constData() + otherPos;
+            int count = std::min(thisParts[thisPart]->size() - thisPos,
+                                 otherParts[otherPart]->size() - otherPos);
+            auto res = std::mismatch(thisChars, thisChars + count, otherChars);
+            if (res.first != thisChars + count) {
+                return *res.first < *res.second ? -1 : 1;
+            }
+            thisPos += count;
+            otherPos += count;
         }
+        int thisSize = this->size();
+        int otherSize = other.size();
         if (thisSize < otherSize) {
             return -1;
         }
@@ -49,7 +49,7 @@ public:
     {
         verbose = on;
     }
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     std::vector<App::DocumentObject*> importObjects(std::istream&);
     void importObject(const std::vector<App::DocumentObject*>& o, Base::XMLReader& r);
     void exportObject(const std::vector<App::DocumentObject*>& o, Base::Writer& w);
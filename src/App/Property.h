@@ -115,7 +115,7 @@ public:
      * This method is defined in Base::Persistence
      * @see Base::Persistence
      */
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         // you have to implement this method in all property classes!
         return sizeof(father) + sizeof(StatusBits);
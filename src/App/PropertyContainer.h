@@ -160,7 +160,7 @@ public:
    */
   ~PropertyContainer() override;
 
-  unsigned int getMemSize () const override;
+  std::size_t getMemSize () const override;
 
   virtual std::string getFullName() const {return {};}
 
@@ -573,9 +573,9 @@ void PropertyFileIncluded::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyFileIncluded::getMemSize() const
+std::size_t PropertyFileIncluded::getMemSize() const
 {
-    unsigned int mem = Property::getMemSize();
+    std::size_t mem = Property::getMemSize();
     mem += _cValue.size();
     mem += _BaseFileName.size();
     return mem;
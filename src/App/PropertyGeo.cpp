@@ -381,9 +381,9 @@ void PropertyVectorList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyVectorList&>(from)._lValueList);
 }
 
-unsigned int PropertyVectorList::getMemSize() const
+std::size_t PropertyVectorList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
+    return _lValueList.size() * sizeof(Base::Vector3d);
 }
 
 //**************************************************************************
@@ -1023,9 +1023,9 @@ void PropertyPlacementList::Paste(const Property& from)
     setValues(dynamic_cast<const PropertyPlacementList&>(from)._lValueList);
 }
 
-unsigned int PropertyPlacementList::getMemSize() const
+std::size_t PropertyPlacementList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
+    return _lValueList.size() * sizeof(Base::Vector3d);
 }
 
 
@@ -1157,9 +1157,9 @@ void PropertyLinkList::Paste(const Property& from)
     setValues(static_cast<const PropertyLinkList&>(from)._lValueList);
 }
 
-unsigned int PropertyLinkList::getMemSize() const
+std::size_t PropertyLinkList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(App::DocumentObject*));
+    return _lValueList.size() * sizeof(App::DocumentObject*);
 }
 
 
@@ -3119,10 +3119,9 @@ void PropertyLinkSubList::Paste(const Property& from)
     setValues(link._lValueList, link._lSubList, std::vector<ShadowSub>(link._ShadowSubList));
 }
 
-unsigned int PropertyLinkSubList::getMemSize() const
+std::size_t PropertyLinkSubList::getMemSize() const
 {
-    unsigned int size =
-        static_cast<unsigned int>(_lValueList.size() * sizeof(App::DocumentObject*));
+    std::size_t size = _lValueList.size() * sizeof(App::DocumentObject*);
     for (int i = 0; i < getSize(); i++) {
         size += _lSubList[i].size();
     }
@@ -5312,9 +5311,9 @@ void PropertyXLinkSubList::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyXLinkSubList::getMemSize() const
+std::size_t PropertyXLinkSubList::getMemSize() const
 {
-    unsigned int size = 0;
+    std::size_t size = 0;
     for (auto& l : _Links) {
         size += l.getMemSize();
     }
@@ -64,7 +64,7 @@ public:
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
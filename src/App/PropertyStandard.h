@@ -80,7 +80,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(long);
     }
@@ -141,7 +141,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -392,7 +392,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     long getPyValue(PyObject* item) const override;
@@ -446,7 +446,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -516,7 +516,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -573,7 +573,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(double);
     }
@@ -728,7 +728,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     double getPyValue(PyObject* item) const override;
@@ -779,7 +779,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void setPathValue(const App::ObjectIdentifier& path, const boost::any& value) override;
     const boost::any getPathValue(const App::ObjectIdentifier& path) const override;
@@ -834,7 +834,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool isSame(const Property& other) const override
     {
@@ -908,7 +908,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     std::string getPyValue(PyObject* item) const override;
@@ -951,7 +951,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(bool);
     }
@@ -992,7 +992,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     bool getPyValue(PyObject* py) const override;
@@ -1043,7 +1043,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(Color);
     }
@@ -1088,7 +1088,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     Color getPyValue(PyObject* py) const override;
@@ -1157,7 +1157,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return sizeof(_cMat);
     }
@@ -1272,7 +1272,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 protected:
     Material getPyValue(PyObject* py) const override;
@@ -1319,7 +1319,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     std::shared_ptr<Base::Persistence> getObject() const
     {
@@ -841,7 +841,7 @@ void StringHasher::Restore(Base::XMLReader& reader)
     reader.readEndElement("StringHasher");
 }
 
-unsigned int StringHasher::getMemSize() const
+std::size_t StringHasher::getMemSize() const
 {
     return (_hashes->SaveAll ? size() : count()) * 10;
 }
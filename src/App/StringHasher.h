@@ -644,7 +644,7 @@ public:
     StringHasher& operator=(StringHasher& other) = delete;
     StringHasher& operator=(StringHasher&& other) noexcept = delete;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& /*writer*/) const override;
@@ -114,9 +114,13 @@ int Transaction::getLastID()
     return _TransactionID;
 }
 
-unsigned int Transaction::getMemSize() const
+std::size_t Transaction::getMemSize() const
 {
-    return 0;
+    std::size_t size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->getMemSize();
+    }
+    return size;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -422,9 +426,15 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
     }
 }
 
-unsigned int TransactionObject::getMemSize() const
+std::size_t TransactionObject::getMemSize() const
 {
-    return 0;
+    std::size_t size = 0;
+    for (const auto& It : _PropChangeMap) {
+        if (It.second.property) {
+            size += It.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -65,7 +65,7 @@ public:
     // the utf-8 name of the transaction
     std::string Name;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader& reader) override;
@@ -117,7 +117,7 @@ public:
     void setProperty(const Property* pcProp);
     void addOrRemoveProperty(const Property* pcProp, bool add);
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader& reader) override;
@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -80,7 +81,7 @@ struct DocumentP
     bool opentransaction;
     std::bitset<32> StatusBits;
     int iUndoMode;
-    unsigned int UndoMemSize;
+    std::size_t UndoMemSize;
     unsigned int UndoMaxStackSize;
     std::string programVersion;
     mutable HasherMap hashers;
@@ -91,6 +92,9 @@ struct DocumentP
 #endif  // USE_OLD_DAG
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    // guards the recompute log and the undo transaction while objects are
+    // executed on worker threads (see Document::_recomputeParallel())
+    std::recursive_mutex recomputeMutex;
 
     StringHasherRef Hasher;
 
@@ -112,6 +116,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::recursive_mutex> lock(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
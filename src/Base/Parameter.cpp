@@ -681,6 +681,71 @@ void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
     }
 }
 
+namespace
+{
+const std::string& cacheKey(ParameterGrp::ParamType Type, const char* Name)
+{
+    thread_local std::string key;
+    key.assign(1, static_cast<char>(Type));
+    key += Name;
+    return key;
+}
+}  // namespace
+
+ParameterGrp::CachedValue ParameterGrp::_GetCachedValue(ParamType Type, const char* Name) const
+{
+    // The lock is held while reading the DOM, so that a value cleared by a
+    // concurrent Set call cannot be replaced by the one read before the change
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    if (Name) {
+        auto it = _Cache.find(cacheKey(Type, Name));
+        if (it != _Cache.end()) {
+            return it->second;
+        }
+    }
+
+    CachedValue value;
+    DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name);
+    if (pcElem) {
+        const int base = 10;
+        std::string str = StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str();
+        value.exists = true;
+        switch (Type) {
+            case ParamType::FCBool:
+                value.intValue = str == "1";
+                break;
+            case ParamType::FCInt:
+                value.intValue = atol(str.c_str());
+                break;
+            case ParamType::FCUInt:
+                value.uintValue = strtoul(str.c_str(), nullptr, base);
+                break;
+            case ParamType::FCFloat:
+                value.floatValue = atof(str.c_str());
+                break;
+            default:
+                value.exists = false;
+                break;
+        }
+    }
+
+    if (Name) {
+        _Cache.emplace(cacheKey(Type, Name), value);
+    }
+    return value;
+}
+
+void ParameterGrp::_ClearCachedValue(ParamType Type, const char* Name) const
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    if (!Name) {
+        _Cache.clear();
+    }
+    else {
+        _Cache.erase(cacheKey(Type, Name));
+    }
+}
+
 void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Value)
 {
     const char* Type = TypeName(T);
@@ -708,6 +773,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
+            _ClearCachedValue(T, Name);
             // trigger observer
             _Notify(T, Name, Value);
         }
@@ -723,15 +789,13 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+    CachedValue value = _GetCachedValue(ParamType::FCBool, Name);
+
     // if not return preset
-    if (!pcElem) {
+    if (!value.exists) {
         return bPreset;
     }
-
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), "1") == 0);
+    return value.intValue != 0;
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -799,14 +863,13 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
+    CachedValue value = _GetCachedValue(ParamType::FCInt, Name);
+
     // if not return preset
-    if (!pcElem) {
+    if (!value.exists) {
         return lPreset;
     }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return value.intValue;
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -868,16 +931,13 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
+    CachedValue value = _GetCachedValue(ParamType::FCUInt, Name);
+
     // if not return preset
-    if (!pcElem) {
+    if (!value.exists) {
         return lPreset;
     }
-
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), nullptr, base);
+    return value.uintValue;
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -946,14 +1006,13 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
+    CachedValue value = _GetCachedValue(ParamType::FCFloat, Name);
+
     // if not return preset
-    if (!pcElem) {
+    if (!value.exists) {
         return dPreset;
     }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    return value.floatValue;
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1175,6 +1234,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _ClearCachedValue(ParamType::FCBool, Name);
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1197,6 +1257,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _ClearCachedValue(ParamType::FCFloat, Name);
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1218,6 +1279,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _ClearCachedValue(ParamType::FCInt, Name);
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1239,6 +1301,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _ClearCachedValue(ParamType::FCUInt, Name);
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1356,6 +1419,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _ClearCachedValue(ParamType::FCInvalid, nullptr);
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1527,6 +1591,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _ClearCachedValue(ParamType::FCInvalid, nullptr);
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1856,6 +1921,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _ClearCachedValue(ParamType::FCInvalid, nullptr);
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1979,6 +2045,7 @@ void ParameterManager::CreateDocument()
     // creating the node for the root group
     DOMElement* rootElem = _pDocument->getDocumentElement();
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
+    _ClearCachedValue(ParamType::FCInvalid, nullptr);
     _pGroupNode->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
 }
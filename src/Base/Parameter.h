@@ -50,6 +50,9 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -302,6 +305,20 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /// Parsed value of a bool, int, unsigned or float parameter
+    struct CachedValue
+    {
+        /// false if the parameter is not set, i.e. the preset is returned
+        bool exists = false;
+        long intValue = 0;
+        unsigned long uintValue = 0;
+        double floatValue = 0.0;
+    };
+    /// Get the parsed value of parameter \a Name of \a Type, reads and caches it if not cached
+    CachedValue _GetCachedValue(ParamType Type, const char* Name) const;
+    /// Drop the cached value of \a Name, or of all parameters if \a Name is null
+    void _ClearCachedValue(ParamType Type, const char* Name) const;
+
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement*
     FindNextElement(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Prev, const char* Type) const;
 
@@ -351,6 +368,13 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+    /** Parsed parameter values keyed by type and name
+     *
+     * Avoids searching and transcoding the DOM on every Get call. It is
+     * updated by every function modifying the DOM elements of this group.
+     */
+    mutable std::unordered_map<std::string, CachedValue> _Cache;
+    mutable std::mutex _CacheMutex;
 };
 
 /** The parameter serializer class
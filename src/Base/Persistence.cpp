@@ -47,7 +47,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(Base::Persistence, Base::BaseClass)
 //**************************************************************************
 // separator for other implementation aspects
 
-unsigned int Persistence::getMemSize() const
+std::size_t Persistence::getMemSize() const
 {
     // you have to implement this method in all descending classes!
     assert(0);
@@ -69,9 +69,20 @@ void Persistence::Restore(XMLReader& /*reader*/)
 void Persistence::SaveDocFile(Writer& /*writer*/) const
 {}
 
+bool Persistence::SaveSharedDocFile(Writer& writer) const
+{
+    SaveDocFile(writer);
+    return false;
+}
+
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::RestoreSharedDocFile(const Persistence& /*source*/)
+{
+    return false;
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
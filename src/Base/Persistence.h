@@ -24,6 +24,8 @@
 #ifndef APP_PERSISTENCE_H
 #define APP_PERSISTENCE_H
 
+#include <cstddef>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -43,7 +45,7 @@ public:
      * It is not meant to have the exact size, it is more or less an estimation
      * which runs fast! Is it two bytes or a GB?
      */
-    virtual unsigned int getMemSize() const = 0;
+    virtual std::size_t getMemSize() const = 0;
     /** This method is used to save properties to an XML document.
      * A good example you'll find in PropertyStandard.cpp, e.g. the vector:
      * \code
@@ -112,6 +114,14 @@ public:
      * ostream).
      */
     virtual void SaveDocFile(Writer& /*writer*/) const;
+    /** This method is used to save the part of a file that other objects may share
+     * Writer::addSharedFile() compares the files of several objects by this content,
+     * and a file that several objects refer to is saved with it. A subclass can leave
+     * out data that it saves elsewhere, e.g. as XML attribute in Save(), and return
+     * true. SaveDocFile() is then still used if no other object shares the file.
+     * The default implementation calls SaveDocFile() and returns false.
+     */
+    virtual bool SaveSharedDocFile(Writer& writer) const;
     /** This method is used to restore large amounts of data from a file
      * In this method you simply stream in your SaveDocFile() saved data.
      * Again you have to apply for the call of this method in the Restore() call:
@@ -142,6 +152,15 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** This method is used to restore a file that is shared with another object
+     * If a writer stored identical files of several objects only once (see
+     * Writer::addSharedFile()), RestoreDocFile() is called for the first object
+     * and then this method for each other object with the first one as \a source.
+     * A subclass can take over the already restored data of \a source and return
+     * true. The default implementation returns false, then RestoreDocFile() is
+     * called with the content of the file again.
+     */
+    virtual bool RestoreSharedDocFile(const Persistence& source);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
 
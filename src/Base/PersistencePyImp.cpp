@@ -54,7 +54,7 @@ Py::String PersistencePy::getContent() const
 
 Py::Int PersistencePy::getMemSize() const
 {
-    return Py::Int((long)getPersistencePtr()->getMemSize());
+    return Py::Long(static_cast<unsigned PY_LONG_LONG>(getPersistencePtr()->getMemSize()));
 }
 
 PyObject* PersistencePy::dumpContent(PyObject* args, PyObject* kwds)
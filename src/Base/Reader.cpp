@@ -24,7 +24,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <deque>
+#include <future>
+#include <iterator>
 #include <memory>
+#include <set>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
@@ -34,17 +38,22 @@
 #include "Base64.h"
 #include "Base64Filter.h"
 #include "Console.h"
+#include "Exception.h"
 #include "InputSource.h"
 #include "Persistence.h"
 #include "Sequencer.h"
 #include "Stream.h"
+#include "WorkerPool.h"
 #include "XMLTools.h"
 
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
 #include <zipios++/zipinputstream.h>
+#include <zlib.h>
+#include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #ifndef XERCES_CPP_NAMESPACE_BEGIN
 #define XERCES_CPP_NAMESPACE_QUALIFIER
@@ -391,8 +400,186 @@ void Base::XMLReader::readBinFile(const char* filename)
     to.close();
 }
 
+namespace
+{
+std::string inflateEntry(int method, const std::string& input, std::size_t size)
+{
+    if (method == zipios::STORED) {
+        return input;
+    }
+
+    std::string output(size, '\0');
+    z_stream zs {};
+    // negative window bits as zip entries are raw deflate streams
+    if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) {
+        throw Base::RuntimeError("Failed to initialize inflate stream");
+    }
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));  // NOLINT
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = reinterpret_cast<Bytef*>(&output[0]);  // NOLINT
+    zs.avail_out = static_cast<uInt>(output.size());
+    int err = inflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
+    inflateEnd(&zs);
+    if (err != Z_STREAM_END) {
+        throw Base::RuntimeError("Failed to inflate zip entry");
+    }
+    return output;
+}
+}  // namespace
+
+// Reads the compressed entries of the zip stream ahead and inflates them on
+// worker threads. Nested local readers share the queue so that they continue
+// with the entries following their parent file.
+struct Base::XMLReader::FileQueue
+{
+    struct Entry
+    {
+        zipios::ConstEntryPointer entry;
+        std::future<std::string> data;
+    };
+
+    FileQueue(zipios::ZipInputStream& zipstream, std::size_t window)
+        : pool(window)
+        , zipstream(zipstream)
+        , window(window)
+    {}
+
+    bool next(Entry& entry)
+    {
+        fill();
+        if (entries.empty()) {
+            return false;
+        }
+        entry = std::move(entries.front());
+        entries.pop_front();
+        return true;
+    }
+
+private:
+    void fill()
+    {
+        while (!atEnd && entries.size() < window) {
+            zipios::ConstEntryPointer entry;
+            try {
+                entry = zipstream.getNextEntry();
+            }
+            catch (const std::exception&) {
+                // there is no further entry
+                atEnd = true;
+                break;
+            }
+            if (!entry->isValid()) {
+                atEnd = true;
+                break;
+            }
+            std::string raw;
+            if (!zipstream.readRawEntry(raw)) {
+                atEnd = true;
+                break;
+            }
+            auto data = pool.submit([raw = std::move(raw),
+                                     method = static_cast<int>(entry->getMethod()),
+                                     size = static_cast<std::size_t>(entry->getSize())]() {
+                return inflateEntry(method, raw, size);
+            });
+            entries.push_back({entry, std::move(data)});
+        }
+    }
+
+    WorkerPool pool;
+    zipios::ZipInputStream& zipstream;
+    std::size_t window;
+    std::deque<Entry> entries;
+    bool atEnd {false};
+};
+
+Base::XMLReader::SharedFiles Base::XMLReader::getSharedFiles() const
+{
+    SharedFiles shared;
+    std::set<std::string> names;
+    for (const auto& it : FileList) {
+        if (!names.insert(it.FileName).second) {
+            shared[it.FileName].push_back(it.Object);
+        }
+    }
+    return shared;
+}
+
+void Base::XMLReader::restoreSharedFile(const FileEntry& source,
+                                        const std::vector<Base::Persistence*>& objects,
+                                        const std::string& data) const
+{
+    for (Base::Persistence* object : objects) {
+        try {
+            if (!object->RestoreSharedDocFile(*source.Object)) {
+                boost::iostreams::stream<boost::iostreams::array_source> stream(data.data(),
+                                                                                data.size());
+                Base::Reader reader(stream, source.FileName, FileVersion);
+                object->RestoreDocFile(reader);
+            }
+        }
+        catch (...) {
+            Base::Console().Error("Reading failed from shared embedded file: %s\n",
+                                  source.FileName.c_str());
+            FailedFiles.push_back(source.FileName);
+        }
+    }
+}
+
+void Base::XMLReader::readFiles(FileQueue& queue) const
+{
+    FileQueue::Entry current;
+    if (!queue.next(current)) {
+        return;
+    }
+    SharedFiles sharedFiles = getSharedFiles();
+    std::vector<FileEntry>::const_iterator it = FileList.begin();
+    Base::SequencerLauncher seq("Importing project files...", FileList.size());
+    while (current.entry->isValid() && it != FileList.end()) {
+        std::vector<FileEntry>::const_iterator jt = it;
+        while (jt != FileList.end() && current.entry->getName() != jt->FileName) {
+            ++jt;
+        }
+        if (jt != FileList.end()) {
+            try {
+                std::string data = current.data.get();
+                boost::iostreams::stream<boost::iostreams::array_source> stream(data.data(),
+                                                                                data.size());
+                Base::Reader reader(stream, jt->FileName, FileVersion);
+                jt->Object->RestoreDocFile(reader);
+                auto shared = sharedFiles.find(jt->FileName);
+                if (shared != sharedFiles.end()) {
+                    restoreSharedFile(*jt, shared->second, data);
+                }
+                if (reader.getLocalReader()) {
+                    reader.getLocalReader()->readFiles(queue);
+                }
+            }
+            catch (...) {
+                Base::Console().Error("Reading failed from embedded file: %s\n",
+                                      current.entry->toString().c_str());
+                FailedFiles.push_back(jt->FileName);
+            }
+            it = jt + 1;
+        }
+
+        seq.next();
+
+        if (!queue.next(current)) {
+            break;
+        }
+    }
+}
+
 void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
 {
+    if (ThreadCount > 1) {
+        FileQueue queue(zipstream, static_cast<std::size_t>(ThreadCount));
+        readFiles(queue);
+        return;
+    }
+
     // It's possible that not all objects inside the document could be created, e.g. if a module
     // is missing that would know these object types. So, there may be data files inside the zip
     // file that cannot be read. We simply ignore these files.
@@ -410,6 +597,7 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    SharedFiles sharedFiles = getSharedFiles();
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -423,10 +611,23 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // no file name for the current entry in the zip was registered.
         if (jt != FileList.end()) {
             try {
-                Base::Reader reader(zipstream, jt->FileName, FileVersion);
-                jt->Object->RestoreDocFile(reader);
-                if (reader.getLocalReader()) {
-                    reader.getLocalReader()->readFiles(zipstream);
+                auto shared = sharedFiles.find(jt->FileName);
+                if (shared == sharedFiles.end()) {
+                    Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                    jt->Object->RestoreDocFile(reader);
+                    if (reader.getLocalReader()) {
+                        reader.getLocalReader()->readFiles(zipstream);
+                    }
+                }
+                else {
+                    // keep the content in memory for the other objects sharing the file
+                    std::string data {std::istreambuf_iterator<char>(zipstream),
+                                      std::istreambuf_iterator<char>()};
+                    boost::iostreams::stream<boost::iostreams::array_source> stream(data.data(),
+                                                                                    data.size());
+                    Base::Reader reader(stream, jt->FileName, FileVersion);
+                    jt->Object->RestoreDocFile(reader);
+                    restoreSharedFile(*jt, shared->second, data);
                 }
             }
             catch (...) {
@@ -28,6 +28,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -251,6 +252,14 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Set the number of threads used to inflate the files in readFiles()
+     * If greater than one, the compressed data of the upcoming entries is read
+     * ahead and inflated on worker threads while the current one is restored.
+     */
+    void setThreadCount(int count)
+    {
+        ThreadCount = count;
+    }
     /// get all registered file names
     const std::vector<std::string>& getFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -364,8 +373,18 @@ public:
     std::vector<FileEntry> FileList;
 
 private:
+    struct FileQueue;
+    void readFiles(FileQueue& queue) const;
+    /// objects that requested a file after the first object with the same file name
+    using SharedFiles = std::map<std::string, std::vector<Base::Persistence*>>;
+    SharedFiles getSharedFiles() const;
+    void restoreSharedFile(const FileEntry& source,
+                           const std::vector<Base::Persistence*>& objects,
+                           const std::string& data) const;
+
     std::vector<std::string> FileNames;
     mutable std::vector<std::string> FailedFiles;
+    int ThreadCount {0};
 
     std::bitset<32> StatusBits;
 
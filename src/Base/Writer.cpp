@@ -23,9 +23,14 @@
 
 #include "PreCompiled.h"
 
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <future>
 #include <limits>
 #include <locale>
 #include <iomanip>
+#include <zlib.h>
 
 #include "Writer.h"
 #include "Base64.h"
@@ -33,6 +38,7 @@
 #include "Exception.h"
 #include "FileInfo.h"
 #include "Persistence.h"
+#include "WorkerPool.h"
 #include "Stream.h"
 #include "Tools.h"
 
@@ -258,6 +264,11 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
     return temp.FileName;
 }
 
+std::string Writer::addSharedFile(const char* Name, const Base::Persistence* Object)
+{
+    return addFile(Name, Object);
+}
+
 std::string Writer::getUniqueFileName(const char* Name)
 {
     // name in use?
@@ -358,8 +369,225 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     ZipStream.putNextEntry(file);
 }
 
+namespace
+{
+struct DeflatedEntry
+{
+    std::string name;
+    std::string data;
+    uint32_t size {0};
+    uint32_t crc {0};
+};
+
+DeflatedEntry deflateEntry(std::string name, const std::string& input, int level)
+{
+    DeflatedEntry entry;
+    entry.name = std::move(name);
+    entry.size = static_cast<uint32_t>(input.size());
+
+    const auto* next = reinterpret_cast<const Bytef*>(input.data());  // NOLINT
+    entry.crc = crc32(crc32(0, Z_NULL, 0), next, static_cast<uInt>(input.size()));
+
+    z_stream zs {};
+    // negative window bits to write a raw deflate stream as expected by zip
+    const int memLevel = 8;
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, memLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("Failed to initialize deflate stream");
+    }
+    entry.data.resize(deflateBound(&zs, static_cast<uLong>(input.size())));
+    zs.next_in = const_cast<Bytef*>(next);  // NOLINT
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = reinterpret_cast<Bytef*>(&entry.data[0]);  // NOLINT
+    zs.avail_out = static_cast<uInt>(entry.data.size());
+    int err = deflate(&zs, Z_FINISH);
+    entry.data.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (err != Z_STREAM_END) {
+        throw Base::RuntimeError("Failed to deflate " + entry.name);
+    }
+    return entry;
+}
+}  // namespace
+
+std::string ZipWriter::addSharedFile(const char* Name, const Base::Persistence* Object)
+{
+    if (!getMode("DeduplicateFiles")) {
+        return addFile(Name, Object);
+    }
+
+    FileEntry entry;
+    entry.FileName = Name ? Name : "";
+    entry.Object = Object;
+    bool differs = false;
+    std::string data = serializeFile(entry, &differs);
+
+    // an equal hash is only a candidate, the content must be identical
+    std::size_t hash = std::hash<std::string>()(data);
+    auto range = SharedHashes.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto shared = SharedData.find(it->second);
+        if (shared == SharedData.end() || shared->second.size != data.size()) {
+            continue;
+        }
+        std::string other;
+        if (readSharedData(it->second, other) && other == data) {
+            shared->second.shared = true;
+            return it->second;
+        }
+    }
+
+    std::string fileName = addFile(Name, Object);
+    SharedHashes.emplace(hash, fileName);
+    writeSharedData(fileName, data, differs);
+    return fileName;
+}
+
+void ZipWriter::writeSharedData(const std::string& fileName,
+                                const std::string& data,
+                                bool differs)
+{
+    // the content is parked in a temporary file, so that only its position is kept in memory
+    if (!SharedStream) {
+        SharedFileName = FileInfo::getTempFileName("SharedFiles");
+        FileInfo fi(SharedFileName);
+        auto mode = std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc;
+#ifdef _MSC_VER
+        SharedStream = std::make_unique<std::fstream>(fi.toStdWString().c_str(), mode);
+#else
+        SharedStream = std::make_unique<std::fstream>(fi.filePath().c_str(), mode);
+#endif
+        if (!*SharedStream) {
+            throw Base::FileException("Failed to create temporary file", fi);
+        }
+    }
+
+    SharedStream->seekp(0, std::ios::end);
+    SharedEntry entry;
+    entry.offset = SharedStream->tellp();
+    entry.size = data.size();
+    entry.differs = differs;
+    SharedStream->write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!*SharedStream) {
+        throw Base::FileException("Failed to write temporary file", SharedFileName.c_str());
+    }
+    SharedData[fileName] = entry;
+}
+
+bool ZipWriter::readSharedData(const std::string& fileName, std::string& data)
+{
+    auto shared = SharedData.find(fileName);
+    if (shared == SharedData.end()) {
+        return false;
+    }
+    data.resize(shared->second.size);
+    SharedStream->seekg(shared->second.offset);
+    SharedStream->read(&data[0], static_cast<std::streamsize>(data.size()));
+    if (!*SharedStream) {
+        throw Base::FileException("Failed to read temporary file", SharedFileName.c_str());
+    }
+    return true;
+}
+
+bool ZipWriter::takeSharedData(const std::string& fileName, std::string& data)
+{
+    auto shared = SharedData.find(fileName);
+    if (shared == SharedData.end()) {
+        return false;
+    }
+    // a file that no other object refers to is written in full
+    bool use = shared->second.shared || !shared->second.differs;
+    if (use) {
+        readSharedData(fileName, data);
+    }
+    SharedData.erase(shared);
+    return use;
+}
+
+std::string ZipWriter::serializeFile(const FileEntry& entry, bool* differs)
+{
+    // serialize into a buffer set up the same way as the zip stream, this may be
+    // called while another entry is being written so its state is restored afterwards.
+    // If differs is given, the content shared with other objects is serialized.
+    auto stream = std::make_unique<std::ostringstream>();
+    stream->imbue(ZipStream.getloc());
+    stream->precision(ZipStream.precision());
+    stream->flags(ZipStream.flags());
+    std::swap(stream, EntryStream);
+    std::string objectName = ObjectName;
+    short oldIndent = indent;
+
+    auto restore = [&]() {
+        std::swap(stream, EntryStream);
+        ObjectName = objectName;
+        indent = oldIndent;
+        std::fill_n(indBuf, indent, ' ');
+        indBuf[indent] = 0;
+    };
+
+    Writer::putNextEntry(entry.FileName.c_str());
+    indent = 0;
+    indBuf[0] = 0;
+    try {
+        if (differs) {
+            *differs = entry.Object->SaveSharedDocFile(*this);
+        }
+        else {
+            entry.Object->SaveDocFile(*this);
+        }
+    }
+    catch (...) {
+        restore();
+        throw;
+    }
+
+    restore();
+    return stream->str();
+}
+
+void ZipWriter::writeFilesParallel()
+{
+    WorkerPool pool(static_cast<std::size_t>(ThreadCount));
+    std::deque<std::future<DeflatedEntry>> pending;
+    auto flush = [&](std::size_t keep) {
+        while (pending.size() > keep) {
+            DeflatedEntry entry = pending.front().get();
+            pending.pop_front();
+            ZipStream.putRawEntry(zipios::ZipCDirEntry(entry.name),
+                                  entry.data.data(),
+                                  static_cast<uint32_t>(entry.data.size()),
+                                  entry.size,
+                                  entry.crc);
+        }
+    };
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        std::string data;
+        if (!takeSharedData(entry.FileName, data)) {
+            data = serializeFile(entry);
+        }
+
+        pending.push_back(
+            pool.submit([name = entry.FileName, data = std::move(data), level = Level]() {
+                return deflateEntry(name, data, level);
+            }));
+        // bound the number of buffered entries
+        flush(static_cast<std::size_t>(ThreadCount));
+        index++;
+    }
+    flush(0);
+}
+
 void ZipWriter::writeFiles()
 {
+    if (ThreadCount > 1) {
+        writeFilesParallel();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -368,7 +596,13 @@ void ZipWriter::writeFiles()
         putNextEntry(entry.FileName.c_str());
         indent = 0;
         indBuf[0] = 0;
-        entry.Object->SaveDocFile(*this);
+        std::string data;
+        if (takeSharedData(entry.FileName, data)) {
+            ZipStream.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+        else {
+            entry.Object->SaveDocFile(*this);
+        }
         index++;
     }
 }
@@ -376,6 +610,10 @@ void ZipWriter::writeFiles()
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
+    if (SharedStream) {
+        SharedStream.reset();
+        FileInfo(SharedFileName).deleteFile();
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -24,9 +24,12 @@
 #define BASE_WRITER_H
 
 
+#include <fstream>
+#include <map>
 #include <set>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 #include <cassert>
 #include <memory>
@@ -82,6 +85,13 @@ public:
     //@{
     /// add a write request of a persistent object
     std::string addFile(const char* Name, const Base::Persistence* Object);
+    /** add a write request of a persistent object whose file may be identical to others
+     * Writers that support it store files with the same content only once and return
+     * the name of the file that was added first. The default implementation is the
+     * same as addFile().
+     * \see Persistence::SaveSharedDocFile(), Persistence::RestoreSharedDocFile()
+     */
+    virtual std::string addSharedFile(const char* Name, const Base::Persistence* Object);
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// get all registered file names
@@ -195,9 +205,20 @@ public:
     ~ZipWriter() override;
 
     void writeFiles() override;
+    /** If the mode "DeduplicateFiles" is set, the object is serialized immediately
+     * by Persistence::SaveSharedDocFile() and the content is compared with the files
+     * added before by this method. The content of unique files is kept in a temporary
+     * file until writeFiles() is called, so that only its size and offset stay in memory.
+     * A file that only one object refers to is written by SaveDocFile() if its shared
+     * content differs.
+     */
+    std::string addSharedFile(const char* Name, const Base::Persistence* Object) override;
 
     std::ostream& Stream() override
     {
+        if (EntryStream) {
+            return *EntryStream;
+        }
         return ZipStream;
     }
 
@@ -207,8 +228,18 @@ public:
     }
     void setLevel(int level)
     {
+        Level = level;
         ZipStream.setLevel(level);
     }
+    /** Set the number of threads used to deflate the file entries in writeFiles()
+     * If greater than one, each entry is first serialized into a memory buffer
+     * which is then deflated on a worker thread while the next entry is being
+     * serialized. Entries are still appended to the archive in order.
+     */
+    void setThreadCount(int count)
+    {
+        ThreadCount = count;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -216,8 +247,33 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesParallel();
+    std::string serializeFile(const FileEntry& entry, bool* differs = nullptr);
+    void writeSharedData(const std::string& fileName, const std::string& data, bool differs);
+    bool readSharedData(const std::string& fileName, std::string& data);
+    bool takeSharedData(const std::string& fileName, std::string& data);
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::unique_ptr<std::ostringstream> EntryStream;
+    int Level {6};
+    int ThreadCount {0};
+    struct SharedEntry
+    {
+        std::streamoff offset {0};
+        std::size_t size {0};
+        // the shared content is not the full content of the file
+        bool differs {false};
+        // more than one object refers to the file
+        bool shared {false};
+    };
+    // position of the shared files in the temporary file until they are written,
+    // and the file names by content hash
+    std::map<std::string, SharedEntry> SharedData;
+    std::unordered_multimap<std::size_t, std::string> SharedHashes;
+    std::unique_ptr<std::fstream> SharedStream;
+    std::string SharedFileName;
 };
 
 /** The StringWriter class
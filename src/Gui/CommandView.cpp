@@ -2977,6 +2977,7 @@ static void doSelect(void* ud, SoEventCallback * cb)
             Gui::Selection().clearSelection(doc->getName());
         }
 
+        std::vector<App::SubObjectT> sels;
         const std::vector<App::DocumentObject*> objects = doc->getObjects();
         for(auto obj : objects) {
             if(App::GeoFeatureGroupExtension::getGroupOfObject(obj))
@@ -2988,8 +2989,11 @@ static void doSelect(void* ud, SoEventCallback * cb)
 
             Base::Matrix4D mat;
             for(auto &sub : getBoxSelection(vp,selectionMode,selectElement,proj,polygon,mat))
-                Gui::Selection().addSelection(doc->getName(), obj->getNameInDocument(), sub.c_str());
+                sels.emplace_back(obj, sub.c_str());
         }
+
+        // add all elements at once to only notify the observers once
+        Gui::Selection().addSelections(sels);
     }
 }
 
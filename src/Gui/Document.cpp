@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cctype>
 # include <mutex>
 # include <QApplication>
@@ -507,6 +508,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // set the memory limit of the undo stack in MB (0 = no limit)
+        std::size_t undoMemory = hGrp->GetUnsigned("MaxUndoMemory", 0);
+        d->_pcDocument->setUndoLimit(undoMemory * 1024 * 1024);
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -1577,9 +1581,9 @@ bool Document::saveCopy()
     }
 }
 
-unsigned int Document::getMemSize () const
+std::size_t Document::getMemSize () const
 {
-    unsigned int size = 0;
+    std::size_t size = 0;
 
     // size of the view providers in the document
     std::map<const App::DocumentObject*,ViewProviderDocumentObject*>::const_iterator it;
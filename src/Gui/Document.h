@@ -142,7 +142,7 @@ public:
 
     /** @name I/O of the document */
     //@{
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     /// Save the document
     bool save();
     /// Save the document under a new file name
@@ -1924,7 +1924,7 @@ QMimeData * MainWindow::createMimeDataFromSelection () const
         return nullptr;
     }
 
-    unsigned int memsize=1000; // ~ for the meta-information
+    std::size_t memsize=1000; // ~ for the meta-information
     for (const auto & it : sel)
         memsize += it->getMemSize();
 
@@ -1933,7 +1933,7 @@ QMimeData * MainWindow::createMimeDataFromSelection () const
     QByteArray res;
     if(use_buffer) {
         try {
-            res.reserve(memsize);
+            res.reserve(static_cast<int>(memsize));
         }
         catch (const std::bad_alloc &) {
             use_buffer = false;
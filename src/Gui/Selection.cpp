@@ -24,7 +24,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <array>
+# include <cstring>
 # include <boost/algorithm/string/predicate.hpp>
 # include <QApplication>
 #endif
@@ -575,6 +577,7 @@ void SelectionSingleton::slotSelectionChanged(const SelectionChanges& msg)
 
         try {
             msg2.pOriginalMsg = &msg;
+            msg2.Batched = msg.Batched;
             signalSelectionChanged3(msg2);
 
             msg2.Object.setSubName(oldElementName.c_str());
@@ -950,7 +953,7 @@ bool SelectionSingleton::addSelection(const char* pDocName, const char* pObjectN
     if(!logDisabled)
         temp.log(false,clearPreselect);
 
-    _SelList.push_back(temp);
+    selListAppend(temp);
     _SelStackForward.clear();
 
     if(clearPreselect)
@@ -1114,7 +1117,7 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
         temp.y        = 0;
         temp.z        = 0;
 
-        _SelList.push_back(temp);
+        selListAppend(temp);
         _SelStackForward.clear();
 
         SelectionChanges Chng(SelectionChanges::AddSelection,
@@ -1131,6 +1134,65 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
     return true;
 }
 
+int SelectionSingleton::addSelections(const std::vector<App::SubObjectT>& objs)
+{
+    if(!_PickedList.empty()) {
+        _PickedList.clear();
+        notify(SelectionChanges(SelectionChanges::PickedListChanged));
+    }
+
+    std::vector<SelectionChanges> changes;
+    std::vector<std::string> docNames;
+    for(const auto &objT : objs) {
+        _SelObj temp;
+        int ret = checkSelection(objT.getDocumentName().c_str(), objT.getObjectName().c_str(),
+                                 objT.getSubName().c_str(), ResolveMode::NoResolve, temp);
+        if (ret!=0)
+            continue;
+
+        // check for a Selection Gate
+        if (ActiveGate) {
+            const char *subelement = nullptr;
+            auto pObject = getObjectOfType(temp,App::DocumentObject::getClassTypeId(),gateResolve,&subelement);
+            if (!ActiveGate->allow(pObject?pObject->getDocument():temp.pDoc,pObject,subelement)) {
+                ActiveGate->notAllowedReason.clear();
+                continue;
+            }
+        }
+
+        if(!logDisabled)
+            temp.log();
+
+        if(std::find(docNames.begin(), docNames.end(), temp.DocName) == docNames.end())
+            docNames.push_back(temp.DocName);
+        selListAppend(temp);
+
+        changes.emplace_back(SelectionChanges::AddSelection,
+                temp.DocName,temp.FeatName,temp.SubName,temp.TypeName);
+        changes.back().Batched = true;
+    }
+
+    if(changes.empty())
+        return 0;
+
+    _SelStackForward.clear();
+    rmvPreselect();
+
+    int count = static_cast<int>(changes.size());
+    for(auto &Chng : changes) {
+        FC_LOG("Add Selection "<<Chng.pDocName<<'#'<<Chng.pObjectName<<'.'<<Chng.pSubName);
+        notify(std::move(Chng));
+    }
+
+    for(const auto &docName : docNames) {
+        FC_LOG("Set Selection " << docName);
+        notify(SelectionChanges(SelectionChanges::SetSelection, docName.c_str()));
+    }
+
+    getMainWindow()->updateActions();
+    return count;
+}
+
 bool SelectionSingleton::updateSelection(bool show, const char* pDocName,
                             const char* pObjectName, const char* pSubName)
 {
@@ -1241,7 +1303,7 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
                 It->DocName,It->FeatName,It->SubName,It->TypeName);
 
         // destroy the _SelObj item
-        _SelList.erase(It);
+        selListErase(It);
     }
 
     // NOTE: It can happen that there are nested calls of rmvSelection()
@@ -1379,7 +1441,7 @@ void SelectionSingleton::setSelection(const char* pDocName, const std::vector<Ap
         if (ret!=0)
             continue;
         touched = true;
-        _SelList.push_back(temp);
+        selListAppend(temp);
     }
 
     if(touched) {
@@ -1415,7 +1477,7 @@ void SelectionSingleton::clearSelection(const char* pDocName, bool clearPreSelec
         for (auto it=_SelList.begin();it!=_SelList.end();) {
             if (it->DocName == docName) {
                 touched = true;
-                it = _SelList.erase(it);
+                it = selListErase(it);
             }
             else {
                 ++it;
@@ -1458,7 +1520,7 @@ void SelectionSingleton::clearCompleteSelection(bool clearPreSelect)
                 clearPreSelect?"Gui.Selection.clearSelection()"
                               :"Gui.Selection.clearSelection(False)");
 
-    _SelList.clear();
+    selListClear();
 
     SelectionChanges Chng(SelectionChanges::ClrSelection);
 
@@ -1541,15 +1603,23 @@ int SelectionSingleton::checkSelection(const char *pDocName, const char *pObject
     if(!pSubName)
         pSubName = "";
 
-    for (auto &s : *selList) {
-        if (s.DocName==pDocName && s.FeatName==sel.FeatName) {
-            if(s.SubName==pSubName)
-                return 1;
-            if (resolve > ResolveMode::OldStyleElement && boost::starts_with(s.SubName,prefix))
-                return 1;
+    // for the current selection use the index to avoid scanning the whole list
+    bool indexed = selList == &_SelList;
+    if (indexed && _SelIndex.count(selIndexKey(sel.DocName, sel.FeatName, pSubName)) > 0)
+        return 1;
+
+    if (!indexed || (resolve > ResolveMode::OldStyleElement && _SelObjects.count(sel.pObject) > 0)) {
+        for (auto &s : *selList) {
+            if (s.DocName==pDocName && s.FeatName==sel.FeatName) {
+                if(s.SubName==pSubName)
+                    return 1;
+                if (resolve > ResolveMode::OldStyleElement && boost::starts_with(s.SubName,prefix))
+                    return 1;
+            }
         }
     }
-    if (resolve == ResolveMode::OldStyleElement) {
+    if (resolve == ResolveMode::OldStyleElement
+        && (!indexed || _SelResolvedObjects.count(sel.pResolvedObject) > 0)) {
         for(auto &s : *selList) {
             if(s.pResolvedObject != sel.pResolvedObject)
                 continue;
@@ -1566,6 +1636,53 @@ int SelectionSingleton::checkSelection(const char *pDocName, const char *pObject
     return 0;
 }
 
+std::string SelectionSingleton::selIndexKey(const std::string& docName, const std::string& objName,
+                                            const char* subName)
+{
+    std::string key;
+    key.reserve(docName.size() + objName.size() + (subName ? strlen(subName) : 0) + 2);
+    key += docName;
+    key += '#';
+    key += objName;
+    key += '.';
+    if (subName)
+        key += subName;
+    return key;
+}
+
+void SelectionSingleton::selListAppend(const _SelObj& sel)
+{
+    auto it = _SelList.insert(_SelList.end(), sel);
+    _SelIndex[selIndexKey(sel.DocName, sel.FeatName, sel.SubName.c_str())] = it;
+    ++_SelObjects[sel.pObject];
+    ++_SelResolvedObjects[sel.pResolvedObject];
+}
+
+std::list<SelectionSingleton::_SelObj>::iterator SelectionSingleton::selListErase(std::list<_SelObj>::iterator it)
+{
+    auto decrement = [](std::unordered_map<const App::DocumentObject*, int>& counts,
+                        const App::DocumentObject* obj) {
+        auto jt = counts.find(obj);
+        if (jt != counts.end() && --jt->second <= 0)
+            counts.erase(jt);
+    };
+
+    auto jt = _SelIndex.find(selIndexKey(it->DocName, it->FeatName, it->SubName.c_str()));
+    if (jt != _SelIndex.end() && jt->second == it)
+        _SelIndex.erase(jt);
+    decrement(_SelObjects, it->pObject);
+    decrement(_SelResolvedObjects, it->pResolvedObject);
+    return _SelList.erase(it);
+}
+
+void SelectionSingleton::selListClear()
+{
+    _SelList.clear();
+    _SelIndex.clear();
+    _SelObjects.clear();
+    _SelResolvedObjects.clear();
+}
+
 const char *SelectionSingleton::getSelectedElement(App::DocumentObject *obj, const char* pSubName) const
 {
     if (!obj)
@@ -1601,7 +1718,7 @@ void SelectionSingleton::slotDeletedObject(const App::DocumentObject& Obj)
         if(it->pResolvedObject == &Obj || it->pObject==&Obj) {
             changes.emplace_back(SelectionChanges::RmvSelection,
                     it->DocName,it->FeatName,it->SubName,it->TypeName);
-            _SelList.erase(it);
+            selListErase(it);
         }
     }
     if(!changes.empty()) {
@@ -1956,11 +2073,20 @@ PyObject *SelectionSingleton::sAddSelection(PyObject * /*self*/, PyObject *args)
         try {
             if (PyTuple_Check(sequence) || PyList_Check(sequence)) {
                 Py::Sequence list(sequence);
+                std::vector<App::SubObjectT> sels;
                 for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
                     std::string subname = static_cast<std::string>(Py::String(*it));
-                    Selection().addSelection(docObj->getDocument()->getName(),
-                                             docObj->getNameInDocument(),
-                                             subname.c_str(), 0, 0, 0, nullptr, Base::asBoolean(clearPreselect));
+                    sels.emplace_back(docObj, subname.c_str());
+                }
+                if (Base::asBoolean(clearPreselect)) {
+                    Selection().addSelections(sels);
+                }
+                else {
+                    for (const auto& sel : sels) {
+                        Selection().addSelection(sel.getDocumentName().c_str(),
+                                                 sel.getObjectName().c_str(),
+                                                 sel.getSubName().c_str(), 0, 0, 0, nullptr, false);
+                    }
                 }
                 Py_Return;
             }
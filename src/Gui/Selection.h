@@ -27,6 +27,7 @@
 #include <deque>
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <App/DocumentObject.h>
@@ -144,6 +145,7 @@ public:
         pSubName = Object.getSubName().c_str();
         pTypeName = TypeName.c_str();
         pOriginalMsg = other.pOriginalMsg;
+        Batched = other.Batched;
         return *this;
     }
 
@@ -164,6 +166,7 @@ public:
         pSubName = Object.getSubName().c_str();
         pTypeName = TypeName.c_str();
         pOriginalMsg = other.pOriginalMsg;
+        Batched = other.Batched;
         return *this;
     }
 
@@ -183,6 +186,13 @@ public:
 
     // Original selection message in case resolve!=0
     const SelectionChanges *pOriginalMsg = nullptr;
+
+    /** True for the AddSelection messages of a batch
+     * The batch is followed by a SetSelection message for each affected
+     * document. Observers that update from the whole selection on SetSelection
+     * may ignore these messages.
+     */
+    bool Batched = false;
 };
 
 } //namespace Gui
@@ -343,6 +353,12 @@ public:
     bool addSelection(const SelectionObject&, bool clearPreSelect=true);
     /// Add to selection with several sub-elements
     bool addSelections(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames);
+    /** Add many (sub-)objects to the selection at once
+     * Sends one AddSelection per element with SelectionChanges::Batched set,
+     * followed by one SetSelection per affected document. Returns the number
+     * of added elements.
+     */
+    int addSelections(const std::vector<App::SubObjectT>& objs);
     /// Update a selection
     bool updateSelection(bool show, const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr);
     /// Remove from selection (for internal use)
@@ -692,6 +708,17 @@ protected:
         void log(bool remove=false, bool clearPreselect=true);
     };
     mutable std::list<_SelObj> _SelList;
+    // hashed index of _SelList by document, object and sub-element name
+    std::unordered_map<std::string, std::list<_SelObj>::iterator> _SelIndex;
+    // number of entries of _SelList per object and per resolved object
+    std::unordered_map<const App::DocumentObject*, int> _SelObjects;
+    std::unordered_map<const App::DocumentObject*, int> _SelResolvedObjects;
+
+    void selListAppend(const _SelObj& sel);
+    std::list<_SelObj>::iterator selListErase(std::list<_SelObj>::iterator it);
+    void selListClear();
+    static std::string selIndexKey(const std::string& docName, const std::string& objName,
+                                   const char* subName);
 
     mutable std::list<_SelObj> _PickedList;
     bool _needPickedList{false};
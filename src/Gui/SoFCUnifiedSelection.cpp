@@ -23,6 +23,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <map>
 # include <Inventor/SoFullPath.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/actions/SoCallbackAction.h>
@@ -310,6 +312,47 @@ SoFCUnifiedSelection::getPickedList(SoHandleEventAction* action, bool singlePick
     return ret;
 }
 
+void SoFCUnifiedSelection::setElementSelection(ViewProvider *vp, App::DocumentObject *obj,
+                                               const char *subName, bool add)
+{
+    SoDetail *detail = nullptr;
+    detailPath->truncate(0);
+    const char *element = subName;
+    App::ElementNamePair elementName;
+    App::GeoFeature::resolveElement(obj, subName, elementName);
+    if (Data::isMappedElement(element)
+        && !elementName.oldName.empty()) {      // If we have a shortened element name
+        element = elementName.oldName.c_str();  // use it.
+    }
+    if(!subName || !subName[0] ||
+        vp->getDetailPath(element,detailPath,true,detail))
+    {
+        SoSelectionElementAction::Type type = SoSelectionElementAction::None;
+        if (add) {
+            if (detail)
+                type = SoSelectionElementAction::Append;
+            else
+                type = SoSelectionElementAction::All;
+        }
+        else {
+            if (detail)
+                type = SoSelectionElementAction::Remove;
+            else
+                type = SoSelectionElementAction::None;
+        }
+
+        SoSelectionElementAction selectionAction(type);
+        selectionAction.setColor(this->colorSelection.getValue());
+        selectionAction.setElement(detail);
+        if(detailPath->getLength())
+            selectionAction.apply(detailPath);
+        else
+            selectionAction.apply(vp->getRoot());
+    }
+    detailPath->truncate(0);
+    delete detail;
+}
+
 void SoFCUnifiedSelection::doAction(SoAction *action)
 {
     if (action->getTypeId() == SoFCEnableHighlightAction::getClassTypeId()) {
@@ -396,42 +439,8 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
             App::DocumentObject* obj = doc->getObject(selaction->SelChange.pObjectName);
             ViewProvider*vp = Application::Instance->getViewProvider(obj);
             if (vp && (useNewSelection.getValue()||vp->useNewSelectionModel()) && vp->isSelectable()) {
-                SoDetail *detail = nullptr;
-                detailPath->truncate(0);
-                auto subName = selaction->SelChange.pSubName;
-                App::ElementNamePair elementName;;
-                App::GeoFeature::resolveElement(obj, subName, elementName);
-                if (Data::isMappedElement(subName)
-                    && !elementName.oldName.empty()) {      // If we have a shortened element name
-                    subName = elementName.oldName.c_str();  // use it.
-                }
-                if(!selaction->SelChange.pSubName || !selaction->SelChange.pSubName[0] ||
-                    vp->getDetailPath(subName,detailPath,true,detail))
-                {
-                    SoSelectionElementAction::Type type = SoSelectionElementAction::None;
-                    if (selaction->SelChange.Type == SelectionChanges::AddSelection) {
-                        if (detail)
-                            type = SoSelectionElementAction::Append;
-                        else
-                            type = SoSelectionElementAction::All;
-                    }
-                    else {
-                        if (detail)
-                            type = SoSelectionElementAction::Remove;
-                        else
-                            type = SoSelectionElementAction::None;
-                    }
-
-                    SoSelectionElementAction selectionAction(type);
-                    selectionAction.setColor(this->colorSelection.getValue());
-                    selectionAction.setElement(detail);
-                    if(detailPath->getLength())
-                        selectionAction.apply(detailPath);
-                    else
-                        selectionAction.apply(vp->getRoot());
-                }
-                detailPath->truncate(0);
-                delete detail;
+                setElementSelection(vp, obj, selaction->SelChange.pSubName,
+                        selaction->SelChange.Type == SelectionChanges::AddSelection);
             }
         }
         else if (selaction->SelChange.Type == SelectionChanges::ClrSelection) {
@@ -442,20 +451,31 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
         else if(selectionMode.getValue() == ON
                     && selaction->SelChange.Type == SelectionChanges::SetSelection) {
             std::vector<ViewProvider*> vps;
-            if (this->pcDocument)
+            // the selected sub-elements of each object, an empty name means the whole object
+            std::map<App::DocumentObject*, std::vector<const char*>> selected;
+            if (this->pcDocument) {
                 vps = this->pcDocument->getViewProvidersOfType(ViewProviderDocumentObject::getClassTypeId());
+                const char* docName = this->pcDocument->getDocument()->getName();
+                for (const auto& sel : Selection().getSelection(docName, ResolveMode::NoResolve))
+                    selected[sel.pObject].push_back(sel.SubName);
+            }
             for (const auto & vp : vps) {
                 auto vpd = static_cast<ViewProviderDocumentObject*>(vp);
                 if (useNewSelection.getValue() || vpd->useNewSelectionModel()) {
-                    SoSelectionElementAction::Type type;
-                    if(Selection().isSelected(vpd->getObject()) && vpd->isSelectable())
-                        type = SoSelectionElementAction::All;
-                    else
-                        type = SoSelectionElementAction::None;
+                    auto it = selected.find(vpd->getObject());
+                    bool isSelected = it != selected.end() && vpd->isSelectable();
+                    bool whole = isSelected && std::any_of(it->second.begin(), it->second.end(),
+                            [](const char* sub) { return !sub || !sub[0]; });
 
-                    SoSelectionElementAction selectionAction(type);
+                    SoSelectionElementAction selectionAction(whole ? SoSelectionElementAction::All
+                                                                   : SoSelectionElementAction::None);
                     selectionAction.setColor(this->colorSelection.getValue());
                     selectionAction.apply(vpd->getRoot());
+
+                    if (isSelected && !whole) {
+                        for (const char* sub : it->second)
+                            setElementSelection(vpd, vpd->getObject(), sub, true);
+                    }
                 }
             }
         }
@@ -41,6 +41,9 @@ class SoFullPath;
 class SoPickedPoint;
 class SoDetail;
 
+namespace App {
+class DocumentObject;
+}
 
 namespace Gui {
 
@@ -113,6 +116,7 @@ private:
     bool setHighlight(SoFullPath *path, const SoDetail *det,
             ViewProviderDocumentObject *vpd, const char *element, float x, float y, float z);
     bool setSelection(const std::vector<PickedInfo> &, bool ctrlDown=false);
+    void setElementSelection(ViewProvider *vp, App::DocumentObject *obj, const char *subName, bool add);
 
     std::vector<PickedInfo> getPickedList(SoHandleEventAction* action, bool singlePick) const;
 
@@ -63,7 +63,7 @@ void Thumbnail::setFileName(const char* fn)
     this->uri = QUrl::fromLocalFile(QString::fromUtf8(fn));
 }
 
-unsigned int Thumbnail::getMemSize () const
+std::size_t Thumbnail::getMemSize () const
 {
     return 0;
 }
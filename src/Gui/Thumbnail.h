@@ -44,7 +44,7 @@ public:
 
     /** @name I/O of the document */
     //@{
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     /// This method is used to save properties or very small amounts of data to an XML document.
     void Save (Base::Writer &writer) const override;
     /// This method is used to restore properties from an XML document.
@@ -3023,18 +3023,19 @@ void TreeWidget::onUpdateStatus()
         auto docItem = getDocumentItem(gdoc);
         if (!docItem)
             continue;
+        std::vector<ViewProviderDocumentObject*> vps;
+        vps.reserve(v.second.size());
         for (auto id : v.second) {
             auto obj = doc->getObjectByID(id);
             if (!obj)
                 continue;
             if (obj->isError())
                 errors.push_back(obj);
-            if (docItem->ObjectMap.count(obj))
-                continue;
             auto vpd = Base::freecad_dynamic_cast<ViewProviderDocumentObject>(gdoc->getViewProvider(obj));
             if (vpd)
-                docItem->createNewItem(*vpd);
+                vps.push_back(vpd);
         }
+        docItem->createNewItems(vps);
     }
 
     // Use a local copy in case of nested calls
@@ -3240,6 +3241,11 @@ void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
         auto objItem = static_cast<DocumentObjectItem*>(item);
         objItem->setExpandedStatus(true);
         objItem->getOwnerDocument()->populateItem(objItem, false, false);
+        objItem->getOwnerDocument()->testItemStatus(objItem);
+    }
+    else if (item && item->type() == TreeWidget::DocumentType) {
+        auto docItem = static_cast<DocumentItem*>(item);
+        docItem->testItemStatus(docItem);
     }
 }
 
@@ -3881,25 +3887,12 @@ bool DocumentItem::createNewItem(const Gui::ViewProviderDocumentObject& obj,
         return false;
 
     if (!data) {
-        auto& pdata = ObjectMap[obj.getObject()];
-        if (!pdata) {
-            pdata = std::make_shared<DocumentObjectData>(
-                this, const_cast<ViewProviderDocumentObject*>(&obj));
-            auto& entry = getTree()->ObjectTable[obj.getObject()];
-            if (!entry.empty())
-                pdata->updateChildren(*entry.begin());
-            else
-                pdata->updateChildren(true);
-            entry.insert(pdata);
-        }
-        else if (pdata->rootItem && !parent) {
-            Base::Console().Warning("DocumentItem::slotNewObject: Cannot add view provider twice.\n");
+        data = newItemData(obj, !parent);
+        if (!data)
             return false;
-        }
-        data = pdata;
     }
 
-    auto item = new DocumentObjectItem(this, data);
+    auto item = newItem(data);
     if (!parent || parent == this) {
         parent = this;
         data->rootItem = item;
@@ -3911,16 +3904,102 @@ bool DocumentItem::createNewItem(const Gui::ViewProviderDocumentObject& obj,
     else
         parent->insertChild(index, item);
     assert(item->parent() == parent);
+    initNewItem(item);
+    return true;
+}
+
+void DocumentItem::createNewItems(const std::vector<Gui::ViewProviderDocumentObject*>& vps)
+{
+    // Each added root item makes the tree widget update its rows, which takes minutes
+    // when a document with 100k objects is loaded. Consecutive items that go to the end
+    // of the root level are therefore created detached and added with one call.
+    QList<QTreeWidgetItem*> batch;
+    int batchRank = 0;
+    // same as in findRootIndex(), which does not set it if the root level is empty
+    auto getTreeRank = [](Gui::ViewProviderDocumentObject* vp) -> int {
+        if (vp->getTreeRank() == -1) {
+            vp->setTreeRank(vp->getObject()->getID());
+        }
+        return vp->getTreeRank();
+    };
+    auto flush = [&]() {
+        if (batch.isEmpty())
+            return;
+        addChildren(batch);
+        for (auto item : batch)
+            initNewItem(static_cast<DocumentObjectItem*>(item));
+        batch.clear();
+    };
+
+    for (auto vp : vps) {
+        auto obj = vp->getObject();
+        if (!obj || !obj->isAttachedToDocument() || obj->testStatus(App::PartialObject))
+            continue;
+        // objects that already have items, e.g. below another object
+        if (ObjectMap.count(obj))
+            continue;
+        // An item that goes between existing or batched items is added on its own. The
+        // batch is added first, as populating the item may move root items below it.
+        int index = findRootIndex(obj);
+        bool keepOrder = TreeParams::getKeepRootOrder();
+        if ((index >= 0 && index < childCount())
+            || (keepOrder && !batch.isEmpty() && getTreeRank(vp) < batchRank)) {
+            flush();
+            createNewItem(*vp);
+            continue;
+        }
+        auto data = newItemData(*vp, true);
+        if (!data)
+            continue;
+        auto item = newItem(data);
+        data->rootItem = item;
+        batch.append(item);
+        if (keepOrder)
+            batchRank = getTreeRank(vp);
+    }
+    flush();
+}
+
+DocumentObjectDataPtr DocumentItem::newItemData(const Gui::ViewProviderDocumentObject& obj,
+                                                bool root)
+{
+    auto& pdata = ObjectMap[obj.getObject()];
+    if (!pdata) {
+        pdata = std::make_shared<DocumentObjectData>(
+            this, const_cast<ViewProviderDocumentObject*>(&obj));
+        auto& entry = getTree()->ObjectTable[obj.getObject()];
+        if (!entry.empty())
+            pdata->updateChildren(*entry.begin());
+        else
+            pdata->updateChildren(true);
+        entry.insert(pdata);
+    }
+    else if (pdata->rootItem && root) {
+        Base::Console().Warning("DocumentItem::slotNewObject: Cannot add view provider twice.\n");
+        return {};
+    }
+    return pdata;
+}
+
+DocumentObjectItem* DocumentItem::newItem(const DocumentObjectDataPtr& data)
+{
+    // the texts are set before the item is added, so that the view is not notified
+    auto item = new DocumentObjectItem(this, data);
     item->setText(0, QString::fromUtf8(data->label.c_str()));
     if (!data->label2.empty())
         item->setText(1, QString::fromUtf8(data->label2.c_str()));
     item->setText(2, QString::fromUtf8(data->internalName.c_str()));
-    if (!obj.showInTree() && !showHidden())
+    return item;
+}
+
+void DocumentItem::initNewItem(DocumentObjectItem* item)
+{
+    // needs the item in the tree, setHidden() is ignored before
+    if (!item->object()->showInTree() && !showHidden())
         item->setHidden(true);
     item->testStatus(true);
 
     populateItem(item);
-    return true;
 }
 
 ViewProviderDocumentObject* DocumentItem::getViewProvider(App::DocumentObject* obj) {
@@ -4484,7 +4563,7 @@ static unsigned int countExpandedItem(const QTreeWidgetItem* item) {
     return size;
 }
 
-unsigned int DocumentItem::getMemSize() const {
+std::size_t DocumentItem::getMemSize() const {
     return countExpandedItem(this);
 }
 
@@ -4673,8 +4752,31 @@ Gui::Document* DocumentItem::document() const
 
 void DocumentItem::testStatus()
 {
-    for (const auto& v : ObjectMap)
-        v.second->testStatus();
+    // Only the items that can be seen are checked. Items in collapsed branches
+    // are checked once their parent gets expanded, see TreeWidget::onItemExpanded().
+    if (isExpanded())
+        testItemStatus(this);
+}
+
+void DocumentItem::testItemStatus(QTreeWidgetItem* parent)
+{
+    StatusIcons icons;
+    testItemStatus(parent, icons);
+}
+
+void DocumentItem::testItemStatus(QTreeWidgetItem* parent, StatusIcons& icons)
+{
+    for (int i = 0, count = parent->childCount(); i < count; ++i) {
+        auto child = parent->child(i);
+        if (child->type() != TreeWidget::ObjectType)
+            continue;
+        auto item = static_cast<DocumentObjectItem*>(child);
+        // the items of an object, e.g. below several links, only compute its icon once
+        auto& icon = icons[item->myData.get()];
+        item->testStatus(false, icon.first, icon.second);
+        if (item->isExpanded())
+            testItemStatus(item, icons);
+    }
 }
 
 void DocumentItem::setData(int column, int role, const QVariant& value)
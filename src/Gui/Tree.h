@@ -327,7 +327,7 @@ public:
 
     bool isObjectShowable(App::DocumentObject *obj);
 
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     void Save (Base::Writer &) const override;
     void Restore(Base::XMLReader &) override;
 
@@ -357,6 +357,11 @@ protected:
     bool createNewItem(const Gui::ViewProviderDocumentObject&,
                     QTreeWidgetItem *parent=nullptr, int index=-1,
                     DocumentObjectDataPtr ptrs = DocumentObjectDataPtr());
+    /// Create the root items of new objects, consecutive ones at the end are added at once
+    void createNewItems(const std::vector<Gui::ViewProviderDocumentObject*> &vps);
+    DocumentObjectDataPtr newItemData(const Gui::ViewProviderDocumentObject&, bool root);
+    DocumentObjectItem *newItem(const DocumentObjectDataPtr &data);
+    void initNewItem(DocumentObjectItem *item);
 
     int findRootIndex(App::DocumentObject *childObj);
 
@@ -371,6 +376,12 @@ protected:
     using ViewParentMap = std::unordered_map<const ViewProvider *, std::vector<ViewProviderDocumentObject*> >;
     void populateParents(const ViewProvider *vp, ViewParentMap &);
 
+    /// Check the status of the object items below \a parent that are not in a collapsed branch
+    void testItemStatus(QTreeWidgetItem *parent);
+    /// The status icons of an object, shared by all of its items
+    using StatusIcons = std::unordered_map<const DocumentObjectData*, std::pair<QIcon, QIcon> >;
+    void testItemStatus(QTreeWidgetItem *parent, StatusIcons &icons);
+
 private:
     const char *treeName; // for debugging purpose
     Gui::Document* pDocument;
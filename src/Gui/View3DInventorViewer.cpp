@@ -758,10 +758,15 @@ void View3DInventorViewer::onSelectionChanged(const SelectionChanges & reason)
             break;
         }
         // fall through
+    case SelectionChanges::AddSelection:
+        // the scene is updated by the SetSelection message following the batch
+        if (Reason.Batched) {
+            return;
+        }
+        // fall through
     case SelectionChanges::RmvPreselect:
     case SelectionChanges::RmvPreselectSignal:
     case SelectionChanges::SetSelection:
-    case SelectionChanges::AddSelection:
     case SelectionChanges::RmvSelection:
     case SelectionChanges::ClrSelection:
         inventorSelection->checkGroupOnTop(Reason);
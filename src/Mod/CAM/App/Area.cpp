@@ -26,7 +26,12 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
 #include <cfloat>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #include <boost_geometry.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -171,10 +176,10 @@ CAreaConfig::~CAreaConfig()
 
 TYPESYSTEM_SOURCE(Path::Area, Base::BaseClass)
 
-bool Area::s_aborting;
+std::atomic<bool> Area::s_aborting(false);
 
 Area::Area(const AreaParams* params)
-    : myParams(s_params)
+    : myParams(getDefaultParams())
     , myHaveFace(false)
     , myHaveSolid(false)
     , myShapeDone(false)
@@ -1483,6 +1488,73 @@ static void showShapes(const T& shapes, const char* name, const char* fmt = null
     }
 }
 
+static unsigned sectionThreadCount(std::size_t count)
+{
+    // showShape() adds document objects, so debugging output forces serial processing
+    if (count < 2 || FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+        return 1;
+    }
+    ParameterGrp::handle hGrp =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/CAM");
+    // 0 means one thread per core
+    unsigned threads = static_cast<unsigned>(hGrp->GetUnsigned("AreaSectionThreads", 0));
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned>(std::min<std::size_t>(threads, count));
+}
+
+/** Call func(i) for every section index below count on a pool of threads
+ *
+ * The caller stores the result of each index at its own slot, so the output
+ * does not depend on the scheduling. Exceptions are rethrown in index order
+ * once all threads are done.
+ */
+template<class Func>
+static void forEachSection(std::size_t count, Func func)
+{
+    unsigned threads = sectionThreadCount(count);
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // libarea settings are thread local, start the workers with the caller's
+    CArea::ThreadSettings settings;
+    std::atomic<std::size_t> next(0);
+    std::vector<std::exception_ptr> errors(count);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        pool.emplace_back([&]() {
+            settings.apply();
+            worker();
+        });
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 template<class Func>
 static int foreachSubshape(const TopoDS_Shape& shape,
                            Func func,
@@ -1727,7 +1799,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
         throw Base::ValueError("failed to obtain section plane");
     }
 
-    FC_TIME_INIT2(t, t1);
+    FC_TIME_INIT(t);
 
     TopLoc_Location loc(trsf);
 
@@ -1871,7 +1943,6 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     }
 
     std::vector<shared_ptr<Area>> sections;
-    sections.reserve(heights.size());
 
     std::list<Shape> projectedShapes;
     if (project) {
@@ -1886,7 +1957,11 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // The levels are sliced concurrently. Each one is stored at its own index
+    // and the empty ones are removed afterwards to keep the order of heights.
+    std::vector<shared_ptr<Area>> levels(heights.size());
+    forEachSection(heights.size(), [&](std::size_t i) {
+        FC_TIME_INIT(t1);
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
@@ -1907,7 +1982,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
+                levels[i] = area;
                 break;
             }
 
@@ -1984,7 +2059,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
+                levels[i] = area;
                 FC_TIME_LOG(t1, "makeSection " << z);
                 showShape(area->getShape(), nullptr, "section_%u_final", i);
                 break;
@@ -1999,6 +2074,13 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 retried = true;
             }
         }
+    });
+
+    sections.reserve(levels.size());
+    for (auto& area : levels) {
+        if (area) {
+            sections.push_back(std::move(area));
+        }
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -2212,11 +2294,14 @@ TopoDS_Shape Area::toShape(CArea& area, short fill, int reorient)
             if (_index >= (int)mySections.size())                                                  \
                 return TopoDS_Shape();                                                             \
             if (_index < 0) {                                                                      \
+                std::vector<TopoDS_Shape> shapes(mySections.size());                               \
+                forEachSection(mySections.size(), [&](std::size_t i) {                             \
+                    shapes[i] = mySections[i]->_op(_index, ##__VA_ARGS__);                         \
+                });                                                                                \
                 BRep_Builder builder;                                                              \
                 TopoDS_Compound compound;                                                          \
                 builder.MakeCompound(compound);                                                    \
-                for (shared_ptr<Area> area : mySections) {                                         \
-                    const TopoDS_Shape& s = area->_op(_index, ##__VA_ARGS__);                      \
+                for (const TopoDS_Shape& s : shapes) {                                             \
                     if (s.IsNull())                                                                \
                         continue;                                                                  \
                     builder.Add(compound, s);                                                      \
@@ -3806,16 +3891,21 @@ static inline void addParameter(bool verbose,
     }
 }
 
-static inline void
-addGCode(bool verbose, Toolpath& path, const gp_Pnt& last, const gp_Pnt& next, const char* name)
+static inline Command
+makeGCode(bool verbose, const gp_Pnt& last, const gp_Pnt& next, const char* name)
 {
     Command cmd;
     cmd.Name = name;
     addParameter(verbose, cmd, "X", last.X(), next.X());
     addParameter(verbose, cmd, "Y", last.Y(), next.Y());
     addParameter(verbose, cmd, "Z", last.Z(), next.Z());
-    path.addCommand(cmd);
-    return;
+    return cmd;
+}
+
+static inline void
+addGCode(bool verbose, Toolpath& path, const gp_Pnt& last, const gp_Pnt& next, const char* name)
+{
+    path.addCommand(makeGCode(verbose, last, next, name));
 }
 
 static inline void addG1(bool verbose,
@@ -3825,13 +3915,12 @@ static inline void addG1(bool verbose,
                          double f,
                          double& last_f)
 {
-    addGCode(verbose, path, last, next, "G1");
+    Command cmd = makeGCode(verbose, last, next, "G1");
     if (f > Precision::Confusion()) {
-        Command* cmd = path.getCommands().back();
-        addParameter(verbose, *cmd, "F", last_f, f);
+        addParameter(verbose, cmd, "F", last_f, f);
         last_f = f;
     }
-    return;
+    path.addCommand(cmd);
 }
 
 static void addG0(bool verbose,
@@ -4205,14 +4294,17 @@ AreaStaticParams::AreaStaticParams()
 {}
 
 AreaStaticParams Area::s_params;
+std::mutex Area::s_paramsMutex;
 
 void Area::setDefaultParams(const AreaStaticParams& params)
 {
+    std::lock_guard<std::mutex> lock(s_paramsMutex);
     s_params = params;
 }
 
-const AreaStaticParams& Area::getDefaultParams()
+AreaStaticParams Area::getDefaultParams()
 {
+    std::lock_guard<std::mutex> lock(s_paramsMutex);
     return s_params;
 }
 
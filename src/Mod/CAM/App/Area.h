@@ -23,9 +23,11 @@
 #ifndef PATH_AREA_H
 #define PATH_AREA_H
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <TopoDS.hxx>
@@ -141,8 +143,9 @@ protected:
     bool myProjecting;
     mutable int mySkippedShapes;
 
-    static bool s_aborting;
+    static std::atomic<bool> s_aborting;
     static AreaStaticParams s_params;
+    static std::mutex s_paramsMutex;
 
     /** Called internally to combine children shapes for further processing */
     void build();
@@ -418,7 +421,7 @@ public:
     static bool aborting();
 
     static void setDefaultParams(const AreaStaticParams& params);
-    static const AreaStaticParams& getDefaultParams();
+    static AreaStaticParams getDefaultParams();
 
     static void
     showShape(const TopoDS_Shape& shape, const char* name, const char* fmt = nullptr, ...);
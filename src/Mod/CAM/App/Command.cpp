@@ -97,13 +97,7 @@ bool Command::has(const std::string& attr) const
 std::string Command::toGCode(int precision, bool padzero) const
 {
     std::stringstream str;
-    str.fill('0');
     str << Name;
-    if (precision < 0) {
-        precision = 0;
-    }
-    double scale = std::pow(10.0, precision + 1);
-    std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
     for (std::map<std::string, double>::const_iterator i = Parameters.begin();
          i != Parameters.end();
          ++i) {
@@ -112,33 +106,43 @@ std::string Command::toGCode(int precision, bool padzero) const
         }
 
         str << " " << i->first;
+        writeValue(str, i->second, precision, padzero);
+    }
+    return str.str();
+}
 
-        std::int64_t v = static_cast<std::int64_t>(i->second * scale);
-        if (v < 0) {
-            v = -v;
-            str << '-';  // shall we allow -0 ?
-        }
-        v += 5;
-        v /= 10;
-        str << (v / iscale);
-        if (!precision) {
-            continue;
-        }
+void Command::writeValue(std::ostream& str, double value, int precision, bool padzero)
+{
+    if (precision < 0) {
+        precision = 0;
+    }
+    double scale = std::pow(10.0, precision + 1);
+    std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
 
-        int width = precision;
-        std::int64_t digits = v % iscale;
-        if (!padzero) {
-            if (!digits) {
-                continue;
-            }
-            while (digits % 10 == 0) {
-                digits /= 10;
-                --width;
-            }
+    std::int64_t v = static_cast<std::int64_t>(value * scale);
+    if (v < 0) {
+        v = -v;
+        str << '-';  // shall we allow -0 ?
+    }
+    v += 5;
+    v /= 10;
+    str << (v / iscale);
+    if (!precision) {
+        return;
+    }
+
+    int width = precision;
+    std::int64_t digits = v % iscale;
+    if (!padzero) {
+        if (!digits) {
+            return;
+        }
+        while (digits % 10 == 0) {
+            digits /= 10;
+            --width;
         }
-        str << '.' << std::setw(width) << std::right << digits;
     }
-    return str.str();
+    str << '.' << std::setfill('0') << std::setw(width) << std::right << digits;
 }
 
 void Command::setFromGCode(const std::string& str)
@@ -335,7 +339,7 @@ void Command::scaleBy(double factor)
 
 // Reimplemented from base class
 
-unsigned int Command::getMemSize() const
+std::size_t Command::getMemSize() const
 {
     return toGCode().size();
 }
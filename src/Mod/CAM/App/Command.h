@@ -24,6 +24,7 @@
 #ifndef PATH_COMMAND_H
 #define PATH_COMMAND_H
 
+#include <iosfwd>
 #include <map>
 #include <string>
 #include <Base/Persistence.h>
@@ -44,7 +45,7 @@ public:
     Command(const char* name, const std::map<std::string, double>& parameters);
     ~Command() override;
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
@@ -66,6 +67,10 @@ public:
     Command transform(const Base::Placement&);       // returns a transformed copy of this command
     double getValue(const std::string& name) const;  // returns the value of a given parameter
     void scaleBy(double factor);  // scales the receiver - use for imperial/metric conversions
+    static void writeValue(std::ostream& str,
+                           double value,
+                           int precision = 6,
+                           bool padzero = true);  // writes a parameter value like toGCode()
 
     // this assumes the name is upper case
     inline double getParam(const std::string& name, double fallback = 0.0) const
@@ -0,0 +1,618 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <utility>
+#endif
+
+#include <Base/Exception.h>
+
+#include "CompactToolpath.h"
+
+
+using namespace Path;
+
+namespace
+{
+
+// the keys of the column words, in the order of CompactToolpath::Word
+const char wordKeys[] = "ABCFIJKXYZ";
+
+int wordIndex(char key)
+{
+    switch (key) {
+        case 'A':
+            return CompactToolpath::A;
+        case 'B':
+            return CompactToolpath::B;
+        case 'C':
+            return CompactToolpath::C;
+        case 'F':
+            return CompactToolpath::F;
+        case 'I':
+            return CompactToolpath::I;
+        case 'J':
+            return CompactToolpath::J;
+        case 'K':
+            return CompactToolpath::K;
+        case 'X':
+            return CompactToolpath::X;
+        case 'Y':
+            return CompactToolpath::Y;
+        case 'Z':
+            return CompactToolpath::Z;
+        default:
+            return -1;
+    }
+}
+
+int wordIndex(const std::string& word)
+{
+    return word.size() == 1 ? wordIndex(word[0]) : -1;
+}
+
+CompactToolpath::Opcode classify(const std::string& name)
+{
+    if (name == "G0" || name == "G00") {
+        return CompactToolpath::Rapid;
+    }
+    if (name == "G1" || name == "G01") {
+        return CompactToolpath::Linear;
+    }
+    if (name == "G2" || name == "G02") {
+        return CompactToolpath::ArcCW;
+    }
+    if (name == "G3" || name == "G03") {
+        return CompactToolpath::ArcCCW;
+    }
+    return CompactToolpath::Other;
+}
+
+// G-codes that PathSegmentWalker treats specially for straight moves
+bool needsWalker(const std::string& name)
+{
+    static const char* const codes[] = {"G91",
+                                        "G73",
+                                        "G81",
+                                        "G82",
+                                        "G83",
+                                        "G84",
+                                        "G85",
+                                        "G86",
+                                        "G89",
+                                        "G38.2",
+                                        "G38.3",
+                                        "G38.4",
+                                        "G38.5"};
+    return std::any_of(std::begin(codes), std::end(codes), [&name](const char* code) {
+        return name == code;
+    });
+}
+
+/** Parser of a single command
+ *
+ * This follows the rules of Command::setFromGCode(), but writes the words
+ * into fixed slots and reuses its buffers from one command to the next.
+ */
+class GCodeParser
+{
+public:
+    void parse(const char* begin, const char* end)
+    {
+        enum
+        {
+            None,
+            Name,
+            Argument,
+            Comment
+        } mode = None;
+
+        name.clear();
+        value.clear();
+        mask = 0;
+        extras.clear();
+        char key = 0;
+
+        for (const char* it = begin; it != end; ++it) {
+            auto ch = static_cast<unsigned char>(*it);
+            if (std::isdigit(ch) || ch == '-' || ch == '.') {
+                value += *it;
+            }
+            else if (std::isalpha(ch)) {
+                if (mode == Name) {
+                    if (!key || value.empty()) {
+                        throw Base::BadFormatError("Badly formatted GCode command");
+                    }
+                    setName(key, true);
+                    mode = Argument;
+                }
+                else if (mode == None) {
+                    mode = Name;
+                }
+                else if (mode == Argument) {
+                    if (!key || value.empty()) {
+                        throw Base::BadFormatError("Badly formatted GCode argument");
+                    }
+                    addWord(key);
+                }
+                else {
+                    value += *it;
+                }
+                key = *it;
+            }
+            else if (ch == '(') {
+                mode = Comment;
+            }
+            else if (ch == ')') {
+                key = '(';
+                value += ')';
+            }
+            else if (mode == Comment) {
+                value += *it;
+            }
+        }
+
+        if (!key || value.empty()) {
+            throw Base::BadFormatError("Badly formatted GCode argument");
+        }
+        if (mode == Name || mode == Comment) {
+            setName(key, mode == Name);
+        }
+        else {
+            addWord(key);
+        }
+    }
+
+    // converts inch to mm, see Command::scaleBy()
+    void scale(double factor)
+    {
+        for (int word :
+             {CompactToolpath::X, CompactToolpath::Y, CompactToolpath::Z, CompactToolpath::I,
+              CompactToolpath::J, CompactToolpath::F}) {
+            values[word] *= factor;
+        }
+        for (auto& extra : extras) {
+            if (extra.first == 'R' || extra.first == 'Q') {
+                extra.second *= factor;
+            }
+        }
+    }
+
+    std::string name;
+    std::uint16_t mask = 0;
+    std::array<double, CompactToolpath::WordCount> values {};
+    // the other words, sorted by key
+    std::vector<std::pair<char, double>> extras;
+
+private:
+    void setName(char key, bool upper)
+    {
+        name = key;
+        name += value;
+        if (upper) {
+            for (char& ch : name) {
+                ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+            }
+        }
+        value.clear();
+    }
+
+    void addWord(char key)
+    {
+        key = static_cast<char>(std::toupper(static_cast<unsigned char>(key)));
+        double val = std::atof(value.c_str());
+        value.clear();
+
+        int index = wordIndex(key);
+        if (index >= 0) {
+            mask |= static_cast<std::uint16_t>(1U << index);
+            values[index] = val;
+            return;
+        }
+        auto it = std::lower_bound(extras.begin(),
+                                   extras.end(),
+                                   key,
+                                   [](const std::pair<char, double>& extra, char k) {
+                                       return extra.first < k;
+                                   });
+        if (it != extras.end() && it->first == key) {
+            it->second = val;
+        }
+        else {
+            extras.emplace(it, key, val);
+        }
+    }
+
+    std::string value;
+};
+
+}  // namespace
+
+void CompactToolpath::clear()
+{
+    nameIds.clear();
+    masks.clear();
+    for (auto& column : columns) {
+        column.clear();
+    }
+    extras.clear();
+    names.clear();
+    opcodes.clear();
+    nameIndex.clear();
+}
+
+void CompactToolpath::reserve(std::size_t count)
+{
+    nameIds.reserve(count);
+    masks.reserve(count);
+    for (auto& column : columns) {
+        column.reserve(count);
+    }
+}
+
+std::uint32_t CompactToolpath::internName(const std::string& name)
+{
+    auto it = nameIndex.find(name);
+    if (it != nameIndex.end()) {
+        return it->second;
+    }
+    auto id = static_cast<std::uint32_t>(names.size());
+    names.push_back(name);
+    opcodes.push_back(classify(name));
+    nameIndex.emplace(name, id);
+    return id;
+}
+
+std::vector<CompactToolpath::Extra>::const_iterator
+CompactToolpath::extrasBegin(std::size_t pos) const
+{
+    return std::lower_bound(extras.begin(),
+                            extras.end(),
+                            pos,
+                            [](const Extra& extra, std::size_t index) {
+                                return extra.index < index;
+                            });
+}
+
+void CompactToolpath::setWord(std::size_t pos, const std::string& word, double value)
+{
+    int index = wordIndex(word);
+    if (index >= 0) {
+        columns[index][pos] = value;
+        masks[pos] |= static_cast<std::uint16_t>(1U << index);
+        return;
+    }
+
+    auto it = extras.begin() + (extrasBegin(pos) - extras.cbegin());
+    while (it != extras.end() && it->index == pos && it->word < word) {
+        ++it;
+    }
+    if (it != extras.end() && it->index == pos && it->word == word) {
+        it->value = value;
+    }
+    else {
+        extras.insert(it, Extra {static_cast<std::uint32_t>(pos), word, value});
+    }
+}
+
+void CompactToolpath::append(const Command& cmd)
+{
+    std::size_t pos = size();
+    nameIds.push_back(internName(cmd.Name));
+    masks.push_back(0);
+    for (auto& column : columns) {
+        column.push_back(0.0);
+    }
+    for (const auto& param : cmd.Parameters) {
+        setWord(pos, param.first, param.second);
+    }
+}
+
+void CompactToolpath::insert(std::size_t pos, const Command& cmd)
+{
+    if (pos >= size()) {
+        append(cmd);
+        return;
+    }
+
+    for (auto it = extras.begin() + (extrasBegin(pos) - extras.cbegin()); it != extras.end();
+         ++it) {
+        ++it->index;
+    }
+    nameIds.insert(nameIds.begin() + pos, internName(cmd.Name));
+    masks.insert(masks.begin() + pos, 0);
+    for (auto& column : columns) {
+        column.insert(column.begin() + pos, 0.0);
+    }
+    for (const auto& param : cmd.Parameters) {
+        setWord(pos, param.first, param.second);
+    }
+}
+
+void CompactToolpath::erase(std::size_t pos)
+{
+    if (pos >= size()) {
+        throw Base::IndexError("Index not in range");
+    }
+
+    auto first = extras.begin() + (extrasBegin(pos) - extras.cbegin());
+    auto last = first;
+    while (last != extras.end() && last->index == pos) {
+        ++last;
+    }
+    for (auto it = extras.erase(first, last); it != extras.end(); ++it) {
+        --it->index;
+    }
+    nameIds.erase(nameIds.begin() + pos);
+    masks.erase(masks.begin() + pos);
+    for (auto& column : columns) {
+        column.erase(column.begin() + pos);
+    }
+}
+
+Command CompactToolpath::getCommand(std::size_t pos) const
+{
+    Command cmd;
+    cmd.Name = getName(pos);
+    for (int word = 0; word < WordCount; ++word) {
+        if (has(pos, static_cast<Word>(word))) {
+            cmd.Parameters.emplace(std::string(1, wordKeys[word]), columns[word][pos]);
+        }
+    }
+    for (auto it = extrasBegin(pos); it != extras.end() && it->index == pos; ++it) {
+        cmd.Parameters.emplace(it->word, it->value);
+    }
+    return cmd;
+}
+
+void CompactToolpath::setFromGCode(const std::string& gcode)
+{
+    clear();
+
+    GCodeParser parser;
+    bool inches = false;
+    auto addCommand = [&](std::size_t first, std::size_t last) {
+        parser.parse(gcode.data() + first, gcode.data() + last);
+        if (parser.name == "G20") {
+            inches = true;
+            return;
+        }
+        if (parser.name == "G21") {
+            inches = false;
+            return;
+        }
+        if (inches) {
+            parser.scale(25.4);
+        }
+
+        auto pos = static_cast<std::uint32_t>(size());
+        nameIds.push_back(internName(parser.name));
+        masks.push_back(parser.mask);
+        for (int word = 0; word < WordCount; ++word) {
+            columns[word].push_back((parser.mask & (1U << word)) ? parser.values[word] : 0.0);
+        }
+        for (const auto& extra : parser.extras) {
+            extras.push_back(Extra {pos, std::string(1, extra.first), extra.second});
+        }
+    };
+
+    // Split the program at comments and before each G and M word
+    static const char* const delimiters = "(gGmM";
+    bool comment = false;
+    std::size_t last = std::string::npos;
+    std::size_t found = gcode.find_first_of(delimiters);
+    while (found != std::string::npos) {
+        if (gcode[found] == '(') {
+            if (last != std::string::npos) {
+                addCommand(last, found);
+            }
+            comment = true;
+            last = found;
+            found = gcode.find(')', found + 1);
+        }
+        else if (gcode[found] == ')') {
+            addCommand(last, found + 1);
+            comment = false;
+            last = std::string::npos;
+            found = gcode.find_first_of(delimiters, found + 1);
+        }
+        else {
+            if (last != std::string::npos) {
+                addCommand(last, found);
+            }
+            last = found;
+            found = gcode.find_first_of(delimiters, found + 1);
+        }
+    }
+    // an unterminated comment is dropped
+    if (last != std::string::npos && !comment) {
+        addCommand(last, gcode.size());
+    }
+}
+
+std::string CompactToolpath::toGCode() const
+{
+    std::ostringstream str;
+    auto writeWord = [&str](const char* key, std::size_t len, double value) {
+        str << ' ';
+        str.write(key, static_cast<std::streamsize>(len));
+        Command::writeValue(str, value, 6, true);
+    };
+
+    auto extra = extras.begin();
+    for (std::size_t pos = 0; pos < size(); ++pos) {
+        str << getName(pos);
+        // merge the columns and the extra words in the order of their keys, like the
+        // parameter map of Command
+        for (int word = 0; word < WordCount; ++word) {
+            if (!has(pos, static_cast<Word>(word))) {
+                continue;
+            }
+            for (; extra != extras.end() && extra->index == pos
+                 && extra->word.compare(0, std::string::npos, wordKeys + word, 1) < 0;
+                 ++extra) {
+                if (extra->word != "N") {
+                    writeWord(extra->word.c_str(), extra->word.size(), extra->value);
+                }
+            }
+            writeWord(wordKeys + word, 1, columns[word][pos]);
+        }
+        for (; extra != extras.end() && extra->index == pos; ++extra) {
+            if (extra->word != "N") {
+                writeWord(extra->word.c_str(), extra->word.size(), extra->value);
+            }
+        }
+        str << '\n';
+    }
+    return str.str();
+}
+
+Base::Vector3d CompactToolpath::getPosition(std::size_t pos, const Base::Vector3d& last) const
+{
+    return Base::Vector3d(getValue(pos, X, last.x),
+                          getValue(pos, Y, last.y),
+                          getValue(pos, Z, last.z));
+}
+
+Base::Vector3d CompactToolpath::getCenter(std::size_t pos) const
+{
+    return Base::Vector3d(getValue(pos, I), getValue(pos, J), getValue(pos, K));
+}
+
+double CompactToolpath::getLength() const
+{
+    double length = 0;
+    Base::Vector3d last(0, 0, 0);
+    for (std::size_t pos = 0; pos < size(); ++pos) {
+        Opcode op = getOpcode(pos);
+        if (op == Other) {
+            continue;
+        }
+        Base::Vector3d next = getPosition(pos, last);
+        if (op == Rapid || op == Linear) {
+            length += (next - last).Length();
+        }
+        else {
+            Base::Vector3d center = getCenter(pos);
+            double radius = (last - center).Length();
+            double angle = (next - center).GetAngle(last - center);
+            length += angle * radius;
+        }
+        last = next;
+    }
+    return length;
+}
+
+double CompactToolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double vRapid) const
+{
+    if (hFeed == 0 || vFeed == 0 || empty()) {
+        return 0;
+    }
+    if (hRapid == 0) {
+        hRapid = hFeed;
+    }
+    if (vRapid == 0) {
+        vRapid = vFeed;
+    }
+
+    double time = 0;
+    Base::Vector3d last(0, 0, 0);
+    for (std::size_t pos = 0; pos < size(); ++pos) {
+        Base::Vector3d next = getPosition(pos, last);
+        bool verticalMove = last.z != next.z;
+        double feedrate = verticalMove ? vFeed : hFeed;
+        double length = 0;
+
+        switch (getOpcode(pos)) {
+            case Rapid:
+                length = (next - last).Length();
+                feedrate = verticalMove ? vRapid : hRapid;
+                break;
+            case Linear:
+                length = (next - last).Length();
+                break;
+            case ArcCW:
+            case ArcCCW: {
+                Base::Vector3d center = getCenter(pos);
+                double radius = (last - center).Length();
+                double angle = (next - center).GetAngle(last - center);
+                length = angle * radius;
+                break;
+            }
+            default:
+                break;
+        }
+
+        time += length / feedrate;
+        last = next;
+    }
+    return time;
+}
+
+bool CompactToolpath::getLinearBoundBox(Base::BoundBox3d& box) const
+{
+    std::vector<bool> walkerNames(names.size());
+    for (std::size_t id = 0; id < names.size(); ++id) {
+        walkerNames[id] = opcodes[id] == ArcCW || opcodes[id] == ArcCCW || needsWalker(names[id]);
+    }
+
+    const auto rotary = static_cast<std::uint16_t>((1U << A) | (1U << B) | (1U << C));
+    Base::BoundBox3d bb;
+    Base::Vector3d last(0, 0, 0);
+    for (std::size_t pos = 0; pos < size(); ++pos) {
+        std::uint32_t id = nameIds[pos];
+        if (walkerNames[id]) {
+            return false;
+        }
+        if (opcodes[id] == Other) {
+            continue;
+        }
+        if (masks[pos] & rotary) {
+            return false;
+        }
+        Base::Vector3d next = getPosition(pos, last);
+        bb.Add(last);
+        bb.Add(next);
+        last = next;
+    }
+    box = bb;
+    return true;
+}
+
+std::size_t CompactToolpath::getMemSize() const
+{
+    std::size_t memSize = nameIds.capacity() * sizeof(std::uint32_t)
+        + masks.capacity() * sizeof(std::uint16_t) + extras.capacity() * sizeof(Extra);
+    for (const auto& column : columns) {
+        memSize += column.capacity() * sizeof(double);
+    }
+    for (const auto& name : names) {
+        memSize += sizeof(std::string) + name.capacity() + sizeof(Opcode);
+    }
+    return memSize;
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef PATH_COMPACTTOOLPATH_H
+#define PATH_COMPACTTOOLPATH_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Mod/CAM/PathGlobal.h>
+
+#include "Command.h"
+
+
+namespace Path
+{
+
+/** Compact storage of the commands of a toolpath
+ *
+ * The commands are kept as a structure of arrays: an interned name per
+ * command, one column for each of the frequent words X, Y, Z, I, J, K, F, A,
+ * B and C together with a mask of the words that are set, and a side table
+ * for all other words. A move therefore costs around a hundred bytes and no
+ * heap allocation of its own. Command objects are only created on request,
+ * as a copy of a single entry.
+ */
+class PathExport CompactToolpath
+{
+public:
+    /// Words stored in their own column, in the alphabetical order of their keys
+    enum Word
+    {
+        A,
+        B,
+        C,
+        F,
+        I,
+        J,
+        K,
+        X,
+        Y,
+        Z,
+        WordCount
+    };
+
+    /// Motion of a command, derived from its name
+    enum Opcode : std::uint8_t
+    {
+        Other,
+        Rapid,
+        Linear,
+        ArcCW,
+        ArcCCW
+    };
+
+    std::size_t size() const
+    {
+        return nameIds.size();
+    }
+    bool empty() const
+    {
+        return nameIds.empty();
+    }
+    void clear();
+    void reserve(std::size_t count);
+
+    void append(const Command& cmd);
+    void insert(std::size_t pos, const Command& cmd);
+    void erase(std::size_t pos);
+
+    /// Returns a copy of the command at \a pos
+    Command getCommand(std::size_t pos) const;
+    const std::string& getName(std::size_t pos) const
+    {
+        return names[nameIds[pos]];
+    }
+    Opcode getOpcode(std::size_t pos) const
+    {
+        return opcodes[nameIds[pos]];
+    }
+    bool has(std::size_t pos, Word word) const
+    {
+        return (masks[pos] & (1U << word)) != 0;
+    }
+    double getValue(std::size_t pos, Word word, double fallback = 0.0) const
+    {
+        return has(pos, word) ? columns[word][pos] : fallback;
+    }
+
+    /** Replaces the content with the commands of a G-code program
+     *
+     * The program is split and parsed in a single pass with the same rules
+     * as Command::setFromGCode(). G20 and G21 only switch the units and are
+     * not stored, inch values are converted to mm.
+     */
+    void setFromGCode(const std::string& gcode);
+    /// Returns the G-code of all commands, one per line
+    std::string toGCode() const;
+
+    double getLength() const;
+    double getCycleTime(double hFeed, double vFeed, double hRapid, double vRapid) const;
+    /** Computes the bound box of a path made of straight moves only
+     *
+     * Returns false if the path contains arcs, cycles, rotary axes or modal
+     * G-codes, which need the full PathSegmentWalker.
+     */
+    bool getLinearBoundBox(Base::BoundBox3d& box) const;
+
+    std::size_t getMemSize() const;
+
+private:
+    struct Extra
+    {
+        std::uint32_t index;
+        std::string word;
+        double value;
+    };
+
+    std::uint32_t internName(const std::string& name);
+    void setWord(std::size_t pos, const std::string& word, double value);
+    std::vector<Extra>::const_iterator extrasBegin(std::size_t pos) const;
+    Base::Vector3d getPosition(std::size_t pos, const Base::Vector3d& last) const;
+    Base::Vector3d getCenter(std::size_t pos) const;
+
+private:
+    std::vector<std::uint32_t> nameIds;
+    std::vector<std::uint16_t> masks;
+    std::array<std::vector<double>, WordCount> columns;
+    // all other words, sorted by command index and word
+    std::vector<Extra> extras;
+
+    std::vector<std::string> names;
+    std::vector<Opcode> opcodes;
+    std::unordered_map<std::string, std::uint32_t> nameIndex;
+};
+
+}  // namespace Path
+
+#endif  // PATH_COMPACTTOOLPATH_H
@@ -41,10 +41,9 @@ Toolpath::Toolpath()
 {}
 
 Toolpath::Toolpath(const Toolpath& otherPath)
-    : vpcCommands(otherPath.vpcCommands.size())
+    : compact(otherPath.compact)
     , center(otherPath.center)
 {
-    *this = otherPath;
     recalculate();
 }
 
@@ -59,32 +58,44 @@ Toolpath& Toolpath::operator=(const Toolpath& otherPath)
         return *this;
     }
 
-    clear();
-    vpcCommands.resize(otherPath.vpcCommands.size());
-    int i = 0;
-    for (std::vector<Command*>::const_iterator it = otherPath.vpcCommands.begin();
-         it != otherPath.vpcCommands.end();
-         ++it, i++) {
-        vpcCommands[i] = new Command(**it);
-    }
+    clearCommands();
+    compact = otherPath.compact;
     center = otherPath.center;
     recalculate();
     return *this;
 }
 
 void Toolpath::clear()
+{
+    clearCommands();
+    compact.clear();
+    recalculate();
+}
+
+void Toolpath::clearCommands() const
 {
     for (std::vector<Command*>::iterator it = vpcCommands.begin(); it != vpcCommands.end(); ++it) {
         delete (*it);
     }
     vpcCommands.clear();
-    recalculate();
+}
+
+const std::vector<Command*>& Toolpath::getCommands() const
+{
+    if (vpcCommands.size() != compact.size()) {
+        clearCommands();
+        vpcCommands.reserve(compact.size());
+        for (std::size_t i = 0; i < compact.size(); i++) {
+            vpcCommands.push_back(new Command(compact.getCommand(i)));
+        }
+    }
+    return vpcCommands;
 }
 
 void Toolpath::addCommand(const Command& Cmd)
 {
-    Command* tmp = new Command(Cmd);
-    vpcCommands.push_back(tmp);
+    clearCommands();
+    compact.append(Cmd);
     recalculate();
 }
 
@@ -93,9 +104,9 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
     if (pos == -1) {
         addCommand(Cmd);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        Command* tmp = new Command(Cmd);
-        vpcCommands.insert(vpcCommands.begin() + pos, tmp);
+    else if (pos >= 0 && pos <= static_cast<int>(compact.size())) {
+        clearCommands();
+        compact.insert(pos, Cmd);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -105,12 +116,13 @@ void Toolpath::insertCommand(const Command& Cmd, int pos)
 
 void Toolpath::deleteCommand(int pos)
 {
-    if (pos == -1) {
-        // delete(*vpcCommands.rbegin()); // causes crash
-        vpcCommands.pop_back();
+    if (pos == -1 && !compact.empty()) {
+        clearCommands();
+        compact.erase(compact.size() - 1);
     }
-    else if (pos <= static_cast<int>(vpcCommands.size())) {
-        vpcCommands.erase(vpcCommands.begin() + pos);
+    else if (pos >= 0 && pos < static_cast<int>(compact.size())) {
+        clearCommands();
+        compact.erase(pos);
     }
     else {
         throw Base::IndexError("Index not in range");
@@ -120,31 +132,7 @@ void Toolpath::deleteCommand(int pos)
 
 double Toolpath::getLength()
 {
-    if (vpcCommands.empty()) {
-        return 0;
-    }
-    double l = 0;
-    Vector3d last(0, 0, 0);
-    Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
-            // straight line
-            l += (next - last).Length();
-            last = next;
-        }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
-            // arc
-            Vector3d center = (*it)->getCenter();
-            double radius = (last - center).Length();
-            double angle = (next - center).GetAngle(last - center);
-            l += angle * radius;
-            last = next;
-        }
-    }
-    return l;
+    return compact.getLength();
 }
 
 double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double vRapid)
@@ -159,61 +147,7 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         return 0;
     }
 
-    if (hRapid == 0) {
-        hRapid = hFeed;
-    }
-
-    if (vRapid == 0) {
-        vRapid = vFeed;
-    }
-
-    if (vpcCommands.empty()) {
-        return 0;
-    }
-    double l = 0;
-    double time = 0;
-    bool verticalMove = false;
-    Vector3d last(0, 0, 0);
-    Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
-
-        l = 0;
-        verticalMove = false;
-        feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
-
-        if (last.z != next.z) {
-            verticalMove = true;
-            feedrate = vFeed;
-        }
-
-        if ((name == "G0") || (name == "G00")) {
-            // Rapid Move
-            l += (next - last).Length();
-            feedrate = hRapid;
-            if (verticalMove) {
-                feedrate = vRapid;
-            }
-        }
-        else if ((name == "G1") || (name == "G01")) {
-            // Feed Move
-            l += (next - last).Length();
-        }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
-            // Arc Move
-            Vector3d center = (*it)->getCenter();
-            double radius = (last - center).Length();
-            double angle = (next - center).GetAngle(last - center);
-            l += angle * radius;
-        }
-
-        time += l / feedrate;
-        last = next;
-    }
-    return time;
+    return compact.getCycleTime(hFeed, vFeed, hRapid, vRapid);
 }
 
 class BoundBoxSegmentVisitor: public PathSegmentVisitor
@@ -297,6 +231,12 @@ private:
 
 Base::BoundBox3d Toolpath::getBoundBox() const
 {
+    // straight moves are handled directly on the compact data
+    Base::BoundBox3d bb;
+    if (compact.getLinearBoundBox(bb)) {
+        return bb;
+    }
+
     BoundBoxSegmentVisitor visitor;
     PathSegmentWalker walker(*this);
     walker.walk(visitor, Vector3d(0, 0, 0));
@@ -304,96 +244,22 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
-{
-    Command* cmd = new Command();
-    cmd->setFromGCode(gcodestr);
-    if ("G20" == cmd->Name) {
-        inches = true;
-        delete cmd;
-    }
-    else if ("G21" == cmd->Name) {
-        inches = false;
-        delete cmd;
-    }
-    else {
-        if (inches) {
-            cmd->scaleBy(25.4);
-        }
-        commands.push_back(cmd);
-    }
-}
-
 void Toolpath::setFromGCode(const std::string instr)
 {
     clear();
-
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
-    bool inches = false;
-    while (found != std::string::npos) {
-        if (str[found] == '(') {
-            // start of comment
-            if ((last > -1) && (mode == "command")) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found + 1);
-        }
-        else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
-        }
-        else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
-            }
-            last = found;
-            found = str.find_first_of("(gGmM", found + 1);
-        }
-    }
-    // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
-    }
+    compact.setFromGCode(instr);
     recalculate();
 }
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
-    }
-    return result;
+    return compact.toGCode();
 }
 
 void Toolpath::recalculate()  // recalculates the path cache
 {
 
-    if (vpcCommands.empty()) {
+    if (compact.empty()) {
         return;
     }
 
@@ -456,9 +322,9 @@ void Toolpath::recalculate()  // recalculates the path cache
 
 // reimplemented from base class
 
-unsigned int Toolpath::getMemSize() const
+std::size_t Toolpath::getMemSize() const
 {
-    return toGCode().size();
+    return compact.getMemSize();
 }
 
 void Toolpath::setCenter(const Base::Vector3d& c)
@@ -481,7 +347,7 @@ void Toolpath::Save(Writer& writer) const
         writer.incInd();
         saveCenter(writer, center);
         for (unsigned int i = 0; i < getSize(); i++) {
-            vpcCommands[i]->Save(writer);
+            compact.getCommand(i).Save(writer);
         }
         writer.decInd();
     }
@@ -498,7 +364,7 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
+    if (compact.empty()) {
         return;
     }
     writer.Stream() << toGCode();
@@ -28,6 +28,7 @@
 #include <Base/Vector3D.h>
 
 #include "Command.h"
+#include "CompactToolpath.h"
 
 
 namespace Path
@@ -47,7 +48,7 @@ public:
     Toolpath& operator=(const Toolpath&);
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& writer) const override;
@@ -69,15 +70,18 @@ public:
     // shortcut functions
     unsigned int getSize() const
     {
-        return vpcCommands.size();
+        return compact.size();
     }
-    const std::vector<Command*>& getCommands() const
+    // the Command objects are created on first access and dropped on the next change
+    const std::vector<Command*>& getCommands() const;
+    const Command& getCommand(unsigned int pos) const
     {
-        return vpcCommands;
+        return *getCommands()[pos];
     }
-    const Command& getCommand(unsigned int pos) const
+    // the commands in compact form, use getCompact().getCommand() for a copy of a single one
+    const CompactToolpath& getCompact() const
     {
-        return *vpcCommands[pos];
+        return compact;
     }
 
     // support for rotation
@@ -90,7 +94,10 @@ public:
     static const int SchemaVersion = 2;
 
 protected:
-    std::vector<Command*> vpcCommands;
+    void clearCommands() const;
+
+    CompactToolpath compact;
+    mutable std::vector<Command*> vpcCommands;
     Base::Vector3d center;
     // KDL::Path_Composite *pcPath;
 
@@ -91,7 +91,7 @@ Py::List PathPy::getCommands() const
     Py::List list;
     for (unsigned int i = 0; i < getToolpathPtr()->getSize(); i++) {
         list.append(
-            Py::asObject(new Path::CommandPy(new Path::Command(getToolpathPtr()->getCommand(i)))));
+            Py::asObject(new Path::CommandPy(new Path::Command(getToolpathPtr()->getCompact().getCommand(i)))));
     }
     return list;
 }
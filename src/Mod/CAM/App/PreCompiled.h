@@ -43,11 +43,14 @@
 #ifdef _PreComp_
 
 // standard
+#include <atomic>
 #include <cinttypes>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Boost
@@ -20,6 +20,8 @@
 # *                                                                         *
 # ***************************************************************************
 
+import random
+
 import FreeCAD
 import Path
 from CAMTests.PathTestUtils import PathTestBase
@@ -126,6 +128,130 @@ G0 Z0.500000
         p.setFromGCode(lines)
         self.assertEqual(p.toGCode(), output)
 
+    def test20(self):
+        """Test G-code round trip against the single command parser"""
+        rng = random.Random(42)
+        names = ["G0", "G1", "G2", "G3", "G81", "G83", "M3", "M6", "g1", "m05"]
+        words = "XYZIJKFABCRQSPT"
+
+        lines = []
+        for i in range(2000):
+            line = rng.choice(names)
+            for word in rng.sample(words, rng.randint(0, 6)):
+                if rng.random() < 0.2:
+                    word = word.lower()
+                value = round(rng.uniform(-1000, 1000), rng.randint(0, 6))
+                line += rng.choice(["", " "]) + word + str(value)
+            if rng.random() < 0.1:
+                line += " (comment %d)" % i
+            lines.append(line)
+
+        p = Path.Path()
+        p.setFromGCode("\n".join(lines))
+
+        expected = []
+        for line in lines:
+            for gcode in line.split(" ("):
+                c = Path.Command()
+                c.setFromGCode(gcode if gcode[0] in "GgMm" else "(" + gcode)
+                expected.append(c)
+
+        commands = p.Commands
+        self.assertEqual(len(commands), len(expected))
+        for c1, c2 in zip(commands, expected):
+            self.assertEqual(str(c1), str(c2))
+        gcode = "".join(c.toGCode() + "\n" for c in expected)
+        self.assertEqual(p.toGCode(), gcode)
+
+        # parsing the output again does not change the path
+        p2 = Path.Path()
+        p2.setFromGCode(p.toGCode())
+        self.assertEqual(p2.toGCode(), gcode)
+
+    def test30(self):
+        """Test scaling of inch programs"""
+        p = Path.Path()
+        p.setFromGCode("G20\nG1 X1 Y2 Z3 I0.5 J0.25 K1 F10 R0.1 Q0.2 S100\nG21\nG1 X1\n")
+
+        # G20 and G21 only switch the units
+        self.assertEqual(p.Size, 2)
+        c = p.Commands[0]
+        self.assertRoughly(c.Parameters["X"], 25.4)
+        self.assertRoughly(c.Parameters["Y"], 50.8)
+        self.assertRoughly(c.Parameters["Z"], 76.2)
+        self.assertRoughly(c.Parameters["I"], 12.7)
+        self.assertRoughly(c.Parameters["J"], 6.35)
+        self.assertRoughly(c.Parameters["K"], 1)
+        self.assertRoughly(c.Parameters["F"], 254)
+        self.assertRoughly(c.Parameters["R"], 2.54)
+        self.assertRoughly(c.Parameters["Q"], 5.08)
+        self.assertRoughly(c.Parameters["S"], 100)
+        self.assertRoughly(p.Commands[1].Parameters["X"], 1)
+
+    def test40(self):
+        """Test Path.BoundBox calculation"""
+        # straight moves, the path starts at the origin
+        p = Path.Path()
+        p.setFromGCode("G0 X1 Y2 Z3\nG1 X-1 Y4\n")
+        bb = p.BoundBox
+        self.assertRoughly(bb.XMin, -1)
+        self.assertRoughly(bb.XMax, 1)
+        self.assertRoughly(bb.YMin, 0)
+        self.assertRoughly(bb.YMax, 4)
+        self.assertRoughly(bb.ZMin, 0)
+        self.assertRoughly(bb.ZMax, 3)
+
+        # an arc extends beyond its end points
+        p = Path.Path()
+        p.setFromGCode("G2 X2 Y0 I1 J0\n")
+        bb = p.BoundBox
+        self.assertRoughly(bb.XMin, 0)
+        self.assertRoughly(bb.XMax, 2)
+        self.assertRoughly(bb.YMin, 0)
+        self.assertRoughly(bb.YMax, 1, 0.01)
+
+        # relative moves are accumulated
+        p = Path.Path()
+        p.setFromGCode("G91\nG1 X1\nG1 X1 Y1\n")
+        bb = p.BoundBox
+        self.assertRoughly(bb.XMax, 2)
+        self.assertRoughly(bb.YMax, 1)
+
+    def test45(self):
+        """Test modifying a path after reading its commands"""
+        p = Path.Path()
+        p.setFromGCode("G1 X1\nG1 Y1\n")
+        commands = p.Commands
+        self.assertEqual(len(commands), 2)
+
+        # the returned commands are copies
+        commands[0].x = 5
+        self.assertEqual(str(p.Commands[0]), "Command G1 [ X:1 ]")
+
+        p.insertCommand(Path.Command("G0", {"Z": 2}), 0)
+        p.addCommands(Path.Command("G1", {"X": 3}))
+        self.assertEqual(
+            [str(c) for c in p.Commands],
+            [
+                "Command G0 [ Z:2 ]",
+                "Command G1 [ X:1 ]",
+                "Command G1 [ Y:1 ]",
+                "Command G1 [ X:3 ]",
+            ],
+        )
+        self.assertEqual(str(commands[1]), "Command G1 [ Y:1 ]")
+
+        p.deleteCommand(1)
+        self.assertEqual(
+            [str(c) for c in p.Commands],
+            ["Command G0 [ Z:2 ]", "Command G1 [ Y:1 ]", "Command G1 [ X:3 ]"],
+        )
+        self.assertRoughly(p.BoundBox.XMax, 3)
+        self.assertRoughly(p.BoundBox.ZMax, 2)
+
+        p.Commands = commands
+        self.assertEqual(p.toGCode(), "G1 X5.000000\nG1 Y1.000000\n")
+
     def test50(self):
         """Test Path.Length calculation"""
         commands = []
@@ -5,23 +5,24 @@
 
 #include "Area.h"
 #include "AreaOrderer.h"
+#include "kurve/geometry.h"
 
 #include <map>
 
-double CArea::m_accuracy = 0.01;
-double CArea::m_units = 1.0;
-bool CArea::m_clipper_simple = false;
-double CArea::m_clipper_clean_distance = 0.0;
-bool CArea::m_fit_arcs = true;
-int CArea::m_min_arc_points = 4;
-int CArea::m_max_arc_points = 100;
-double CArea::m_single_area_processing_length = 0.0;
-double CArea::m_processing_done = 0.0;
-bool CArea::m_please_abort = false;
-double CArea::m_MakeOffsets_increment = 0.0;
-double CArea::m_split_processing_length = 0.0;
-bool CArea::m_set_processing_length_in_split = false;
-double CArea::m_after_MakeOffsets_length = 0.0;
+thread_local double CArea::m_accuracy = 0.01;
+thread_local double CArea::m_units = 1.0;
+thread_local bool CArea::m_clipper_simple = false;
+thread_local double CArea::m_clipper_clean_distance = 0.0;
+thread_local bool CArea::m_fit_arcs = true;
+thread_local int CArea::m_min_arc_points = 4;
+thread_local int CArea::m_max_arc_points = 100;
+thread_local double CArea::m_single_area_processing_length = 0.0;
+thread_local double CArea::m_processing_done = 0.0;
+std::atomic<bool> CArea::m_please_abort {false};
+thread_local double CArea::m_MakeOffsets_increment = 0.0;
+thread_local double CArea::m_split_processing_length = 0.0;
+thread_local bool CArea::m_set_processing_length_in_split = false;
+thread_local double CArea::m_after_MakeOffsets_length = 0.0;
 // static const double PI = 3.1415926535897932;
 
 #define _CAREA_PARAM_DEFINE(_class, _type, _name)                                                  \
@@ -54,6 +55,43 @@ CAREA_PARAM_DEFINE(short, min_arc_points)
 CAREA_PARAM_DEFINE(short, max_arc_points)
 CAREA_PARAM_DEFINE(double, clipper_scale)
 
+CArea::ThreadSettings::ThreadSettings()
+    : tolerance(Point::tolerance)
+    , accuracy(m_accuracy)
+    , units(m_units)
+    , clipper_simple(m_clipper_simple)
+    , clipper_clean_distance(m_clipper_clean_distance)
+    , fit_arcs(m_fit_arcs)
+    , min_arc_points(m_min_arc_points)
+    , max_arc_points(m_max_arc_points)
+    , clipper_scale(m_clipper_scale)
+    , kurve_units(geoff_geometry::UNITS)
+    , kurve_tolerance(geoff_geometry::TOLERANCE)
+    , kurve_tolerance_sq(geoff_geometry::TOLERANCE_SQ)
+    , kurve_tight_tolerance(geoff_geometry::TIGHT_TOLERANCE)
+    , kurve_unit_vector_tolerance(geoff_geometry::UNIT_VECTOR_TOLERANCE)
+    , kurve_resolution(geoff_geometry::RESOLUTION)
+{}
+
+void CArea::ThreadSettings::apply() const
+{
+    Point::tolerance = tolerance;
+    m_accuracy = accuracy;
+    m_units = units;
+    m_clipper_simple = clipper_simple;
+    m_clipper_clean_distance = clipper_clean_distance;
+    m_fit_arcs = fit_arcs;
+    m_min_arc_points = min_arc_points;
+    m_max_arc_points = max_arc_points;
+    m_clipper_scale = clipper_scale;
+    geoff_geometry::UNITS = kurve_units;
+    geoff_geometry::TOLERANCE = kurve_tolerance;
+    geoff_geometry::TOLERANCE_SQ = kurve_tolerance_sq;
+    geoff_geometry::TIGHT_TOLERANCE = kurve_tight_tolerance;
+    geoff_geometry::UNIT_VECTOR_TOLERANCE = kurve_unit_vector_tolerance;
+    geoff_geometry::RESOLUTION = kurve_resolution;
+}
+
 void CArea::append(const CCurve& curve)
 {
     m_curves.push_back(curve);
@@ -213,15 +251,15 @@ public:
     {}
 };
 
-static double stepover_for_pocket = 0.0;
-static std::list<ZigZag> zigzag_list_for_zigs;
-static std::list<CCurve>* curve_list_for_zigs = NULL;
-static bool rightward_for_zigs = true;
-static double sin_angle_for_zigs = 0.0;
-static double cos_angle_for_zigs = 0.0;
-static double sin_minus_angle_for_zigs = 0.0;
-static double cos_minus_angle_for_zigs = 0.0;
-static double one_over_units = 0.0;
+static thread_local double stepover_for_pocket = 0.0;
+static thread_local std::list<ZigZag> zigzag_list_for_zigs;
+static thread_local std::list<CCurve>* curve_list_for_zigs = NULL;
+static thread_local bool rightward_for_zigs = true;
+static thread_local double sin_angle_for_zigs = 0.0;
+static thread_local double cos_angle_for_zigs = 0.0;
+static thread_local double sin_minus_angle_for_zigs = 0.0;
+static thread_local double cos_minus_angle_for_zigs = 0.0;
+static thread_local double one_over_units = 0.0;
 
 static Point rotated_point(const Point& p)
 {
@@ -442,7 +480,7 @@ void make_zig(const CArea& a, double y0, double y)
     }
 }
 
-std::list<std::list<ZigZag>> reorder_zig_list_list;
+static thread_local std::list<std::list<ZigZag>> reorder_zig_list_list;
 
 void add_reorder_zig(ZigZag& zigzag)
 {
@@ -6,6 +6,8 @@
 #ifndef AREA_HEADER
 #define AREA_HEADER
 
+#include <atomic>
+
 #include "Curve.h"
 #include "clipper.hpp"
 
@@ -47,23 +49,25 @@ class CArea
 {
 public:
     std::list<CCurve> m_curves;
-    static double m_accuracy;
-    static double m_units;  // 1.0 for mm, 25.4 for inches. All points are multiplied by this before
-                            // going to the engine
-    static bool m_clipper_simple;
-    static double m_clipper_clean_distance;
-    static bool m_fit_arcs;
-    static int m_min_arc_points;
-    static int m_max_arc_points;
-    static double m_processing_done;  // 0.0 to 100.0, set inside MakeOnePocketCurve
-    static double m_single_area_processing_length;
-    static double m_after_MakeOffsets_length;
-    static double m_MakeOffsets_increment;
-    static double m_split_processing_length;
-    static bool m_set_processing_length_in_split;
-    static bool m_please_abort;  // the user sets this from another thread, to tell
-                                 // MakeOnePocketCurve to finish with no result.
-    static double m_clipper_scale;
+    // The settings and progress counters are per thread, so that areas can be
+    // processed concurrently with different settings
+    static thread_local double m_accuracy;
+    static thread_local double m_units;  // 1.0 for mm, 25.4 for inches. All points are multiplied
+                                         // by this before going to the engine
+    static thread_local bool m_clipper_simple;
+    static thread_local double m_clipper_clean_distance;
+    static thread_local bool m_fit_arcs;
+    static thread_local int m_min_arc_points;
+    static thread_local int m_max_arc_points;
+    static thread_local double m_processing_done;  // 0.0 to 100.0, set inside MakeOnePocketCurve
+    static thread_local double m_single_area_processing_length;
+    static thread_local double m_after_MakeOffsets_length;
+    static thread_local double m_MakeOffsets_increment;
+    static thread_local double m_split_processing_length;
+    static thread_local bool m_set_processing_length_in_split;
+    static std::atomic<bool> m_please_abort;  // the user sets this from another thread, to tell
+                                              // MakeOnePocketCurve to finish with no result.
+    static thread_local double m_clipper_scale;
 
     void append(const CCurve& curve);
     void move(CCurve&& curve);
@@ -115,6 +119,32 @@ public:
     CAREA_PARAM_DECLARE(short, max_arc_points)
     CAREA_PARAM_DECLARE(double, clipper_scale)
 
+    // The settings above, and the kurve tolerances, are per thread. ThreadSettings captures the
+    // values of the thread that constructs it, apply() sets them on a worker thread.
+    class ThreadSettings
+    {
+    public:
+        ThreadSettings();
+        void apply() const;
+
+    private:
+        double tolerance;
+        double accuracy;
+        double units;
+        bool clipper_simple;
+        double clipper_clean_distance;
+        bool fit_arcs;
+        int min_arc_points;
+        int max_arc_points;
+        double clipper_scale;
+        int kurve_units;
+        double kurve_tolerance;
+        double kurve_tolerance_sq;
+        double kurve_tight_tolerance;
+        double kurve_unit_vector_tolerance;
+        double kurve_resolution;
+    };
+
     // Following functions is add to operate on possible open curves
     void PopulateClipper(ClipperLib::Clipper& c, ClipperLib::PolyType type) const;
     void Clip(ClipperLib::ClipType op,
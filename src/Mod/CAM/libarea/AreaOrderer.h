@@ -45,7 +45,7 @@ class CInnerCurves: public std::enable_shared_from_this<CInnerCurves>
     std::shared_ptr<CArea> m_unite_area;  // new curves made by uniting are stored here
 
 public:
-    static CAreaOrderer* area_orderer;
+    static thread_local CAreaOrderer* area_orderer;
     CInnerCurves(std::shared_ptr<CInnerCurves> pOuter, std::shared_ptr<CCurve> curve);
     CInnerCurves()
     {}
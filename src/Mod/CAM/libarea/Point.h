@@ -55,7 +55,7 @@ public:
         , y(p1.y - p0.y)
     {}  // vector from p0 to p1
 
-    static double tolerance;
+    static thread_local double tolerance;
 
     const Point operator+(const Point& p) const
     {
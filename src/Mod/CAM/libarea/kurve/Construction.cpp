@@ -11,12 +11,12 @@ using namespace geoff_geometry;
 
 namespace geoff_geometry
 {
-int UNITS = MM;
-double TOLERANCE = 1.0e-06;
-double TOLERANCE_SQ = TOLERANCE * TOLERANCE;
-double TIGHT_TOLERANCE = 1.0e-09;
-double UNIT_VECTOR_TOLERANCE = 1.0e-10;
-double RESOLUTION = 1.0e-06;
+thread_local int UNITS = MM;
+thread_local double TOLERANCE = 1.0e-06;
+thread_local double TOLERANCE_SQ = TOLERANCE * TOLERANCE;
+thread_local double TIGHT_TOLERANCE = 1.0e-09;
+thread_local double UNIT_VECTOR_TOLERANCE = 1.0e-10;
+thread_local double RESOLUTION = 1.0e-06;
 
 // dummy functions
 const wchar_t* getMessage(const wchar_t* original)
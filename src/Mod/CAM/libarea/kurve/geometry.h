@@ -66,15 +66,16 @@ enum UNITS_TYPE
     INCHES
 };
 
-extern int UNITS;            // may be enum UNITS_TYPE (MM METRES or INCHES)
-extern double TOLERANCE;     // CAD Geometry resolution (inexact, eg. from import)
-extern double TOLERANCE_SQ;  // tolerance squared for faster coding.
-extern double TIGHT_TOLERANCE;
-extern double UNIT_VECTOR_TOLERANCE;
+// the units and tolerances are per thread, see CArea::ThreadSettings
+extern thread_local int UNITS;            // may be enum UNITS_TYPE (MM METRES or INCHES)
+extern thread_local double TOLERANCE;     // CAD Geometry resolution (inexact, eg. from import)
+extern thread_local double TOLERANCE_SQ;  // tolerance squared for faster coding.
+extern thread_local double TIGHT_TOLERANCE;
+extern thread_local double UNIT_VECTOR_TOLERANCE;
 extern double SMALL_ANGLE;  // small angle tangency test eg isConvex
 extern double SIN_SMALL_ANGLE;
 extern double COS_SMALL_ANGLE;
-extern double RESOLUTION;  // CNC resolution
+extern thread_local double RESOLUTION;  // CNC resolution
 
 void set_Tolerances(int mode);
 double mm(double value);  // convert to current units from mm
@@ -2299,7 +2299,7 @@ void FemMesh::write(const char* FileName) const
 
 // ==== Base class implementer ==============================================================
 
-unsigned int FemMesh::getMemSize() const
+std::size_t FemMesh::getMemSize() const
 {
     return 0;
 }
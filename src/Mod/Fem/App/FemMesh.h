@@ -101,7 +101,7 @@ public:
     void compute();
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
     void SaveDocFile(Base::Writer& writer) const override;
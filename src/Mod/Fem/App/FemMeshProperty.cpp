@@ -131,7 +131,7 @@ void PropertyFemMesh::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyFemMesh::getMemSize() const
+std::size_t PropertyFemMesh::getMemSize() const
 {
     return _FemMesh->getMemSize();
 }
@@ -83,7 +83,7 @@ public:
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     const char* getEditorName() const override
     {
         return "FemGui::PropertyFemMeshItem";
@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <iterator>
 #include <vtkCompositeDataSet.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiPieceDataSet.h>
@@ -40,12 +41,10 @@
 #include <vtkXMLUnstructuredGridReader.h>
 #endif
 
-#include <App/Application.h>
 #include <App/DocumentObject.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Reader.h>
-#include <Base/Stream.h>
 #include <Base/Writer.h>
 #include <CXX/Objects.hxx>
 
@@ -214,7 +213,7 @@ void PropertyPostDataObject::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyPostDataObject::getMemSize() const
+std::size_t PropertyPostDataObject::getMemSize() const
 {
     return m_dataObject ? m_dataObject->GetActualMemorySize() : 0;
 }
@@ -312,14 +311,10 @@ void PropertyPostDataObject::SaveDocFile(Base::Writer& writer) const
         return;
     }
 
-    // create a temporary file and copy the content to the zip stream
-    // once the tmp. filename is known use always the same because otherwise
-    // we may run into some problems on the Linux platform
-    static Base::FileInfo fi(App::Application::getTempFileName());
-
+    // write the data set into a memory buffer and copy the content to the zip stream
     vtkSmartPointer<vtkXMLDataSetWriter> xmlWriter = vtkSmartPointer<vtkXMLDataSetWriter>::New();
     xmlWriter->SetInputDataObject(m_dataObject);
-    xmlWriter->SetFileName(fi.filePath().c_str());
+    xmlWriter->WriteToOutputStringOn();
     xmlWriter->SetDataModeToBinary();
 
 #ifdef VTK_CELL_ARRAY_V2
@@ -332,56 +327,38 @@ void PropertyPostDataObject::SaveDocFile(Base::Writer& writer) const
 #endif
 
     if (xmlWriter->Write() != 1) {
-        // Note: Do NOT throw an exception here because if the tmp. file could
-        // not be created we should not abort.
+        // Note: Do NOT throw an exception here because if the data set could
+        // not be written we should not abort.
         // We only print an error message but continue writing the next files to the
         // stream...
         App::PropertyContainer* father = this->getContainer();
         if (father && father->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
             App::DocumentObject* obj = static_cast<App::DocumentObject*>(father);
-            Base::Console().Error("Dataset of '%s' cannot be written to vtk file '%s'\n",
-                                  obj->Label.getValue(),
-                                  fi.filePath().c_str());
+            Base::Console().Error("Dataset of '%s' cannot be written to vtk file\n",
+                                  obj->Label.getValue());
         }
         else {
-            Base::Console().Error("Cannot save vtk file '%s'\n", fi.filePath().c_str());
+            Base::Console().Error("Cannot save vtk file\n");
         }
 
-        std::stringstream ss;
-        ss << "Cannot save vtk file '" << fi.filePath() << "'";
-        writer.addError(ss.str());
-    }
-
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    if (file) {
-        std::streambuf* buf = file.rdbuf();
-        writer.Stream() << buf;
+        writer.addError("Cannot save vtk file");
     }
 
-    file.close();
-    // remove temp file
-    fi.deleteFile();
+    const std::string& data = xmlWriter->GetOutputString();
+    writer.Stream().write(data.data(), static_cast<std::streamsize>(data.size()));
 }
 
 void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
 {
     Base::FileInfo xml(reader.getFileName());
-    // create a temporary file and copy the content from the zip stream
-    Base::FileInfo fi(App::Application::getTempFileName());
-
-    // read in the ASCII file and write back to the file stream
-    Base::ofstream file(fi, std::ios::out | std::ios::binary);
-    unsigned long ulSize = 0;
+    // copy the content from the zip stream into a memory buffer
+    std::string data;
     if (reader) {
-        std::streambuf* buf = file.rdbuf();
-        reader >> buf;
-        file.flush();
-        ulSize = buf->pubseekoff(0, std::ios::cur, std::ios::in);
+        data.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
     }
-    file.close();
 
-    // Read the data from the temp file
-    if (ulSize > 0) {
+    // Read the data from the buffer
+    if (!data.empty()) {
         std::string extension = xml.extension();
 
         // TODO: read in of composite data structures need to be coded,
@@ -403,11 +380,12 @@ void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
             xmlReader = vtkSmartPointer<vtkXMLImageDataReader>::New();
         }
 
-        xmlReader->SetFileName(fi.filePath().c_str());
+        xmlReader->ReadFromInputStringOn();
+        xmlReader->SetInputString(data);
         xmlReader->Update();
 
         if (!xmlReader->GetOutputAsDataSet()) {
-            // Note: Do NOT throw an exception here because if the tmp. created file could
+            // Note: Do NOT throw an exception here because if the buffer could
             // not be read it's NOT an indication for an invalid input stream 'reader'.
             // We only print an error message but continue reading the next files from the
             // stream...
@@ -415,12 +393,12 @@ void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
             if (father && father->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
                 App::DocumentObject* obj = static_cast<App::DocumentObject*>(father);
                 Base::Console().Error("Dataset file '%s' with data of '%s' seems to be empty\n",
-                                      fi.filePath().c_str(),
+                                      reader.getFileName().c_str(),
                                       obj->Label.getValue());
             }
             else {
                 Base::Console().Warning("Loaded Dataset file '%s' seems to be empty\n",
-                                        fi.filePath().c_str());
+                                        reader.getFileName().c_str());
             }
         }
         else {
@@ -430,7 +408,4 @@ void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
             hasSetValue();
         }
     }
-
-    // delete the temp file
-    fi.deleteFile();
 }
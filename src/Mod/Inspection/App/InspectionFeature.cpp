@@ -23,15 +23,30 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
+#include <array>
 #include <boost/core/ignore_unused.hpp>
 #include <numeric>
 
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Bnd_Box.hxx>
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Geom_Surface.hxx>
+#include <Poly_Triangle.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
 #include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <gp_Pnt.hxx>
 
 #include <QEventLoop>
@@ -46,11 +61,13 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Elements.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/PointsGrid.h>
 
@@ -199,7 +216,8 @@ protected:
         assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
     }
 
-    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, unsigned long ulFacetIndex)
+    void GetGridIndices(MeshCore::ElementIndex ulFacetIndex,
+                        std::vector<unsigned long>& raulIndices) const override
     {
         unsigned long ulX1;
         unsigned long ulY1;
@@ -208,10 +226,13 @@ protected:
         unsigned long ulY2;
         unsigned long ulZ2;
 
+        MeshCore::MeshGeomFacet clFacet = _pclMesh->GetFacet(ulFacetIndex);
+        clFacet.Transform(_transform);
+
         Base::BoundBox3f clBB;
-        clBB.Add(rclFacet._aclPoints[0]);
-        clBB.Add(rclFacet._aclPoints[1]);
-        clBB.Add(rclFacet._aclPoints[2]);
+        clBB.Add(clFacet._aclPoints[0]);
+        clBB.Add(clFacet._aclPoints[1]);
+        clBB.Add(clFacet._aclPoints[2]);
 
         Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
         Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
@@ -221,22 +242,20 @@ protected:
             for (unsigned long ulX = ulX1; ulX <= ulX2; ulX++) {
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
-                        if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                        if (clFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
+                            raulIndices.push_back((unsigned long)GridIndex(ulX, ulY, ulZ));
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            raulIndices.push_back((unsigned long)GridIndex(ulX1, ulY1, ulZ1));
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -251,28 +270,13 @@ protected:
 
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
-
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
     }
 
     void RebuildGrid() override
     {
         _ulCtElements = _pclMesh->CountFacets();
         InitGrid();
-
-        unsigned long i = 0;
-        MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-        clFIter.Transform(_transform);
-        for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-            AddFacet(*clFIter, i++);
-        }
+        FillGrid();
     }
 
 private:
@@ -555,6 +559,250 @@ bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
 
 // ----------------------------------------------------------------
 
+namespace
+{
+// maximum number of triangles in a leaf of the tree
+const unsigned int maxLeafSize = 4;
+
+float squaredDistance(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    float dx = std::max<float>({box.MinX - pnt.x, 0.0F, pnt.x - box.MaxX});
+    float dy = std::max<float>({box.MinY - pnt.y, 0.0F, pnt.y - box.MaxY});
+    float dz = std::max<float>({box.MinZ - pnt.z, 0.0F, pnt.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+struct InspectNominalTessellatedShape::FaceData
+{
+    Handle(Geom_Surface) surface;
+    Standard_Real u1 {0}, u2 {0}, v1 {0}, v2 {0};
+};
+
+InspectNominalTessellatedShape::InspectNominalTessellatedShape(const TopoDS_Shape& nominal,
+                                                               float offset,
+                                                               bool refine)
+    : searchRadius(offset)
+    , refine(refine)
+{
+    if (nominal.IsNull()) {
+        return;
+    }
+
+    // Mesh a copy because the triangulation is stored in the shared faces and would replace
+    // the one of the nominal shape and of all the shapes sharing it
+    TopoDS_Shape shape = BRepBuilderAPI_Copy(nominal, Standard_True, Standard_False).Shape();
+
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+
+    // the deflection depends on the size of the shape and the search radius
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real diag = gp_Pnt(xMin, yMin, zMin).Distance(gp_Pnt(xMax, yMax, zMax));
+    Standard_Real defl = 0.0005 * diag;
+    if (offset > 0) {
+        defl = std::min<Standard_Real>(defl, 0.1 * offset);
+    }
+    defl = std::max<Standard_Real>(defl, Precision::Confusion());
+    deflection = static_cast<float>(defl);
+    BRepMesh_IncrementalMesh(shape, defl, Standard_False, 0.1, Standard_True);
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (!Part::Tools::getTriangulation(face, points, facets)) {
+            continue;
+        }
+
+        FaceData data;
+        data.surface = BRep_Tool::Surface(face);
+        BRepTools::UVBounds(face, data.u1, data.u2, data.v1, data.v2);
+        int faceIndex = static_cast<int>(faces.size());
+        faces.push_back(data);
+
+        triangles.reserve(triangles.size() + facets.size());
+        for (const auto& facet : facets) {
+            Standard_Integer n[3];
+            facet.Get(n[0], n[1], n[2]);
+            Triangle tria;
+            for (int j = 0; j < 3; j++) {
+                const gp_Pnt& pnt = points[n[j]];
+                tria.points[j].Set(float(pnt.X()), float(pnt.Y()), float(pnt.Z()));
+            }
+            tria.normal = (tria.points[1] - tria.points[0]) % (tria.points[2] - tria.points[0]);
+            tria.normal.Normalize();
+            tria.face = faceIndex;
+            triangles.push_back(tria);
+        }
+    }
+
+    if (!triangles.empty()) {
+        nodes.reserve(2 * triangles.size() / maxLeafSize + 1);
+        nodes.emplace_back();
+        buildNode(0, 0, static_cast<unsigned int>(triangles.size()));
+    }
+}
+
+InspectNominalTessellatedShape::~InspectNominalTessellatedShape() = default;
+
+bool InspectNominalTessellatedShape::isEmpty() const
+{
+    return nodes.empty();
+}
+
+void InspectNominalTessellatedShape::buildNode(unsigned int index,
+                                               unsigned int first,
+                                               unsigned int count)
+{
+    Base::BoundBox3f box;
+    Base::BoundBox3f centers;
+    for (unsigned int i = first; i < first + count; i++) {
+        const Triangle& tria = triangles[i];
+        box.Add(tria.points[0]);
+        box.Add(tria.points[1]);
+        box.Add(tria.points[2]);
+        centers.Add((tria.points[0] + tria.points[1] + tria.points[2]) / 3.0F);
+    }
+    nodes[index].box = box;
+
+    if (count <= maxLeafSize) {
+        nodes[index].first = first;
+        nodes[index].count = count;
+        return;
+    }
+
+    // split at the median of the longest axis of the triangle centers
+    unsigned short axis = 0;
+    if (centers.LengthY() > centers.LengthX()) {
+        axis = 1;
+    }
+    if (centers.LengthZ() > std::max(centers.LengthX(), centers.LengthY())) {
+        axis = 2;
+    }
+    auto center = [axis](const Triangle& tria) {
+        return tria.points[0][axis] + tria.points[1][axis] + tria.points[2][axis];
+    };
+    unsigned int half = count / 2;
+    std::nth_element(triangles.begin() + first,
+                     triangles.begin() + first + half,
+                     triangles.begin() + first + count,
+                     [&center](const Triangle& t1, const Triangle& t2) {
+                         return center(t1) < center(t2);
+                     });
+
+    auto child = static_cast<unsigned int>(nodes.size());
+    nodes[index].first = child;
+    nodes[index].count = 0;
+    nodes.emplace_back();
+    nodes.emplace_back();
+    buildNode(child, first, half);
+    buildNode(child + 1, first + half, count - half);
+}
+
+float InspectNominalTessellatedShape::getDistance(const Base::Vector3f& point) const
+{
+    if (nodes.empty()) {
+        return FLT_MAX;
+    }
+
+    // no need to search beyond the search radius
+    float fMinDist = searchRadius > 0 ? searchRadius : FLT_MAX;
+    float fMinDist2 = searchRadius > 0 ? searchRadius * searchRadius : FLT_MAX;
+    float alignment = 0;
+    const Triangle* nearest = nullptr;
+    auto tolerance = [](float dist) {
+        return 1.0e-5F * (1.0F + dist);
+    };
+
+    // the depth of the tree is limited because it is split at the median
+    std::array<unsigned int, 64> stack {};
+    std::size_t size = 0;
+    stack[size++] = 0;
+    while (size > 0) {
+        const Node& node = nodes[stack[--size]];
+        if (squaredDistance(node.box, point) > fMinDist2) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (unsigned int i = node.first; i < node.first + node.count; i++) {
+                const Triangle& tria = triangles[i];
+                MeshCore::MeshGeomFacet facet(tria.points[0], tria.points[1], tria.points[2]);
+                Base::Vector3f proj;
+                float fDist = facet.DistanceToPoint(point, proj);
+                if (fDist > fMinDist + tolerance(fMinDist)) {
+                    continue;
+                }
+
+                // At an edge or vertex several triangles have the same distance. Then take the
+                // one whose normal is best aligned with the point to get the right side.
+                float align = fDist > 0 ? std::fabs((point - proj) * tria.normal) / fDist : 1.0F;
+                if (fDist < fMinDist - tolerance(fMinDist) || align > alignment) {
+                    alignment = align;
+                    nearest = &tria;
+                }
+                if (fDist < fMinDist) {
+                    fMinDist = fDist;
+                    fMinDist2 = (fDist + tolerance(fDist)) * (fDist + tolerance(fDist));
+                }
+            }
+        }
+        else {
+            // visit the nearer child first
+            unsigned int nearChild = node.first;
+            unsigned int farChild = node.first + 1;
+            if (squaredDistance(nodes[farChild].box, point)
+                < squaredDistance(nodes[nearChild].box, point)) {
+                std::swap(nearChild, farChild);
+            }
+            stack[size++] = farChild;
+            stack[size++] = nearChild;
+        }
+    }
+
+    if (!nearest) {
+        return FLT_MAX;
+    }
+
+    if (refine) {
+        fMinDist = refineDistance(*nearest, point, fMinDist);
+    }
+
+    bool positive = point.DistanceToPlane(nearest->points[0], nearest->normal) >= 0;
+    return positive ? fMinDist : -fMinDist;
+}
+
+float InspectNominalTessellatedShape::refineDistance(const Triangle& tria,
+                                                     const Base::Vector3f& point,
+                                                     float dist) const
+{
+    const FaceData& face = faces[tria.face];
+    try {
+        gp_Pnt pnt3d(point.x, point.y, point.z);
+        GeomAPI_ProjectPointOnSurf proj(pnt3d, face.surface, face.u1, face.u2, face.v1, face.v2);
+        if (proj.NbPoints() > 0) {
+            auto refined = static_cast<float>(proj.LowerDistance());
+            // the projection may end outside of the trimmed face
+            if (std::fabs(refined - dist) <= deflection) {
+                return refined;
+            }
+        }
+    }
+    catch (const Standard_Failure&) {
+    }
+
+    return dist;
+}
+
+// ----------------------------------------------------------------
+
 TYPESYSTEM_SOURCE(Inspection::PropertyDistanceList, App::PropertyLists)
 
 PropertyDistanceList::PropertyDistanceList() = default;
@@ -689,9 +937,9 @@ void PropertyDistanceList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyDistanceList::getMemSize() const
+std::size_t PropertyDistanceList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    return _lValueList.size() * sizeof(float);
 }
 
 // ----------------------------------------------------------------
@@ -832,9 +1080,17 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
-            nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            auto shape = new InspectNominalTessellatedShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            if (!shape->isEmpty()) {
+                nominal = shape;
+            }
+            else {
+                // no faces to tessellate, e.g. wires or vertexes
+                delete shape;
+                useMultithreading = false;
+                nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
+            }
         }
 
         if (nominal) {
@@ -23,8 +23,11 @@
 #ifndef INSPECTION_FEATURE_H
 #define INSPECTION_FEATURE_H
 
+#include <vector>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
+#include <Base/BoundBox.h>
 
 #include <Mod/Inspection/InspectionGlobal.h>
 #include <Mod/Points/App/Points.h>
@@ -176,6 +179,49 @@ private:
     bool isSolid {false};
 };
 
+/** Calculates the distance to a shape using its triangulation.
+ * The shape is tessellated once and a bounding volume hierarchy is built over
+ * the triangles. The nearest triangle gives an approximate distance which can
+ * optionally be refined by projecting the point onto the surface of the
+ * underlying face. Unlike InspectNominalShape this class is thread-safe.
+ */
+class InspectionExport InspectNominalTessellatedShape: public InspectNominalGeometry
+{
+public:
+    InspectNominalTessellatedShape(const TopoDS_Shape&, float offset, bool refine = true);
+    ~InspectNominalTessellatedShape() override;
+    float getDistance(const Base::Vector3f&) const override;
+    /// Returns true if the shape has no triangulated faces
+    bool isEmpty() const;
+
+private:
+    struct Triangle
+    {
+        Base::Vector3f points[3];
+        Base::Vector3f normal;
+        int face;
+    };
+    struct Node
+    {
+        Base::BoundBox3f box;
+        // for a leaf the range of triangles, otherwise the index of the first child
+        unsigned int first {0};
+        unsigned int count {0};
+    };
+    struct FaceData;
+
+    void buildNode(unsigned int index, unsigned int first, unsigned int count);
+    float refineDistance(const Triangle&, const Base::Vector3f&, float) const;
+
+private:
+    std::vector<Triangle> triangles;
+    std::vector<Node> nodes;
+    std::vector<FaceData> faces;
+    float searchRadius;
+    float deflection {0};
+    bool refine;
+};
+
 class InspectionExport PropertyDistanceList: public App::PropertyLists
 {
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
@@ -228,7 +274,7 @@ public:
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 private:
     std::vector<float> _lValueList;
@@ -27,6 +27,8 @@
 #include <QMetaType>
 #include <QRegularExpression>
 #include <QString>
+#include <QtConcurrentMap>
+#include <vector>
 #endif
 
 #include <App/Application.h>
@@ -386,19 +388,41 @@ MaterialLoader::getMaterialFromYAML(const std::shared_ptr<MaterialLibrary>& libr
     return model;
 }
 
+void MaterialLoader::readMaterialFile(MaterialFile& file)
+{
+    if (MaterialConfigLoader::isConfigStyle(file.path)) {
+        file.configStyle = true;
+        return;
+    }
+
+    Base::FileInfo info(file.path.toStdString());
+    Base::ifstream fin(info);
+    if (!fin) {
+        file.opened = false;
+        return;
+    }
+
+    try {
+        file.yamlroot = YAML::Load(fin);
+    }
+    catch (YAML::Exception const& e) {
+        file.error = e.what();
+    }
+}
+
 std::shared_ptr<MaterialEntry>
-MaterialLoader::getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library,
-                                    const QString& path) const
+MaterialLoader::getMaterialFromFile(const std::shared_ptr<MaterialLibrary>& library,
+                                    MaterialFile& file) const
 {
     std::shared_ptr<MaterialEntry> model = nullptr;
 
     // Used for debugging
-    std::string pathName = path.toStdString();
+    std::string pathName = file.path.toStdString();
 
-    if (MaterialConfigLoader::isConfigStyle(path)) {
-        auto material = MaterialConfigLoader::getMaterialFromPath(library, path);
+    if (file.configStyle) {
+        auto material = MaterialConfigLoader::getMaterialFromPath(library, file.path);
         if (material) {
-            (*_materialMap)[material->getUUID()] = library->addMaterial(material, path);
+            (*_materialMap)[material->getUUID()] = library->addMaterial(material, file.path);
         }
 
         // Return the nullptr as there are no intermediate steps to take, such
@@ -406,27 +430,19 @@ MaterialLoader::getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& libr
         return model;
     }
 
-    Base::FileInfo info(pathName);
-    Base::ifstream fin(info);
-    if (!fin) {
+    if (!file.opened) {
         Base::Console().Error("YAML file open error: '%s'\n", pathName.c_str());
         return model;
     }
 
-    YAML::Node yamlroot;
-    try {
-        yamlroot = YAML::Load(fin);
-
-        model = getMaterialFromYAML(library, yamlroot, path);
-    }
-    catch (YAML::Exception const& e) {
+    if (!file.error.empty()) {
         Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
-        Base::Console().Error("\t'%s'\n", e.what());
-        showYaml(yamlroot);
+        Base::Console().Error("\t'%s'\n", file.error.c_str());
+        showYaml(file.yamlroot);
+        return model;
     }
 
-
-    return model;
+    return getMaterialFromYAML(library, file.yamlroot, file.path);
 }
 
 void MaterialLoader::showYaml(const YAML::Node& yaml)
@@ -517,25 +533,36 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library
         _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
     }
 
+    std::vector<MaterialFile> files;
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
-                try {
-                    auto model = getMaterialFromPath(library, file.canonicalFilePath());
-                    if (model) {
-                        (*_materialEntryMap)[model->getUUID()] = model;
-                    }
-                }
-                catch (const MaterialReadError&) {
-                    // Ignore the file. Error messages should have already been logged
-                }
+                files.emplace_back();
+                files.back().path = file.canonicalFilePath();
             }
         }
     }
 
+    // Reading and parsing the files dominates the load time of large libraries and the
+    // files are independent of each other. The materials are still created in file order
+    // on this thread.
+    QtConcurrent::blockingMap(files, &MaterialLoader::readMaterialFile);
+
+    for (auto& file : files) {
+        try {
+            auto model = getMaterialFromFile(library, file);
+            if (model) {
+                (*_materialEntryMap)[model->getUUID()] = model;
+            }
+        }
+        catch (const MaterialReadError&) {
+            // Ignore the file. Error messages should have already been logged
+        }
+    }
+
     for (auto& it : *_materialEntryMap) {
         it.second->addToTree(_materialMap);
     }
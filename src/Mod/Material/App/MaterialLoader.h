@@ -128,10 +128,22 @@ public:
 private:
     MaterialLoader();
 
+    /// A material file that is read ahead of creating its material
+    struct MaterialFile
+    {
+        QString path;
+        bool configStyle = false;
+        bool opened = true;
+        YAML::Node yamlroot;
+        std::string error;
+    };
+
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
+    /// Read and parse the file, this is safe to call from worker threads
+    static void readMaterialFile(MaterialFile& file);
     std::shared_ptr<MaterialEntry>
-    getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library, const QString& path) const;
+    getMaterialFromFile(const std::shared_ptr<MaterialLibrary>& library, MaterialFile& file) const;
     void addLibrary(const std::shared_ptr<MaterialLibrary>& model);
     void loadLibrary(const std::shared_ptr<MaterialLibrary>& library);
     void loadLibraries();
@@ -68,6 +68,7 @@
 #include <QTextStream>
 #include <QUuid>
 #include <QVector>
+#include <QtConcurrentMap>
 
 #endif  //_PreComp_
 
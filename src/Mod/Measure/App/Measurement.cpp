@@ -850,7 +850,7 @@ bool Measurement::linesAreParallel() const
     return false;
 }
 
-unsigned int Measurement::getMemSize() const
+std::size_t Measurement::getMemSize() const
 {
     return 0;
 }
@@ -24,7 +24,9 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <cstddef>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,29 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/// Splits [0, count) into one contiguous chunk per thread and calls func(begin, end) for each
+template<class Func>
+void parallel_chunks(std::size_t count, std::size_t threads, Func&& func)
+{
+    if (threads < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads);
+    for (std::size_t t = 0; t < threads; t++) {
+        std::size_t begin = count * t / threads;
+        std::size_t end = count * (t + 1) / threads;
+        futures.push_back(std::async(std::launch::async, [&func, begin, end]() {
+            func(begin, end);
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 }  // namespace MeshCore
 
 
@@ -24,10 +24,13 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <thread>
 #endif
 
 #include "Algorithm.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
@@ -71,7 +74,8 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 
 void MeshGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulGridOffsets.clear();
+    _aulGridElements.clear();
     _pclMesh = nullptr;
 }
 
@@ -129,13 +133,65 @@ void MeshGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
+    _aulGridOffsets.assign(std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+    _aulGridElements.clear();
+}
+
+void MeshGrid::FillGrid()
+{
+    const std::size_t ctGrids = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+    const std::size_t ctElements = HasElements();
+
+    // Use a few thousand elements per thread at least
+    const std::size_t minElementsPerThread = 10000;
+    std::size_t threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    threads = std::min(threads, ctElements / minElementsPerThread + 1);
+
+    // Count the elements of each grid element
+    std::vector<std::atomic<std::size_t>> counts(ctGrids);
+    parallel_chunks(ctElements, threads, [this, &counts](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> indices;
+        for (std::size_t i = begin; i < end; i++) {
+            indices.clear();
+            GetGridIndices(static_cast<ElementIndex>(i), indices);
+            for (unsigned long index : indices) {
+                counts[index].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    // Compute the offsets and re-use the counters as insert positions
+    _aulGridOffsets.resize(ctGrids + 1);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < ctGrids; i++) {
+        _aulGridOffsets[i] = total;
+        total += counts[i].load(std::memory_order_relaxed);
+        counts[i].store(_aulGridOffsets[i], std::memory_order_relaxed);
+    }
+    _aulGridOffsets[ctGrids] = total;
+
+    // Scatter the element indices into their grid elements
+    _aulGridElements.resize(total);
+    parallel_chunks(ctElements, threads, [this, &counts](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> indices;
+        for (std::size_t i = begin; i < end; i++) {
+            indices.clear();
+            GetGridIndices(static_cast<ElementIndex>(i), indices);
+            for (unsigned long index : indices) {
+                std::size_t pos = counts[index].fetch_add(1, std::memory_order_relaxed);
+                _aulGridElements[pos] = static_cast<ElementIndex>(i);
+            }
         }
+    });
+
+    // With several threads the order inside a grid element is arbitrary
+    if (threads > 1) {
+        parallel_chunks(ctGrids, threads, [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::sort(_aulGridElements.begin() + _aulGridOffsets[i],
+                          _aulGridElements.begin() + _aulGridOffsets[i + 1]);
+            }
+        });
     }
 }
 
@@ -159,9 +215,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                ElementSpan span = GetElementSpan(i, j, k);
+                raulElements.insert(raulElements.end(), span.begin(), span.end());
             }
         }
     }
@@ -201,9 +256,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    ElementSpan span = GetElementSpan(i, j, k);
+                    raulElements.insert(raulElements.end(), span.begin(), span.end());
                 }
             }
         }
@@ -238,7 +292,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                ElementSpan span = GetElementSpan(i, j, k);
+                raulElements.insert(span.begin(), span.end());
             }
         }
     }
@@ -462,7 +517,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, indices);
                         }
                     }
                     nX++;
@@ -474,7 +529,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, indices);
                         }
                     }
                     nX++;
@@ -486,7 +541,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, indices);
                         }
                     }
                     nY++;
@@ -498,7 +553,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, indices);
                         }
                     }
                     nY--;
@@ -510,7 +565,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, indices);
                         }
                     }
                     nZ++;
@@ -522,7 +577,7 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt,
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, indices);
                         }
                     }
                     nZ--;
@@ -610,10 +665,10 @@ unsigned long MeshGrid::GetElements(unsigned long ulX,
                                     unsigned long ulZ,
                                     std::set<ElementIndex>& raclInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
+    ElementSpan span = GetElementSpan(ulX, ulY, ulZ);
+    if (!span.empty()) {
+        raclInd.insert(span.begin(), span.end());
+        return span.size();
     }
 
     return 0;
@@ -629,9 +684,8 @@ unsigned long MeshGrid::GetElements(const Base::Vector3f& rclPoint,
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    ElementSpan span = GetElementSpan(ulX, ulY, ulZ);
+    aulFacets.assign(span.begin(), span.end());
     return aulFacets.size();
 }
 
@@ -748,12 +802,43 @@ void MeshFacetGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
+    FillGrid();
+}
 
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
+void MeshFacetGrid::GetGridIndices(ElementIndex ulFacetIndex,
+                                   std::vector<unsigned long>& raulIndices) const
+{
+    unsigned long ulX1 {};
+    unsigned long ulY1 {};
+    unsigned long ulZ1 {};
+    unsigned long ulX2 {};
+    unsigned long ulY2 {};
+    unsigned long ulZ2 {};
+
+    MeshGeomFacet clFacet = _pclMesh->GetFacet(ulFacetIndex);
+    Base::BoundBox3f clBB;
+
+    clBB.Add(clFacet._aclPoints[0]);
+    clBB.Add(clFacet._aclPoints[1]);
+    clBB.Add(clFacet._aclPoints[2]);
+
+    Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
+    Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
+
+    // falls Facet ueber mehrere BB reicht
+    if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
+        for (unsigned long ulX = ulX1; ulX <= ulX2; ulX++) {
+            for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
+                for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
+                    if (clFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
+                        raulIndices.push_back(static_cast<unsigned long>(GridIndex(ulX, ulY, ulZ)));
+                    }
+                }
+            }
+        }
+    }
+    else {
+        raulIndices.push_back(static_cast<unsigned long>(GridIndex(ulX1, ulY1, ulZ1)));
     }
 }
 
@@ -985,8 +1070,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(unsigned long ulX,
                                              float& rfMinDist,
                                              ElementIndex& rulFacetInd) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    for (ElementIndex pI : GetElementSpan(ulX, ulY, ulZ)) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
@@ -1029,15 +1113,15 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
             std::max<unsigned long>(static_cast<unsigned long>(clBBMesh.LengthZ() / fGridLen), 1));
 }
 
-void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
+void MeshPointGrid::GetGridIndices(ElementIndex ulPtIndex,
+                                   std::vector<unsigned long>& raulIndices) const
 {
-    (void)fEpsilon;
     unsigned long ulX {};
     unsigned long ulY {};
     unsigned long ulZ {};
-    Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
+    Pos(_pclMesh->GetPoint(ulPtIndex), ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        raulIndices.push_back(static_cast<unsigned long>(GridIndex(ulX, ulY, ulZ)));
     }
 }
 
@@ -1094,13 +1178,7 @@ void MeshPointGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    MeshPointIterator cPIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
-        AddPoint(*cPIter, i++);
-    }
+    FillGrid();
 }
 
 void MeshPointGrid::Pos(const Base::Vector3f& rclPoint,
@@ -1165,9 +1243,7 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        GetElements(raulElements);
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1182,9 +1258,7 @@ bool MeshGridIterator::InitOnRay(const Base::Vector3f& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            GetElements(raulElements);
             _bValidRay = true;
         }
     }
@@ -1248,9 +1322,7 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        GetElements(raulElements);
     }
     else {
         _bValidRay = false;  // Beam leaked
@@ -23,7 +23,9 @@
 #ifndef MESH_GRID_H
 #define MESH_GRID_H
 
+#include <cstddef>
 #include <set>
+#include <vector>
 
 #include <Base/BoundBox.h>
 
@@ -71,6 +73,30 @@ public:
     /// Destruction
     virtual ~MeshGrid() = default;
 
+    /** Read-only view on the element indices stored in one grid element. */
+    struct ElementSpan
+    {
+        const ElementIndex* first;
+        const ElementIndex* last;
+
+        const ElementIndex* begin() const
+        {
+            return first;
+        }
+        const ElementIndex* end() const
+        {
+            return last;
+        }
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+        bool empty() const
+        {
+            return first == last;
+        }
+    };
+
 public:
     /** Attaches the mesh kernel to this grid, an already attached mesh gets detached. The grid gets
      * rebuilt automatically. */
@@ -109,6 +135,9 @@ public:
                               std::set<ElementIndex>& raclInd) const;
     unsigned long GetElements(const Base::Vector3f& rclPoint,
                               std::vector<ElementIndex>& aulFacets) const;
+    /** Returns the indices of the elements in the given grid without copying them. The indices
+     * are sorted in ascending order. */
+    inline ElementSpan GetElementSpan(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const;
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -151,7 +180,7 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(GetElementSpan(ulX, ulY, ulZ).size());
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -192,12 +221,25 @@ protected:
     virtual void RebuildGrid() = 0;
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
+    /** Appends to \a raulIndices the indices (see GetIndexToPosition()) of all grid elements the
+     * element \a ulIndex must be stored in. Must be implemented in sub-classes. */
+    virtual void GetGridIndices(ElementIndex ulIndex,
+                                std::vector<unsigned long>& raulIndices) const = 0;
+    /** Fills the grid structure with all elements of the mesh. The elements are counted and then
+     * scattered into the grid elements on several threads. */
+    void FillGrid();
+    /** Returns the index of a valid grid position. */
+    std::size_t GridIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+    {
+        return (std::size_t(ulZ) * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+    }
 
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>>
-        _aulGrid;                /**< Grid data structure. */
-    const MeshKernel* _pclMesh;  /**< The mesh kernel. */
+    std::vector<std::size_t>
+        _aulGridOffsets; /**< Start of each grid element in _aulGridElements, plus the end. */
+    std::vector<ElementIndex> _aulGridElements; /**< Element indices of all grid elements. */
+    const MeshKernel* _pclMesh;                 /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
     unsigned long _ulCtGridsY;   /**< Number of grid elements in z. */
@@ -284,11 +326,10 @@ protected:
                              unsigned long& rulX,
                              unsigned long& rulY,
                              unsigned long& rulZ) const;
-    /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
-     * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
+    /** Returns the grid elements the facet \a ulFacetIndex must be added to, i.e. each grid
      * element that intersects the facet. */
-    inline void
-    AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    void GetGridIndices(ElementIndex ulFacetIndex,
+                        std::vector<unsigned long>& raulIndices) const override;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -336,9 +377,9 @@ public:
     bool Verify() const override;
 
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the mesh kernel. */
-    void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
+    /** Returns the grid element the point \a ulPtIndex must be added to. */
+    void GetGridIndices(ElementIndex ulPtIndex,
+                        std::vector<unsigned long>& raulIndices) const override;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3f& rclPoint,
              unsigned long& rulX,
@@ -370,9 +411,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        MeshGrid::ElementSpan span = _rclGrid.GetElementSpan(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), span.begin(), span.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -508,6 +548,17 @@ inline bool MeshGrid::CheckPos(unsigned long ulX, unsigned long ulY, unsigned lo
     return ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ));
 }
 
+inline MeshGrid::ElementSpan
+MeshGrid::GetElementSpan(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+{
+    std::size_t index = GridIndex(ulX, ulY, ulZ);
+    if (index + 1 >= _aulGridOffsets.size()) {
+        return {nullptr, nullptr};
+    }
+    const ElementIndex* data = _aulGridElements.data();
+    return {data + _aulGridOffsets[index], data + _aulGridOffsets[index + 1]};
+}
+
 // --------------------------------------------------------------
 
 inline void MeshFacetGrid::Pos(const Base::Vector3f& rclPoint,
@@ -560,61 +611,6 @@ inline void MeshFacetGrid::PosWithCheck(const Base::Vector3f& rclPoint,
     assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet,
-                                    ElementIndex ulFacetIndex,
-                                    float /*fEpsilon*/)
-{
-    unsigned long ulX {};
-    unsigned long ulY {};
-    unsigned long ulZ {};
-
-    unsigned long ulX1 {};
-    unsigned long ulY1 {};
-    unsigned long ulZ1 {};
-    unsigned long ulX2 {};
-    unsigned long ulY2 {};
-    unsigned long ulZ2 {};
-
-    Base::BoundBox3f clBB;
-
-    clBB.Add(rclFacet._aclPoints[0]);
-    clBB.Add(rclFacet._aclPoints[1]);
-    clBB.Add(rclFacet._aclPoints[2]);
-
-    // float fDiagonalLength = clBB.CalcDiagonalLength();
-
-    // clBB.Enlarge(fEpsilon*fDiagonalLength);
-
-    Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
-    Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
-
-    /*
-    if (ulX1 > 0) ulX1--;
-    if (ulY1 > 0) ulY1--;
-    if (ulZ1 > 0) ulZ1--;
-
-    if (ulX2 < (_ulCtGridsX-1)) ulX2++;
-    if (ulY2 < (_ulCtGridsY-1)) ulY2++;
-    if (ulZ2 < (_ulCtGridsZ-1)) ulZ2++;
-    */
-
-    // falls Facet ueber mehrere BB reicht
-    if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
-        for (ulX = ulX1; ulX <= ulX2; ulX++) {
-            for (ulY = ulY1; ulY <= ulY2; ulY++) {
-                for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
-                    if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
-                    }
-                }
-            }
-        }
-    }
-    else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
-    }
-}
-
 }  // namespace MeshCore
 
 #endif  // MESH_GRID_H
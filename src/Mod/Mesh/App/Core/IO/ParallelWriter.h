@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_IO_PARALLEL_WRITER_H
+#define MESH_IO_PARALLEL_WRITER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Base/Sequencer.h>
+
+namespace MeshCore
+{
+
+/** Formats a sequence of elements in fixed-size chunks on several threads and writes the
+ * chunks to the stream in their original order.
+ * Only one chunk per thread is kept in memory at once, and the buffers are re-used for the
+ * next round. The worker threads are started with the first round that has more than one
+ * chunk and are kept until the writer is destroyed, so a file costs one set of threads.
+ */
+class ParallelWriter
+{
+public:
+    explicit ParallelWriter(std::ostream& out, std::size_t chunkSize = 16384)
+        : _out(out)
+        , _chunkSize(std::max<std::size_t>(1, chunkSize))
+        , _buffers(threadCount())
+    {}
+
+    ~ParallelWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    ParallelWriter(const ParallelWriter&) = delete;
+    ParallelWriter(ParallelWriter&&) = delete;
+    ParallelWriter& operator=(const ParallelWriter&) = delete;
+    ParallelWriter& operator=(ParallelWriter&&) = delete;
+
+    /*!
+     * \brief Writes the elements [0, count).
+     * \param format is called as format(buffer, index) and must append the element to the
+     * buffer. It's called from several threads at once and thus must not modify shared data.
+     * \param seq is advanced by one step per element after its chunk has been written. This
+     * happens in the calling thread so that the user can still cancel.
+     */
+    template<class Func>
+    void write(std::size_t count, Func&& format, Base::SequencerLauncher* seq = nullptr)
+    {
+        const std::size_t threads = _buffers.size();
+        for (std::size_t first = 0; first < count; first += threads * _chunkSize) {
+            std::size_t last = std::min(count, first + threads * _chunkSize);
+            std::size_t chunks = (last - first + _chunkSize - 1) / _chunkSize;
+            runRound(chunks, [&](std::size_t c) {
+                std::string& buffer = _buffers[c];
+                buffer.clear();
+                std::size_t end = std::min(last, first + (c + 1) * _chunkSize);
+                for (std::size_t i = first + c * _chunkSize; i < end; i++) {
+                    format(buffer, i);
+                }
+            });
+
+            for (std::size_t c = 0; c < chunks; c++) {
+                _out.write(_buffers[c].data(), std::streamsize(_buffers[c].size()));
+            }
+            if (seq) {
+                for (std::size_t i = first; i < last; i++) {
+                    seq->next(true);  // allow to cancel
+                }
+            }
+        }
+    }
+
+    /// Appends the value in little-endian byte order
+    template<class T>
+    static void appendLittleEndian(std::string& buffer, T value)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        const uint16_t one = 1;
+        if (*reinterpret_cast<const unsigned char*>(&one) != 1) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        buffer.append(bytes, sizeof(T));
+    }
+
+    /// Sets the number of threads of writers created afterwards, 0 uses one per core
+    static void setMaxThreads(std::size_t threads)
+    {
+        maxThreads() = threads;
+    }
+
+private:
+    static std::atomic<std::size_t>& maxThreads()
+    {
+        static std::atomic<std::size_t> threads {0};
+        return threads;
+    }
+
+    static std::size_t threadCount()
+    {
+        std::size_t threads = maxThreads();
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        return std::max<std::size_t>(1, threads);
+    }
+
+    /// Calls job(c) for c in [0, chunks) on the worker threads and the calling thread
+    void runRound(std::size_t chunks, const std::function<void(std::size_t)>& job)
+    {
+        if (chunks < 2) {
+            for (std::size_t c = 0; c < chunks; c++) {
+                job(c);
+            }
+            return;
+        }
+
+        if (_threads.empty()) {
+            _threads.reserve(_buffers.size() - 1);
+            for (std::size_t t = 1; t < _buffers.size(); t++) {
+                _threads.emplace_back([this]() {
+                    workerLoop();
+                });
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _job = &job;
+            _chunks = chunks;
+            _next = 0;
+            _done = 0;
+            _error = nullptr;
+            ++_round;
+        }
+        _wake.notify_all();
+        work();
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _finished.wait(lock, [this]() {
+            return _done == _chunks;
+        });
+        _job = nullptr;
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+
+    void workerLoop()
+    {
+        std::size_t round = 0;
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _wake.wait(lock, [&]() {
+                return _stop || _round != round;
+            });
+            if (_stop) {
+                return;
+            }
+            round = _round;
+            lock.unlock();
+            work();
+            lock.lock();
+        }
+    }
+
+    /// Processes chunks of the current round until all of them are taken
+    void work()
+    {
+        for (;;) {
+            std::size_t chunk {};
+            const std::function<void(std::size_t)>* job {};
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_next >= _chunks) {
+                    return;
+                }
+                chunk = _next++;
+                job = _job;
+            }
+
+            std::exception_ptr error;
+            try {
+                (*job)(chunk);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (error && !_error) {
+                _error = error;
+            }
+            if (++_done == _chunks) {
+                _finished.notify_one();
+            }
+        }
+    }
+
+    std::ostream& _out;
+    std::size_t _chunkSize;
+    std::vector<std::string> _buffers;
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _finished;
+    const std::function<void(std::size_t)>* _job {};
+    std::size_t _chunks {};
+    std::size_t _next {};
+    std::size_t _done {};
+    std::size_t _round {};
+    std::exception_ptr _error;
+    bool _stop {};
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_PARALLEL_WRITER_H
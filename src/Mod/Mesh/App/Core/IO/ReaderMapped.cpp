@@ -0,0 +1,581 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#endif
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "Core/Functional.h"
+#include "Core/MeshIO.h"
+#include "Core/MeshKernel.h"
+
+#include "ReaderMapped.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+
+// a thread only pays off if it has enough records to parse
+constexpr std::size_t minRecordsPerThread = 100000;
+
+std::size_t numThreads(std::size_t records)
+{
+    std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    return std::max<std::size_t>(1, std::min(threads, records / minRecordsPerThread));
+}
+
+// the binary records are copied as they are, so this only works on little-endian machines
+bool isLittleEndian()
+{
+    const uint16_t value = 1;
+    unsigned char byte {};
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+
+/// Read-only mapping of a whole file. If the file cannot be mapped the size is zero.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& fileName)
+    {
+        using namespace boost::interprocess;
+        try {
+            file_mapping file(fileName.c_str(), read_only);
+            mapped_region region(file, read_only);
+            _region.swap(region);
+        }
+        catch (const interprocess_exception&) {
+            // e.g. an empty file or no permission
+        }
+    }
+
+    const char* data() const
+    {
+        return static_cast<const char*>(_region.get_address());
+    }
+    std::size_t size() const
+    {
+        return _region.get_size();
+    }
+
+private:
+    boost::interprocess::mapped_region _region;
+};
+
+std::uint64_t hashVertex(const Base::Vector3f& v)
+{
+    auto bits = [](float value) {
+        value += 0.0F;  // -0 and +0 must give the same hash
+        std::uint32_t u {};
+        std::memcpy(&u, &value, sizeof(u));
+        return std::uint64_t(u);
+    };
+
+    const std::uint64_t prime = 0x9E3779B97F4A7C15ULL;
+    std::uint64_t h = bits(v.x);
+    h = (h * prime) ^ bits(v.y);
+    h = (h * prime) ^ bits(v.z);
+    h *= prime;
+    return h ^ (h >> 29);
+}
+
+struct VertexHash
+{
+    std::size_t operator()(const Base::Vector3f& v) const
+    {
+        return static_cast<std::size_t>(hashVertex(v));
+    }
+};
+
+struct VertexEqual
+{
+    // Base::Vector3f::operator== uses a tolerance which is not allowed for hashing
+    bool operator()(const Base::Vector3f& a, const Base::Vector3f& b) const
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
+};
+
+/*!
+ * \brief Welds coincident vertices where every three consecutive vertices form a facet.
+ * The vertices are distributed over hash shards with a stable counting sort and each shard is
+ * welded on its own thread. The points are numbered in order of their first occurrence so that
+ * the result doesn't depend on the number of threads.
+ */
+void weldVertices(const std::vector<Base::Vector3f>& verts,
+                  MeshPointArray& points,
+                  MeshFacetArray& facets)
+{
+    const std::size_t count = verts.size();
+    const std::size_t threads = numThreads(count / 3);
+    const std::size_t shards = threads > 1 ? threads * 4 : 1;
+    auto chunkBegin = [count, threads](std::size_t t) {
+        return count * t / threads;
+    };
+
+    // count the vertices per chunk and shard
+    std::vector<std::uint16_t> shardOf(count);
+    std::vector<std::size_t> cursor(threads * shards, 0);
+    parallel_chunks(threads, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; t++) {
+            std::size_t* counts = &cursor[t * shards];
+            for (std::size_t i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+                auto shard = static_cast<std::uint16_t>((hashVertex(verts[i]) >> 32) % shards);
+                shardOf[i] = shard;
+                counts[shard]++;
+            }
+        }
+    });
+
+    // turn the counts into insert positions, chunk after chunk inside each shard
+    std::vector<std::size_t> shardBegin(shards + 1, 0);
+    std::size_t sum = 0;
+    for (std::size_t s = 0; s < shards; s++) {
+        shardBegin[s] = sum;
+        for (std::size_t t = 0; t < threads; t++) {
+            std::size_t num = cursor[t * shards + s];
+            cursor[t * shards + s] = sum;
+            sum += num;
+        }
+    }
+    shardBegin[shards] = sum;
+
+    std::vector<PointIndex> order(count);
+    parallel_chunks(threads, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; t++) {
+            std::size_t* pos = &cursor[t * shards];
+            for (std::size_t i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+                order[pos[shardOf[i]]++] = i;
+            }
+        }
+    });
+    std::vector<std::uint16_t>().swap(shardOf);
+
+    // inside a shard the vertices are in ascending order, so the first one wins
+    std::vector<PointIndex> firstIndex(count);
+    parallel_chunks(shards, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t s = first; s < last; s++) {
+            std::unordered_map<Base::Vector3f, PointIndex, VertexHash, VertexEqual> unique;
+            unique.reserve((shardBegin[s + 1] - shardBegin[s]) / 4);
+            for (std::size_t k = shardBegin[s]; k < shardBegin[s + 1]; k++) {
+                PointIndex i = order[k];
+                firstIndex[i] = unique.emplace(verts[i], i).first->second;
+            }
+        }
+    });
+
+    // number the unique vertices, 'order' is re-used to hold the new point indices
+    std::vector<std::size_t> numUnique(threads + 1, 0);
+    parallel_chunks(threads, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; t++) {
+            for (std::size_t i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+                if (firstIndex[i] == i) {
+                    numUnique[t + 1]++;
+                }
+            }
+        }
+    });
+    std::partial_sum(numUnique.begin(), numUnique.end(), numUnique.begin());
+
+    points.resize(numUnique[threads]);
+    parallel_chunks(threads, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; t++) {
+            PointIndex next = numUnique[t];
+            for (std::size_t i = chunkBegin(t); i < chunkBegin(t + 1); i++) {
+                if (firstIndex[i] == i) {
+                    order[i] = next;
+                    points[next] = verts[i];
+                    next++;
+                }
+            }
+        }
+    });
+
+    facets.resize(count / 3);
+    parallel_chunks(facets.size(), threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t f = first; f < last; f++) {
+            for (std::size_t c = 0; c < 3; c++) {
+                facets[f]._aulPoints[c] = order[firstIndex[3 * f + c]];
+            }
+        }
+    });
+}
+
+enum class PlyNumber
+{
+    int8,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    float32,
+    float64,
+    invalid
+};
+
+PlyNumber plyNumber(const std::string& type)
+{
+    if (type == "char" || type == "int8") {
+        return PlyNumber::int8;
+    }
+    if (type == "uchar" || type == "uint8") {
+        return PlyNumber::uint8;
+    }
+    if (type == "short" || type == "int16") {
+        return PlyNumber::int16;
+    }
+    if (type == "ushort" || type == "uint16") {
+        return PlyNumber::uint16;
+    }
+    if (type == "int" || type == "int32") {
+        return PlyNumber::int32;
+    }
+    if (type == "uint" || type == "uint32") {
+        return PlyNumber::uint32;
+    }
+    if (type == "float" || type == "float32") {
+        return PlyNumber::float32;
+    }
+    if (type == "double" || type == "float64") {
+        return PlyNumber::float64;
+    }
+    return PlyNumber::invalid;
+}
+
+std::size_t plySize(PlyNumber number)
+{
+    switch (number) {
+        case PlyNumber::int8:
+        case PlyNumber::uint8:
+            return 1;
+        case PlyNumber::int16:
+        case PlyNumber::uint16:
+            return 2;
+        case PlyNumber::int32:
+        case PlyNumber::uint32:
+        case PlyNumber::float32:
+            return 4;
+        case PlyNumber::float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+template<class T>
+float readAs(const char* data)
+{
+    T value {};
+    std::memcpy(&value, data, sizeof(T));
+    return static_cast<float>(value);
+}
+
+float plyValue(const char* data, PlyNumber number)
+{
+    switch (number) {
+        case PlyNumber::int8:
+            return readAs<int8_t>(data);
+        case PlyNumber::uint8:
+            return readAs<uint8_t>(data);
+        case PlyNumber::int16:
+            return readAs<int16_t>(data);
+        case PlyNumber::uint16:
+            return readAs<uint16_t>(data);
+        case PlyNumber::int32:
+            return readAs<int32_t>(data);
+        case PlyNumber::uint32:
+            return readAs<uint32_t>(data);
+        case PlyNumber::float32:
+            return readAs<float>(data);
+        case PlyNumber::float64:
+            return readAs<double>(data);
+        default:
+            return 0.0F;
+    }
+}
+
+struct PlyProperty
+{
+    std::string name;
+    PlyNumber number {PlyNumber::invalid};
+    std::size_t offset {};
+};
+
+}  // namespace
+
+ReaderMapped::ReaderMapped(MeshKernel& kernel, Material* material)
+    : _kernel(kernel)
+    , _material(material)
+{}
+
+bool ReaderMapped::LoadBinarySTL(const std::string& fileName)
+{
+    const std::size_t headerSize = 84;
+    const std::size_t recordSize = 50;
+
+    if (!isLittleEndian()) {
+        return false;
+    }
+
+    MappedFile file(fileName);
+    if (file.size() < headerSize) {
+        return false;
+    }
+
+    // An ASCII file or a file with trailing data doesn't match the size. Those are left to
+    // the stream reader.
+    uint32_t ulCt {};
+    std::memcpy(&ulCt, file.data() + 80, sizeof(ulCt));
+    const std::size_t ctFacets = ulCt;
+    if (file.size() != headerSize + recordSize * ctFacets) {
+        return false;
+    }
+
+    // the normal is skipped, it's recomputed from the points anyway
+    std::vector<Base::Vector3f> verts(3 * ctFacets);
+    const char* records = file.data() + headerSize;
+    parallel_chunks(ctFacets, numThreads(ctFacets), [&](std::size_t first, std::size_t last) {
+        float values[12];
+        for (std::size_t i = first; i < last; i++) {
+            std::memcpy(values, records + i * recordSize, sizeof(values));
+            for (std::size_t c = 0; c < 3; c++) {
+                Base::Vector3f& v = verts[3 * i + c];
+                v.x = values[3 * c + 3];
+                v.y = values[3 * c + 4];
+                v.z = values[3 * c + 5];
+            }
+        }
+    });
+
+    MeshPointArray points;
+    MeshFacetArray facets;
+    weldVertices(verts, points, facets);
+    std::vector<Base::Vector3f>().swap(verts);
+
+    _kernel.Adopt(points, facets, true);
+    return true;
+}
+
+bool ReaderMapped::LoadBinaryPLY(const std::string& fileName)
+{
+    if (!isLittleEndian()) {
+        return false;
+    }
+
+    MappedFile file(fileName);
+    std::string_view content(file.data(), file.size());
+    if (content.substr(0, 4) != "ply\n" && content.substr(0, 5) != "ply\r\n") {
+        return false;
+    }
+
+    std::size_t headerEnd = content.find("end_header");
+    if (headerEnd == std::string_view::npos) {
+        return false;
+    }
+    headerEnd = content.find('\n', headerEnd);
+    if (headerEnd == std::string_view::npos) {
+        return false;
+    }
+    headerEnd++;
+
+    // Only the layout written by most scanners and by MeshOutput is handled: a vertex element
+    // with scalar properties followed by a face element with a single list of indices.
+    std::istringstream header(std::string(content.substr(0, headerEnd)));
+    std::vector<PlyProperty> vertexProps;
+    std::size_t vertexSize = 0;
+    std::size_t numVertices = 0;
+    std::size_t numFaces = 0;
+    bool littleEndian = false;
+    bool faceList = false;
+    std::string element;
+    std::string line;
+    while (std::getline(header, line)) {
+        std::istringstream str(line);
+        std::string kw;
+        str >> kw;
+        if (kw == "format") {
+            std::string format, version;
+            str >> format >> version;
+            littleEndian = (format == "binary_little_endian" && version == "1.0");
+        }
+        else if (kw == "element") {
+            std::size_t count {};
+            str >> element >> count;
+            if (element == "vertex" && numVertices == 0 && numFaces == 0) {
+                numVertices = count;
+            }
+            else if (element == "face" && numFaces == 0) {
+                numFaces = count;
+            }
+            else {
+                return false;
+            }
+        }
+        else if (kw == "property") {
+            std::string type, name;
+            str >> type;
+            if (element == "vertex" && type != "list") {
+                str >> name;
+                PlyProperty prop {name, plyNumber(type), vertexSize};
+                if (prop.number == PlyNumber::invalid) {
+                    return false;
+                }
+                if (name.compare(0, 8, "diffuse_") == 0) {
+                    prop.name = name.substr(8);
+                }
+                vertexSize += plySize(prop.number);
+                vertexProps.push_back(prop);
+            }
+            else if (element == "face" && type == "list" && !faceList) {
+                std::string countType, indexType;
+                str >> countType >> indexType >> name;
+                if (plyNumber(countType) != PlyNumber::uint8
+                    || plySize(plyNumber(indexType)) != 4
+                    || plyNumber(indexType) == PlyNumber::float32
+                    || (name != "vertex_indices" && name != "vertex_index")) {
+                    return false;
+                }
+                faceList = true;
+            }
+            else {
+                return false;
+            }
+        }
+    }
+
+    auto findProperty = [&vertexProps](const char* name) -> const PlyProperty* {
+        auto it = std::find_if(vertexProps.begin(),
+                               vertexProps.end(),
+                               [name](const PlyProperty& prop) {
+                                   return prop.name == name;
+                               });
+        return it != vertexProps.end() ? &(*it) : nullptr;
+    };
+
+    const PlyProperty* px = findProperty("x");
+    const PlyProperty* py = findProperty("y");
+    const PlyProperty* pz = findProperty("z");
+    if (!littleEndian || !faceList || !px || !py || !pz) {
+        return false;
+    }
+
+    const std::size_t faceSize = 1 + 3 * sizeof(uint32_t);
+    if (content.size() < headerEnd + numVertices * vertexSize + numFaces * faceSize) {
+        return false;
+    }
+
+    const PlyProperty* pr = findProperty("red");
+    const PlyProperty* pg = findProperty("green");
+    const PlyProperty* pb = findProperty("blue");
+    const bool colors = _material && pr && pg && pb;
+
+    const char* vertexData = file.data() + headerEnd;
+    MeshPointArray meshPoints(numVertices);
+    std::vector<App::Color> diffuseColor(colors ? numVertices : 0);
+    parallel_chunks(numVertices,
+                    numThreads(numVertices),
+                    [&](std::size_t first, std::size_t last) {
+                        for (std::size_t i = first; i < last; i++) {
+                            const char* record = vertexData + i * vertexSize;
+                            MeshPoint& pt = meshPoints[i];
+                            pt.x = plyValue(record + px->offset, px->number);
+                            pt.y = plyValue(record + py->offset, py->number);
+                            pt.z = plyValue(record + pz->offset, pz->number);
+                            if (colors) {
+                                float r = plyValue(record + pr->offset, pr->number);
+                                float g = plyValue(record + pg->offset, pg->number);
+                                float b = plyValue(record + pb->offset, pb->number);
+                                diffuseColor[i] = App::Color(r / 255.0F, g / 255.0F, b / 255.0F);
+                            }
+                        }
+                    });
+
+    // faces with a wrong vertex index are dropped like the stream reader does
+    const char* faceData = vertexData + numVertices * vertexSize;
+    MeshFacetArray meshFacets(numFaces);
+    std::atomic<bool> triangles {true};
+    parallel_chunks(numFaces, numThreads(numFaces), [&](std::size_t first, std::size_t last) {
+        uint32_t index[3];
+        for (std::size_t i = first; i < last; i++) {
+            const char* record = faceData + i * faceSize;
+            if (static_cast<unsigned char>(record[0]) != 3) {
+                triangles = false;
+                return;
+            }
+            std::memcpy(index, record + 1, sizeof(index));
+            MeshFacet& facet = meshFacets[i];
+            if (index[0] < numVertices && index[1] < numVertices && index[2] < numVertices) {
+                facet.SetVertices(index[0], index[1], index[2]);
+            }
+            else {
+                facet.SetVertices(POINT_INDEX_MAX, POINT_INDEX_MAX, POINT_INDEX_MAX);
+            }
+        }
+    });
+
+    // polygons have records of different size, so they must go through the stream reader
+    if (!triangles) {
+        return false;
+    }
+
+    meshFacets.erase(std::remove_if(meshFacets.begin(),
+                                    meshFacets.end(),
+                                    [](const MeshFacet& facet) {
+                                        return facet._aulPoints[0] == POINT_INDEX_MAX;
+                                    }),
+                     meshFacets.end());
+
+    if (colors) {
+        _material->binding = MeshIO::PER_VERTEX;
+        _material->diffuseColor.swap(diffuseColor);
+    }
+
+    _kernel.Clear();  // remove all data before
+
+    MeshCleanup meshCleanup(meshPoints, meshFacets);
+    if (_material) {
+        meshCleanup.SetMaterial(_material);
+    }
+    meshCleanup.RemoveInvalids();
+    MeshPointFacetAdjacency meshAdj(meshPoints.size(), meshFacets);
+    meshAdj.SetFacetNeighbourhood();
+    _kernel.Adopt(meshPoints, meshFacets);
+
+    return true;
+}
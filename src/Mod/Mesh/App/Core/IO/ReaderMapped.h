@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef MESH_IO_READER_MAPPED_H
+#define MESH_IO_READER_MAPPED_H
+
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/MeshGlobal.h>
+#include <string>
+
+namespace MeshCore
+{
+
+class MeshKernel;
+struct Material;
+
+/** Loads binary STL and PLY files by memory-mapping them and parsing the fixed-size records
+ * on several threads.
+ * Only the common layouts are handled. For anything else the Load functions return false
+ * without touching the kernel, and the stream based readers of MeshInput must be used instead.
+ */
+class MeshExport ReaderMapped
+{
+public:
+    /*!
+     * \brief ReaderMapped
+     */
+    explicit ReaderMapped(MeshKernel& kernel, Material*);
+    /*!
+     * \brief Load a binary STL file. Coincident vertices are welded with a parallel hash.
+     * \return true on success and false if the file is not a binary STL
+     */
+    bool LoadBinarySTL(const std::string& fileName);
+    /*!
+     * \brief Load a little-endian binary PLY file that only consists of triangles.
+     * \return true on success and false if the file has a layout that is not supported
+     */
+    bool LoadBinaryPLY(const std::string& fileName);
+
+private:
+    MeshKernel& _kernel;
+    Material* _material;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_READER_MAPPED_H
@@ -22,11 +22,14 @@
 
 #include "PreCompiled.h"
 
+#include <fmt/format.h>
+
 #include "Core/Iterator.h"
 #include <Base/Console.h>
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
 
+#include "ParallelWriter.h"
 #include "WriterOBJ.h"
 
 
@@ -119,52 +122,50 @@ bool WriterOBJ::Save(std::ostream& out)
     out.precision(6);
     out.setf(std::ios::fixed | std::ios::showpoint);
 
-    // vertices
-    Base::Vector3f pt;
-    std::size_t index = 0;
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        if (this->apply_transform) {
-            pt = this->_transform * *it;
-        }
-        else {
-            pt.Set(it->x, it->y, it->z);
-        }
+    // vertices and normals are formatted on several threads
+    ParallelWriter writer(out);
+    writer.write(
+        rPoints.size(),
+        [&](std::string& buffer, std::size_t index) {
+            Base::Vector3f pt = rPoints[index];
+            if (this->apply_transform) {
+                pt = this->_transform * pt;
+            }
 
-        if (exportColorPerVertex) {
-            App::Color c;
-            if (_material->binding == MeshIO::PER_VERTEX) {
-                c = _material->diffuseColor[index];
+            auto it = std::back_inserter(buffer);
+            if (exportColorPerVertex) {
+                App::Color c;
+                if (_material->binding == MeshIO::PER_VERTEX) {
+                    c = _material->diffuseColor[index];
+                }
+                else {
+                    c = _material->diffuseColor.front();
+                }
+
+                int r = static_cast<int>(c.r * 255.0F);
+                int g = static_cast<int>(c.g * 255.0F);
+                int b = static_cast<int>(c.b * 255.0F);
+
+                fmt::format_to(it, "v {:.6f} {:.6f} {:.6f} {} {} {}\n", pt.x, pt.y, pt.z, r, g, b);
             }
             else {
-                c = _material->diffuseColor.front();
+                fmt::format_to(it, "v {:.6f} {:.6f} {:.6f}\n", pt.x, pt.y, pt.z);
             }
+        },
+        &seq);
 
-            int r = static_cast<int>(c.r * 255.0F);
-            int g = static_cast<int>(c.g * 255.0F);
-            int b = static_cast<int>(c.b * 255.0F);
-
-            out << "v " << pt.x << " " << pt.y << " " << pt.z << " " << r << " " << g << " " << b
-                << '\n';
-        }
-        else {
-            out << "v " << pt.x << " " << pt.y << " " << pt.z << '\n';
-        }
-        seq.next(true);  // allow to cancel
-    }
     // Export normals
-    MeshFacetIterator clIter(_kernel), clEnd(_kernel);
-    const MeshGeomFacet* pclFacet {};
-
-    clIter.Begin();
-    clEnd.End();
-
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-        out << "vn " << pclFacet->GetNormal().x << " " << pclFacet->GetNormal().y << " "
-            << pclFacet->GetNormal().z << '\n';
-        ++clIter;
-        seq.next(true);  // allow to cancel
-    }
+    writer.write(
+        rFacets.size(),
+        [this](std::string& buffer, std::size_t index) {
+            Base::Vector3f normal = _kernel.GetFacet(index).GetNormal();
+            fmt::format_to(std::back_inserter(buffer),
+                           "vn {:.6f} {:.6f} {:.6f}\n",
+                           normal.x,
+                           normal.y,
+                           normal.z);
+        },
+        &seq);
 
     if (_groups.empty()) {
         if (exportColorPerFace) {
@@ -196,14 +197,21 @@ bool WriterOBJ::Save(std::ostream& out)
         }
         else {
             // facet indices (no texture and normal indices)
-            std::size_t faceIdx = 1;
-            for (const auto& it : rFacets) {
-                out << "f " << it._aulPoints[0] + 1 << "//" << faceIdx << " "
-                    << it._aulPoints[1] + 1 << "//" << faceIdx << " " << it._aulPoints[2] + 1
-                    << "//" << faceIdx << '\n';
-                seq.next(true);  // allow to cancel
-                faceIdx++;
-            }
+            writer.write(
+                rFacets.size(),
+                [&rFacets](std::string& buffer, std::size_t index) {
+                    const MeshFacet& f = rFacets[index];
+                    std::size_t faceIdx = index + 1;
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "f {}//{} {}//{} {}//{}\n",
+                                   f._aulPoints[0] + 1,
+                                   faceIdx,
+                                   f._aulPoints[1] + 1,
+                                   faceIdx,
+                                   f._aulPoints[2] + 1,
+                                   faceIdx);
+                },
+                &seq);
         }
     }
     else {
@@ -35,8 +35,11 @@
 #include <boost/convert/spirit.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
+#include <fmt/format.h>
 
 #include "IO/Reader3MF.h"
+#include "IO/ParallelWriter.h"
+#include "IO/ReaderMapped.h"
 #include "IO/ReaderOBJ.h"
 #include "IO/Writer3MF.h"
 #include "IO/WriterInventor.h"
@@ -240,7 +243,9 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
-        ok = LoadSTL(str);
+        // binary files are mapped into memory and parsed in parallel
+        ReaderMapped reader(_rclMesh, _material);
+        ok = reader.LoadBinarySTL(fi.filePath()) || LoadSTL(str);
     }
     else if (fi.hasExtension("iv")) {
         ok = LoadInventor(str);
@@ -270,7 +275,8 @@ bool MeshInput::LoadAny(const char* FileName)
         ok = LoadOFF(str);
     }
     else if (fi.hasExtension("ply")) {
-        ok = LoadPLY(str);
+        ReaderMapped reader(_rclMesh, _material);
+        ok = reader.LoadBinaryPLY(fi.filePath()) || LoadPLY(str);
     }
     else {
         throw Base::FileException("File extension not supported", FileName);
@@ -1787,6 +1793,27 @@ void MeshOutput::Transform(const Base::Matrix4D& mat)
     }
 }
 
+Base::Vector3f MeshOutput::GetTransformedPoint(PointIndex index) const
+{
+    const MeshPoint& pnt = _rclMesh.GetPoints()[index];
+    if (this->apply_transform) {
+        return this->_transform * pnt;
+    }
+    return pnt;
+}
+
+MeshGeomFacet MeshOutput::GetTransformedFacet(FacetIndex index) const
+{
+    MeshGeomFacet facet = _rclMesh.GetFacet(index);
+    if (this->apply_transform) {
+        for (auto& pnt : facet._aclPoints) {
+            pnt = this->_transform * pnt;
+        }
+        facet.NormalInvalid();
+    }
+    return facet;
+}
+
 std::vector<std::string> MeshOutput::supportedMeshFormats()
 {
     std::vector<std::string> fmt;
@@ -2086,16 +2113,10 @@ bool MeshOutput::SaveFormat(std::ostream& str, MeshIO::Format fmt) const
 /** Saves the mesh object into an ASCII file. */
 bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
 {
-    MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
-    clIter.Transform(this->_transform);
-    const MeshGeomFacet* pclFacet {};
-
     if (!output || output.bad() || _rclMesh.CountFacets() == 0) {
         return false;
     }
 
-    output.precision(6);
-    output.setf(std::ios::fixed | std::ios::showpoint);
     Base::SequencerLauncher seq("saving...", _rclMesh.CountFacets() + 1);
 
     if (this->objectName.empty()) {
@@ -2105,27 +2126,26 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
         output << "solid " << this->objectName << '\n';
     }
 
-    clIter.Begin();
-    clEnd.End();
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-
-        // normal
-        output << "  facet normal " << pclFacet->GetNormal().x << " " << pclFacet->GetNormal().y
-               << " " << pclFacet->GetNormal().z << '\n';
-        output << "    outer loop\n";
-
-        // vertices
-        for (const auto& pnt : pclFacet->_aclPoints) {
-            output << "      vertex " << pnt.x << " " << pnt.y << " " << pnt.z << '\n';
-        }
-
-        output << "    endloop\n";
-        output << "  endfacet\n";
-
-        ++clIter;
-        seq.next(true);  // allow to cancel
-    }
+    // the facets are formatted on several threads, fmt gives the same output as the
+    // fixed notation with a precision of 6 that was used with the stream
+    ParallelWriter writer(output);
+    writer.write(
+        _rclMesh.CountFacets(),
+        [this](std::string& buffer, std::size_t index) {
+            MeshGeomFacet facet = GetTransformedFacet(index);
+            Base::Vector3f normal = facet.GetNormal();
+            auto out = std::back_inserter(buffer);
+            fmt::format_to(out,
+                           "  facet normal {:.6f} {:.6f} {:.6f}\n    outer loop\n",
+                           normal.x,
+                           normal.y,
+                           normal.z);
+            for (const auto& pnt : facet._aclPoints) {
+                fmt::format_to(out, "      vertex {:.6f} {:.6f} {:.6f}\n", pnt.x, pnt.y, pnt.z);
+            }
+            buffer.append("    endloop\n  endfacet\n");
+        },
+        &seq);
 
     output << "endsolid Mesh\n";
 
@@ -2135,10 +2155,6 @@ bool MeshOutput::SaveAsciiSTL(std::ostream& output) const
 /** Saves the mesh object into a binary file. */
 bool MeshOutput::SaveBinarySTL(std::ostream& output) const
 {
-    MeshFacetIterator clIter(_rclMesh), clEnd(_rclMesh);
-    clIter.Transform(this->_transform);
-    const MeshGeomFacet* pclFacet {};
-    uint16_t usAtt {};
     char szInfo[81];
 
     if (!output || output.bad() /*|| _rclMesh.CountFacets() == 0*/) {
@@ -2154,30 +2170,28 @@ bool MeshOutput::SaveBinarySTL(std::ostream& output) const
     uint32_t uCtFts = (uint32_t)_rclMesh.CountFacets();
     output.write((const char*)&uCtFts, sizeof(uCtFts));
 
-    usAtt = 0;
-    clIter.Begin();
-    clEnd.End();
-    while (clIter < clEnd) {
-        pclFacet = &(*clIter);
-        // normal
-        Base::Vector3f normal = pclFacet->GetNormal();
-        output.write((const char*)&(normal.x), sizeof(float));
-        output.write((const char*)&(normal.y), sizeof(float));
-        output.write((const char*)&(normal.z), sizeof(float));
-
-        // vertices
-        for (uint32_t i = 0; i < 3; i++) {
-            output.write((const char*)&(pclFacet->_aclPoints[i].x), sizeof(float));
-            output.write((const char*)&(pclFacet->_aclPoints[i].y), sizeof(float));
-            output.write((const char*)&(pclFacet->_aclPoints[i].z), sizeof(float));
-        }
-
-        // attribute
-        output.write((const char*)&usAtt, sizeof(usAtt));
+    ParallelWriter writer(output);
+    writer.write(
+        _rclMesh.CountFacets(),
+        [this](std::string& buffer, std::size_t index) {
+            MeshGeomFacet facet = GetTransformedFacet(index);
+            // normal
+            Base::Vector3f normal = facet.GetNormal();
+            ParallelWriter::appendLittleEndian(buffer, normal.x);
+            ParallelWriter::appendLittleEndian(buffer, normal.y);
+            ParallelWriter::appendLittleEndian(buffer, normal.z);
+
+            // vertices
+            for (const auto& pnt : facet._aclPoints) {
+                ParallelWriter::appendLittleEndian(buffer, pnt.x);
+                ParallelWriter::appendLittleEndian(buffer, pnt.y);
+                ParallelWriter::appendLittleEndian(buffer, pnt.z);
+            }
 
-        ++clIter;
-        seq.next(true);  // allow to cancel
-    }
+            // attribute
+            ParallelWriter::appendLittleEndian(buffer, uint16_t(0));
+        },
+        &seq);
 
     return true;
 }
@@ -2479,36 +2493,26 @@ bool MeshOutput::SaveBinaryPLY(std::ostream& out) const
         << "property list uchar int vertex_index\n"
         << "end_header\n";
 
-    Base::OutputStream os(out);
-    os.setByteOrder(Base::Stream::LittleEndian);
-
-    for (std::size_t i = 0; i < v_count; i++) {
-        const MeshPoint& p = rPoints[i];
-        if (this->apply_transform) {
-            Base::Vector3f pt = this->_transform * p;
-            os << pt.x << pt.y << pt.z;
-        }
-        else {
-            os << p.x << p.y << p.z;
-        }
+    ParallelWriter writer(out);
+    writer.write(v_count, [&](std::string& buffer, std::size_t index) {
+        Base::Vector3f pt = GetTransformedPoint(index);
+        ParallelWriter::appendLittleEndian(buffer, pt.x);
+        ParallelWriter::appendLittleEndian(buffer, pt.y);
+        ParallelWriter::appendLittleEndian(buffer, pt.z);
         if (saveVertexColor) {
-            const App::Color& c = _material->diffuseColor[i];
-            uint8_t r = uint8_t(255.0F * c.r);
-            uint8_t g = uint8_t(255.0F * c.g);
-            uint8_t b = uint8_t(255.0F * c.b);
-            os << r << g << b;
-        }
-    }
-    unsigned char n = 3;
-    int f1 {}, f2 {}, f3 {};
-    for (std::size_t i = 0; i < f_count; i++) {
-        const MeshFacet& f = rFacets[i];
-        f1 = (int)f._aulPoints[0];
-        f2 = (int)f._aulPoints[1];
-        f3 = (int)f._aulPoints[2];
-        os << n;
-        os << f1 << f2 << f3;
-    }
+            const App::Color& c = _material->diffuseColor[index];
+            buffer.push_back(char(uint8_t(255.0F * c.r)));
+            buffer.push_back(char(uint8_t(255.0F * c.g)));
+            buffer.push_back(char(uint8_t(255.0F * c.b)));
+        }
+    });
+    writer.write(f_count, [&rFacets](std::string& buffer, std::size_t index) {
+        const MeshFacet& f = rFacets[index];
+        buffer.push_back(char(3));
+        ParallelWriter::appendLittleEndian(buffer, int32_t(f._aulPoints[0]));
+        ParallelWriter::appendLittleEndian(buffer, int32_t(f._aulPoints[1]));
+        ParallelWriter::appendLittleEndian(buffer, int32_t(f._aulPoints[2]));
+    });
 
     return true;
 }
@@ -2541,48 +2545,28 @@ bool MeshOutput::SaveAsciiPLY(std::ostream& out) const
         << "property list uchar int vertex_index\n"
         << "end_header\n";
 
-    out.precision(6);
-    out.setf(std::ios::fixed | std::ios::showpoint);
-    if (saveVertexColor) {
-        for (std::size_t i = 0; i < v_count; i++) {
-            const MeshPoint& p = rPoints[i];
-            if (this->apply_transform) {
-                Base::Vector3f pt = this->_transform * p;
-                out << pt.x << " " << pt.y << " " << pt.z;
-            }
-            else {
-                out << p.x << " " << p.y << " " << p.z;
-            }
-
-            const App::Color& c = _material->diffuseColor[i];
+    ParallelWriter writer(out);
+    writer.write(v_count, [&](std::string& buffer, std::size_t index) {
+        Base::Vector3f pt = GetTransformedPoint(index);
+        auto it = std::back_inserter(buffer);
+        fmt::format_to(it, "{:.6f} {:.6f} {:.6f}", pt.x, pt.y, pt.z);
+        if (saveVertexColor) {
+            const App::Color& c = _material->diffuseColor[index];
             int r = (int)(255.0F * c.r);
             int g = (int)(255.0F * c.g);
             int b = (int)(255.0F * c.b);
-            out << " " << r << " " << g << " " << b << '\n';
-        }
-    }
-    else {
-        for (std::size_t i = 0; i < v_count; i++) {
-            const MeshPoint& p = rPoints[i];
-            if (this->apply_transform) {
-                Base::Vector3f pt = this->_transform * p;
-                out << pt.x << " " << pt.y << " " << pt.z << '\n';
-            }
-            else {
-                out << p.x << " " << p.y << " " << p.z << '\n';
-            }
-        }
-    }
-
-    unsigned int n = 3;
-    int f1 {}, f2 {}, f3 {};
-    for (std::size_t i = 0; i < f_count; i++) {
-        const MeshFacet& f = rFacets[i];
-        f1 = (int)f._aulPoints[0];
-        f2 = (int)f._aulPoints[1];
-        f3 = (int)f._aulPoints[2];
-        out << n << " " << f1 << " " << f2 << " " << f3 << '\n';
-    }
+            fmt::format_to(it, " {} {} {}", r, g, b);
+        }
+        buffer.push_back('\n');
+    });
+    writer.write(f_count, [&rFacets](std::string& buffer, std::size_t index) {
+        const MeshFacet& f = rFacets[index];
+        fmt::format_to(std::back_inserter(buffer),
+                       "3 {} {} {}\n",
+                       (int)f._aulPoints[0],
+                       (int)f._aulPoints[1],
+                       (int)f._aulPoints[2]);
+    });
 
     return true;
 }
@@ -257,6 +257,11 @@ protected:
     bool SaveX3DContent(std::ostream& out, bool exportViewpoints) const;
 
 private:
+    /// Returns the point with the transformation applied, safe to call from several threads
+    Base::Vector3f GetTransformedPoint(PointIndex index) const;
+    /// Returns the facet with the transformation applied, safe to call from several threads
+    MeshGeomFacet GetTransformedFacet(FacetIndex index) const;
+
     const MeshKernel& _rclMesh; /**< reference to mesh data structure */
     const Material* _material;
     Base::Matrix4D _transform;
@@ -28,6 +28,7 @@
 #include <map>
 #include <queue>
 #include <stdexcept>
+#include <thread>
 #endif
 
 #include <Base/Exception.h>
@@ -37,6 +38,7 @@
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Evaluation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -45,6 +47,28 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// Number of chunks for a loop over count elements, small loops stay on the calling thread
+std::size_t countChunks(std::size_t count)
+{
+    constexpr std::size_t minChunkSize = 100000;
+    std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    return std::max<std::size_t>(1, std::min(threads, count / minChunkSize));
+}
+
+// Calls func(chunk, begin, end) for each chunk of [0, count), the chunks run concurrently
+template<class Func>
+void forEachChunk(std::size_t count, std::size_t chunks, Func&& func)
+{
+    parallel_chunks(chunks, chunks, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; chunk++) {
+            func(chunk, count * chunk / chunks, count * (chunk + 1) / chunks);
+        }
+    });
+}
+}  // namespace
+
 MeshKernel::MeshKernel()
 {
     _clBoundBox.SetVoid();
@@ -1105,14 +1129,14 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
+    std::size_t count = _aclPointArray.size();
+    forEachChunk(count, countChunks(count), [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            _aclPointArray[index] *= rclMat;
+        }
+    });
 
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    RecalcBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1123,9 +1147,18 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 
 void MeshKernel::RecalcBoundBox() const
 {
+    std::size_t count = _aclPointArray.size();
+    std::vector<Base::BoundBox3f> boxes(countChunks(count));
+    forEachChunk(count, boxes.size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        Base::BoundBox3f& box = boxes[chunk];
+        for (std::size_t index = begin; index < end; index++) {
+            box.Add(_aclPointArray[index]);
+        }
+    });
+
     _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
+    for (const auto& box : boxes) {
+        _clBoundBox.Add(box);
     }
 }
 
@@ -1135,15 +1168,31 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
     normals.resize(CountPoints());
 
-    PointIndex p1 {}, p2 {}, p3 {};
-    unsigned int ct = CountFacets();
-    for (unsigned int pFIter = 0; pFIter < ct; pFIter++) {
-        GetFacetPoints(pFIter, p1, p2, p3);
-        Base::Vector3f Norm = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
+    // The facet normals are computed concurrently block by block, and summed up in the order of
+    // the facets so that the result does not depend on the number of threads.
+    constexpr std::size_t blockSize = 1 << 20;
+    std::vector<Base::Vector3f> facetNormals;
+    std::size_t ct = CountFacets();
+    for (std::size_t block = 0; block < ct; block += blockSize) {
+        std::size_t count = std::min(blockSize, ct - block);
+        facetNormals.resize(count);
+        std::size_t chunks = countChunks(count);
+        forEachChunk(count, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t index = begin; index < end; index++) {
+                const MeshFacet& facet = _aclFacetArray[block + index];
+                const MeshPoint& p1 = _aclPointArray[facet._aulPoints[0]];
+                const MeshPoint& p2 = _aclPointArray[facet._aulPoints[1]];
+                const MeshPoint& p3 = _aclPointArray[facet._aulPoints[2]];
+                facetNormals[index] = (p2 - p1) % (p3 - p1);
+            }
+        });
 
-        normals[p1] += Norm;
-        normals[p2] += Norm;
-        normals[p3] += Norm;
+        for (std::size_t index = 0; index < count; index++) {
+            const MeshFacet& facet = _aclFacetArray[block + index];
+            normals[facet._aulPoints[0]] += facetNormals[index];
+            normals[facet._aulPoints[1]] += facetNormals[index];
+            normals[facet._aulPoints[2]] += facetNormals[index];
+        }
     }
 
     return normals;
@@ -1172,13 +1221,26 @@ std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetI
 // Evaluation
 float MeshKernel::GetSurface() const
 {
-    float fSurface = 0.0;
-    MeshFacetIterator cIter(*this);
-    for (cIter.Init(); cIter.More(); cIter.Next()) {
-        fSurface += cIter->Area();
+    std::size_t count = _aclFacetArray.size();
+    std::vector<double> areas(countChunks(count));
+    forEachChunk(count, areas.size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        double surface = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& facet = _aclFacetArray[index];
+            const MeshPoint& p1 = _aclPointArray[facet._aulPoints[0]];
+            const MeshPoint& p2 = _aclPointArray[facet._aulPoints[1]];
+            const MeshPoint& p3 = _aclPointArray[facet._aulPoints[2]];
+            surface += ((p2 - p1) % (p3 - p1)).Length() / 2.0F;
+        }
+        areas[chunk] = surface;
+    });
+
+    double fSurface = 0.0;
+    for (double surface : areas) {
+        fSurface += surface;
     }
 
-    return fSurface;
+    return float(fSurface);
 }
 
 float MeshKernel::GetSurface(const std::vector<FacetIndex>& aSegment) const
@@ -1200,23 +1262,30 @@ float MeshKernel::GetVolume() const
     // if ( !cSolid.Evaluate() )
     //     return 0.0f; // no solid
 
-    float fVolume = 0.0;
-    MeshFacetIterator cIter(*this);
-    Base::Vector3f p1, p2, p3;
-    for (cIter.Init(); cIter.More(); cIter.Next()) {
-        const MeshGeomFacet& rclF = *cIter;
-        p1 = rclF._aclPoints[0];
-        p2 = rclF._aclPoints[1];
-        p3 = rclF._aclPoints[2];
+    std::size_t count = _aclFacetArray.size();
+    std::vector<double> volumes(countChunks(count));
+    forEachChunk(count, volumes.size(), [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        double volume = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& facet = _aclFacetArray[index];
+            const MeshPoint& p1 = _aclPointArray[facet._aulPoints[0]];
+            const MeshPoint& p2 = _aclPointArray[facet._aulPoints[1]];
+            const MeshPoint& p3 = _aclPointArray[facet._aulPoints[2]];
+
+            volume += (-p3.x * p2.y * p1.z + p2.x * p3.y * p1.z + p3.x * p1.y * p2.z
+                       - p1.x * p3.y * p2.z - p2.x * p1.y * p3.z + p1.x * p2.y * p3.z);
+        }
+        volumes[chunk] = volume;
+    });
 
-        fVolume += (-p3.x * p2.y * p1.z + p2.x * p3.y * p1.z + p3.x * p1.y * p2.z
-                    - p1.x * p3.y * p2.z - p2.x * p1.y * p3.z + p1.x * p2.y * p3.z);
+    double fVolume = 0.0;
+    for (double volume : volumes) {
+        fVolume += volume;
     }
 
-    fVolume /= 6.0F;
-    fVolume = std::fabs(fVolume);
+    fVolume /= 6.0;
 
-    return fVolume;
+    return float(std::fabs(fVolume));
 }
 
 bool MeshKernel::HasOpenEdges() const
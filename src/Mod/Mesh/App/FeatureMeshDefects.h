@@ -54,6 +54,11 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    /// the repair only works on a copy of the source mesh and may run on a worker thread
+    bool isExecuteThreadSafe() const override
+    {
+        return true;
+    }
     //@}
 
     /// returns the type name of the ViewProvider
@@ -367,7 +367,7 @@ void MeshObject::getFaces(std::vector<Base::Vector3d>& Points,
     }
 }
 
-unsigned int MeshObject::getMemSize() const
+std::size_t MeshObject::getMemSize() const
 {
     return _kernel.GetMemSize();
 }
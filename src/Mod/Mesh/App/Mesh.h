@@ -191,7 +191,7 @@ public:
     /** @name I/O */
     //@{
     // Implemented from Persistence
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     void SaveDocFile(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
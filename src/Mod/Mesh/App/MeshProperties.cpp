@@ -179,9 +179,9 @@ void PropertyNormalList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyNormalList::getMemSize() const
+std::size_t PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    return _lValueList.size() * sizeof(Base::Vector3f);
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -698,14 +698,14 @@ void PropertyMaterial::Paste(const Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyMaterial::getMemSize() const
+std::size_t PropertyMaterial::getMemSize() const
 {
     auto size = (_material.ambientColor.size() + _material.diffuseColor.size()
                  + _material.emissiveColor.size() + _material.specularColor.size())
             * sizeof(App::Color)
         + (_material.shininess.size() + _material.transparency.size()) * sizeof(float)
         + _material.library.size() + sizeof(_material);
-    return static_cast<unsigned int>(size);
+    return size;
 }
 
 bool PropertyMaterial::isSame(const App::Property& other) const
@@ -730,6 +730,7 @@ PropertyMeshKernel::PropertyMeshKernel()
 
 PropertyMeshKernel::~PropertyMeshKernel()
 {
+    unshare();
     if (meshPyObject) {
         // Note: Do not call setInvalid() of the Python binding
         // because the mesh should still be accessible afterwards.
@@ -744,6 +745,8 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
+    // a copy sharing the old mesh object simply keeps it
+    unshare();
     _meshObject = mesh;
     hasSetValue();
 }
@@ -751,6 +754,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    detachCopy(&mesh == &*_meshObject);
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -758,6 +762,7 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachCopy(&mesh == &_meshObject->getKernel());
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -765,6 +770,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detachCopy(true);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -772,6 +778,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachCopy(true);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -796,9 +803,14 @@ Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
     return _meshObject->getBoundBox();
 }
 
-unsigned int PropertyMeshKernel::getMemSize() const
+std::size_t PropertyMeshKernel::getMemSize() const
 {
-    unsigned int size = 0;
+    // A copy sharing the mesh object of its owner is already counted by the owner
+    if (sharedOwner) {
+        return 0;
+    }
+
+    std::size_t size = 0;
     size += _meshObject->getMemSize();
 
     return size;
@@ -807,6 +819,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detachCopy(true);
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -818,6 +831,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachCopy(true);
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +840,7 @@ void PropertyMeshKernel::setPointIndices(
     const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detachCopy(true);
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +850,7 @@ void PropertyMeshKernel::setPointIndices(
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detachCopy(true);
     _meshObject->setTransform(rclTrf);
 }
 
@@ -846,6 +862,10 @@ Base::Matrix4D PropertyMeshKernel::getTransform() const
 PyObject* PropertyMeshKernel::getPyObject()
 {
     if (!meshPyObject) {
+        // the wrapper must not reference the mesh object of the owner
+        if (sharedOwner) {
+            detachCopy(true);
+        }
         meshPyObject = new MeshPy(
             &*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor] ** Not destroyed in
                              // this class because it is reference-counted and destroyed elsewhere
@@ -888,8 +908,8 @@ void PropertyMeshKernel::Save(Base::Writer& writer) const
         saver.SaveXML(writer);
     }
     else {
-        writer.Stream() << writer.ind() << "<Mesh file=\"" << writer.addFile("MeshKernel.bms", this)
-                        << "\"/>" << std::endl;
+        writer.Stream() << writer.ind() << "<Mesh file=\""
+                        << writer.addSharedFile("MeshKernel.bms", this) << "\"/>" << std::endl;
     }
 }
 
@@ -910,6 +930,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachCopy(true);
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,15 +948,40 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachCopy(true);
     _meshObject->load(reader);
     hasSetValue();
 }
 
+bool PropertyMeshKernel::RestoreSharedDocFile(const Base::Persistence& source)
+{
+    // copy the already restored mesh instead of parsing the file again
+    auto prop = dynamic_cast<const PropertyMeshKernel*>(&source);
+    if (!prop) {
+        return false;
+    }
+
+    aboutToSetValue();
+    detachCopy(true);
+    _meshObject->setKernel(prop->_meshObject->getKernel());
+    hasSetValue();
+    return true;
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    if (sharedCopy || sharedOwner) {
+        // Note: Copy the content, do NOT reference the same mesh object
+        *(prop->_meshObject) = *(this->_meshObject);
+    }
+    else {
+        // Note: The copy references the same mesh object until one of both properties
+        // gets modified. So, an undo step of an unchanged mesh doesn't duplicate it.
+        prop->_meshObject = this->_meshObject;
+        prop->sharedOwner = this;
+        sharedCopy = prop;
+    }
     return prop;
 }
 
@@ -944,6 +990,41 @@ void PropertyMeshKernel::Paste(const App::Property& from)
     // Note: Copy the content, do NOT reference the same mesh object
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
+    detachCopy(false);
     *(this->_meshObject) = *(prop._meshObject);
     hasSetValue();
 }
+
+void PropertyMeshKernel::detachCopy(bool keepContent)
+{
+    if (sharedCopy) {
+        // The copy gets the current data and this property keeps its mesh object
+        // because it can be referenced by its Python wrapper. If the data will be
+        // replaced anyway it is moved to the copy.
+        Base::Reference<MeshObject> mesh(new MeshObject());
+        if (keepContent) {
+            *mesh = *_meshObject;
+        }
+        else {
+            mesh->swap(*_meshObject);
+            _meshObject->setTransform(mesh->getTransform());
+        }
+        sharedCopy->_meshObject = mesh;
+    }
+    else if (sharedOwner) {
+        _meshObject = new MeshObject(*_meshObject);
+    }
+    unshare();
+}
+
+void PropertyMeshKernel::unshare()
+{
+    if (sharedCopy) {
+        sharedCopy->sharedOwner = nullptr;
+        sharedCopy = nullptr;
+    }
+    if (sharedOwner) {
+        sharedOwner->sharedCopy = nullptr;
+        sharedOwner = nullptr;
+    }
+}
@@ -89,7 +89,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void transformGeometry(const Base::Matrix4D& rclMat);
 
@@ -168,7 +168,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override
+    std::size_t getMemSize() const override
     {
         return _lValueList.size() * sizeof(CurvatureInfo);
     }
@@ -220,7 +220,7 @@ public:
     Property* Copy() const override;
     void Paste(const Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     bool isSame(const Property& other) const override;
 
 private:
@@ -267,7 +267,7 @@ public:
      */
     const MeshObject& getValue() const;
     const MeshObject* getValuePtr() const;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Getting basic geometric entities */
@@ -315,14 +315,23 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool RestoreSharedDocFile(const Base::Persistence& source) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+private:
+    void detachCopy(bool keepContent);
+    void unshare();
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
+    // The copy made by Copy() (mainly for undo/redo) shares the mesh object
+    // with this property until one of them gets modified.
+    mutable PropertyMeshKernel* sharedCopy {nullptr};
+    const PropertyMeshKernel* sharedOwner {nullptr};
 };
 
 }  // namespace Mesh
@@ -238,7 +238,7 @@ bool Geometry::hasSameExtensions(const Geometry& other) const
 }
 
 // Persistence implementer
-unsigned int Geometry::getMemSize () const
+std::size_t Geometry::getMemSize () const
 {
     return 1;
 }
@@ -604,7 +604,7 @@ void GeomPoint::setPoint(const Base::Vector3d& p)
 }
 
 // Persistence implementer
-unsigned int GeomPoint::getMemSize () const
+std::size_t GeomPoint::getMemSize () const
 {
     return sizeof(Geom_CartesianPoint);
 }
@@ -1203,7 +1203,7 @@ std::vector<double> GeomBezierCurve::getWeights() const
 }
 
 // Persistence implementer
-unsigned int GeomBezierCurve::getMemSize () const
+std::size_t GeomBezierCurve::getMemSize () const
 {
     return sizeof(Geom_BezierCurve);
 }
@@ -1938,7 +1938,7 @@ void GeomBSplineCurve::scaleKnotsToBounds(double u0, double u1)
 }
 
 // Persistence implementer
-unsigned int GeomBSplineCurve::getMemSize () const
+std::size_t GeomBSplineCurve::getMemSize () const
 {
     return sizeof(Geom_BSplineCurve);
 }
@@ -2292,7 +2292,7 @@ GeomCurve* GeomTrimmedCurve::createArc(double first, double last) const
 }
 
 // Persistence implementer
-unsigned int GeomTrimmedCurve::getMemSize () const
+std::size_t GeomTrimmedCurve::getMemSize () const
 {
     return sizeof(Geom_TrimmedCurve);
 }
@@ -2688,7 +2688,7 @@ void GeomCircle::setRadius(double Radius)
 }
 
 // Persistence implementer
-unsigned int GeomCircle::getMemSize () const
+std::size_t GeomCircle::getMemSize () const
 {
     return sizeof(Geom_Circle);
 }
@@ -2934,7 +2934,7 @@ void GeomArcOfCircle::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfCircle::getMemSize () const
+std::size_t GeomArcOfCircle::getMemSize () const
 {
     return sizeof(Geom_Circle) + 2 *sizeof(double);
 }
@@ -3197,7 +3197,7 @@ void GeomEllipse::setMajorAxisDir(Base::Vector3d newdir)
 }
 
 // Persistence implementer
-unsigned int GeomEllipse::getMemSize () const
+std::size_t GeomEllipse::getMemSize () const
 {
     return sizeof(Geom_Ellipse);
 }
@@ -3481,7 +3481,7 @@ void GeomArcOfEllipse::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfEllipse::getMemSize () const
+std::size_t GeomArcOfEllipse::getMemSize () const
 {
     return sizeof(Geom_Ellipse) + 2 *sizeof(double);
 }
@@ -3665,7 +3665,7 @@ void GeomHyperbola::setMinorRadius(double Radius)
 }
 
 // Persistence implementer
-unsigned int GeomHyperbola::getMemSize () const
+std::size_t GeomHyperbola::getMemSize () const
 {
     return sizeof(Geom_Hyperbola);
 }
@@ -3937,7 +3937,7 @@ void GeomArcOfHyperbola::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfHyperbola::getMemSize () const
+std::size_t GeomArcOfHyperbola::getMemSize () const
 {
     return sizeof(Geom_Hyperbola) + 2 *sizeof(double);
 }
@@ -4101,7 +4101,7 @@ void GeomParabola::setFocal(double length)
 }
 
 // Persistence implementer
-unsigned int GeomParabola::getMemSize () const
+std::size_t GeomParabola::getMemSize () const
 {
     return sizeof(Geom_Parabola);
 }
@@ -4304,7 +4304,7 @@ void GeomArcOfParabola::setRange(double u, double v, bool emulateCCWXY)
 }
 
 // Persistence implementer
-unsigned int GeomArcOfParabola::getMemSize () const
+std::size_t GeomArcOfParabola::getMemSize () const
 {
     return sizeof(Geom_Parabola) + 2 *sizeof(double);
 }
@@ -4458,7 +4458,7 @@ Geometry *GeomLine::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomLine::getMemSize () const
+std::size_t GeomLine::getMemSize () const
 {
     return sizeof(Geom_Line);
 }
@@ -4614,7 +4614,7 @@ void GeomLineSegment::setPoints(const Base::Vector3d& Start, const Base::Vector3
 }
 
 // Persistence implementer
-unsigned int GeomLineSegment::getMemSize () const
+std::size_t GeomLineSegment::getMemSize () const
 {
     return sizeof(Geom_TrimmedCurve) + sizeof(Geom_Line);
 }
@@ -4734,7 +4734,7 @@ const Handle(Geom_Geometry)& GeomOffsetCurve::handle() const
 }
 
 // Persistence implementer
-unsigned int GeomOffsetCurve::getMemSize () const
+std::size_t GeomOffsetCurve::getMemSize () const
 {
     return sizeof(Geom_OffsetCurve);
 }
@@ -4959,9 +4959,9 @@ Geometry *GeomBezierSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomBezierSurface::getMemSize () const
+std::size_t GeomBezierSurface::getMemSize () const
 {
-    unsigned int size = sizeof(Geom_BezierSurface);
+    std::size_t size = sizeof(Geom_BezierSurface);
     if (!mySurface.IsNull()) {
         unsigned int poles = mySurface->NbUPoles();
         poles *= mySurface->NbVPoles();
@@ -5087,9 +5087,9 @@ void GeomBSplineSurface::scaleKnotsToBounds(double u0, double u1, double v0, dou
 }
 
 // Persistence implementer
-unsigned int GeomBSplineSurface::getMemSize () const
+std::size_t GeomBSplineSurface::getMemSize () const
 {
-    unsigned int size = sizeof(Geom_BSplineSurface);
+    std::size_t size = sizeof(Geom_BSplineSurface);
     if (!mySurface.IsNull()) {
         size += mySurface->NbUKnots() * sizeof(Standard_Real);
         size += mySurface->NbUKnots() * sizeof(Standard_Integer);
@@ -5260,7 +5260,7 @@ Geometry *GeomCylinder::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomCylinder::getMemSize () const
+std::size_t GeomCylinder::getMemSize () const
 {
     return sizeof(Geom_CylindricalSurface);
 }
@@ -5333,7 +5333,7 @@ Geometry *GeomCone::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomCone::getMemSize () const
+std::size_t GeomCone::getMemSize () const
 {
     return sizeof(Geom_ConicalSurface);
 }
@@ -5458,7 +5458,7 @@ Geometry *GeomToroid::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomToroid::getMemSize () const
+std::size_t GeomToroid::getMemSize () const
 {
     return sizeof(Geom_ToroidalSurface);
 }
@@ -5537,7 +5537,7 @@ Geometry *GeomSphere::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSphere::getMemSize () const
+std::size_t GeomSphere::getMemSize () const
 {
     return sizeof(Geom_SphericalSurface);
 }
@@ -5616,7 +5616,7 @@ Geometry *GeomPlane::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomPlane::getMemSize () const
+std::size_t GeomPlane::getMemSize () const
 {
     return sizeof(Geom_Plane);
 }
@@ -5687,7 +5687,7 @@ Geometry *GeomOffsetSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomOffsetSurface::getMemSize () const
+std::size_t GeomOffsetSurface::getMemSize () const
 {
     return sizeof(Geom_OffsetSurface);
 }
@@ -5773,7 +5773,7 @@ Geometry *GeomPlateSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomPlateSurface::getMemSize () const
+std::size_t GeomPlateSurface::getMemSize () const
 {
     throw Base::NotImplementedError("GeomPlateSurface::getMemSize");
 }
@@ -5830,7 +5830,7 @@ Geometry *GeomTrimmedSurface::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomTrimmedSurface::getMemSize () const
+std::size_t GeomTrimmedSurface::getMemSize () const
 {
     return sizeof(Geom_RectangularTrimmedSurface);
 }
@@ -5950,7 +5950,7 @@ Geometry *GeomSurfaceOfRevolution::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSurfaceOfRevolution::getMemSize () const
+std::size_t GeomSurfaceOfRevolution::getMemSize () const
 {
     return sizeof(Geom_SurfaceOfRevolution);
 }
@@ -6006,7 +6006,7 @@ Geometry *GeomSurfaceOfExtrusion::copy() const
 }
 
 // Persistence implementer
-unsigned int GeomSurfaceOfExtrusion::getMemSize () const
+std::size_t GeomSurfaceOfExtrusion::getMemSize () const
 {
    return sizeof(Geom_SurfaceOfLinearExtrusion);
 }
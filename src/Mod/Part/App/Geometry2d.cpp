@@ -90,7 +90,7 @@ Geometry2d::Geometry2d() = default;
 
 Geometry2d::~Geometry2d() = default;
 
-unsigned int Geometry2d::getMemSize () const
+std::size_t Geometry2d::getMemSize () const
 {
     return sizeof(Geometry2d);
 }
@@ -158,7 +158,7 @@ void Geom2dPoint::setPoint(const Base::Vector2d& p)
     this->myPoint->SetCoord(p.x,p.y);
 }
 
-unsigned int Geom2dPoint::getMemSize () const
+std::size_t Geom2dPoint::getMemSize () const
 {
     return sizeof(Geom2d_CartesianPoint);
 }
@@ -355,7 +355,7 @@ Geometry2d *Geom2dBezierCurve::clone() const
     return newCurve;
 }
 
-unsigned int Geom2dBezierCurve::getMemSize () const
+std::size_t Geom2dBezierCurve::getMemSize () const
 {
     throw Base::NotImplementedError("Geom2dBezierCurve::getMemSize");
 }
@@ -557,7 +557,7 @@ std::list<Geometry2d*> Geom2dBSplineCurve::toBiArcs(double /*tolerance*/) const
     return {};
 }
 
-unsigned int Geom2dBSplineCurve::getMemSize() const
+std::size_t Geom2dBSplineCurve::getMemSize() const
 {
     throw Base::NotImplementedError("Geom2dBSplineCurve::getMemSize");
 }
@@ -828,7 +828,7 @@ void Geom2dCircle::setRadius(double Radius)
     }
 }
 
-unsigned int Geom2dCircle::getMemSize () const
+std::size_t Geom2dCircle::getMemSize () const
 {
     return sizeof(Geom2d_Circle);
 }
@@ -984,7 +984,7 @@ void Geom2dArcOfCircle::setRadius(double Radius)
     }
 }
 
-unsigned int Geom2dArcOfCircle::getMemSize () const
+std::size_t Geom2dArcOfCircle::getMemSize () const
 {
     return sizeof(Geom2d_Circle) + 2 *sizeof(double);
 }
@@ -1147,7 +1147,7 @@ void Geom2dEllipse::setMajorAxisDir(Base::Vector2d newdir)
     }
 }
 
-unsigned int Geom2dEllipse::getMemSize () const
+std::size_t Geom2dEllipse::getMemSize () const
 {
     return sizeof(Geom2d_Ellipse);
 }
@@ -1318,7 +1318,7 @@ void Geom2dArcOfEllipse::setMajorAxisDir(Base::Vector2d newdir)
     }
 }
 
-unsigned int Geom2dArcOfEllipse::getMemSize () const
+std::size_t Geom2dArcOfEllipse::getMemSize () const
 {
     return sizeof(Geom2d_Ellipse) + 2 *sizeof(double);
 }
@@ -1449,7 +1449,7 @@ void Geom2dHyperbola::setMinorRadius(double Radius)
     }
 }
 
-unsigned int Geom2dHyperbola::getMemSize () const
+std::size_t Geom2dHyperbola::getMemSize () const
 {
     return sizeof(Geom2d_Hyperbola);
 }
@@ -1576,7 +1576,7 @@ void Geom2dArcOfHyperbola::setMinorRadius(double Radius)
     }
 }
 
-unsigned int Geom2dArcOfHyperbola::getMemSize () const
+std::size_t Geom2dArcOfHyperbola::getMemSize () const
 {
     return sizeof(Geom2d_Hyperbola) + 2 *sizeof(double);
 }
@@ -1689,7 +1689,7 @@ void Geom2dParabola::setFocal(double length)
     }
 }
 
-unsigned int Geom2dParabola::getMemSize () const
+std::size_t Geom2dParabola::getMemSize () const
 {
     return sizeof(Geom2d_Parabola);
 }
@@ -1797,7 +1797,7 @@ void Geom2dArcOfParabola::setFocal(double length)
     }
 }
 
-unsigned int Geom2dArcOfParabola::getMemSize () const
+std::size_t Geom2dArcOfParabola::getMemSize () const
 {
     return sizeof(Geom2d_Parabola) + 2 *sizeof(double);
 }
@@ -1913,7 +1913,7 @@ Geometry2d *Geom2dLine::clone() const
     return newLine;
 }
 
-unsigned int Geom2dLine::getMemSize () const
+std::size_t Geom2dLine::getMemSize () const
 {
     return sizeof(Geom2d_Line);
 }
@@ -2045,7 +2045,7 @@ void Geom2dLineSegment::setPoints(const Base::Vector2d& Start, const Base::Vecto
     }
 }
 
-unsigned int Geom2dLineSegment::getMemSize () const
+std::size_t Geom2dLineSegment::getMemSize () const
 {
     return sizeof(Geom2d_TrimmedCurve) + sizeof(Geom2d_Line);
 }
@@ -2136,7 +2136,7 @@ const Handle(Geom2d_Geometry)& Geom2dOffsetCurve::handle() const
     return this->myCurve;
 }
 
-unsigned int Geom2dOffsetCurve::getMemSize () const
+std::size_t Geom2dOffsetCurve::getMemSize () const
 {
     throw Base::NotImplementedError("Geom2dOffsetCurve::getMemSize");
 }
@@ -2185,7 +2185,7 @@ Geometry2d *Geom2dTrimmedCurve::clone() const
     return newCurve;
 }
 
-unsigned int Geom2dTrimmedCurve::getMemSize () const
+std::size_t Geom2dTrimmedCurve::getMemSize () const
 {
     throw Base::NotImplementedError("Geom2dTrimmedCurve::getMemSize");
 }
@@ -299,9 +299,9 @@ void PropertyGeometryList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyGeometryList::getMemSize() const
+std::size_t PropertyGeometryList::getMemSize() const
 {
-    int size = sizeof(PropertyGeometryList);
+    std::size_t size = sizeof(PropertyGeometryList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i]->getMemSize();
     return size;
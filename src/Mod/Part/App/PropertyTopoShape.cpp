@@ -23,15 +23,18 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <limits>
+# include <locale>
 # include <sstream>
 # include <Bnd_Box.hxx>
 # include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_Copy.hxx>
 # include <BRepTools.hxx>
 # include <BRepTools_ShapeSet.hxx>
-# include <OSD_OpenFile.hxx>
 # include <Standard_Failure.hxx>
 # include <Standard_Version.hxx>
+# include <gp_Trsf.hxx>
+# include <TopLoc_Location.hxx>
 # include <TopoDS.hxx>
 #endif // _PreComp_
 
@@ -226,7 +229,7 @@ void PropertyPartShape::Paste(const App::Property &from)
     }
 }
 
-unsigned int PropertyPartShape::getMemSize () const
+std::size_t PropertyPartShape::getMemSize () const
 {
     return _Shape.getMemSize();
 }
@@ -257,6 +260,45 @@ void PropertyPartShape::beforeSave() const
         _Shape.beforeSave();
     }
 }
+
+static std::string writeLocation(const TopLoc_Location& loc)
+{
+    std::ostringstream str;
+    str.imbue(std::locale::classic());
+    str.precision(std::numeric_limits<double>::max_digits10);
+    gp_Trsf trsf = loc.Transformation();
+    for (int row = 1; row <= 3; row++) {
+        for (int col = 1; col <= 4; col++) {
+            if (row > 1 || col > 1)
+                str << ' ';
+            str << trsf.Value(row, col);
+        }
+    }
+    return str.str();
+}
+
+static TopLoc_Location readLocation(const std::string& text)
+{
+    std::istringstream str(text);
+    str.imbue(std::locale::classic());
+    double v[12];
+    for (double& value : v)
+        str >> value;
+    try {
+        if (!str.fail()) {
+            gp_Trsf trsf;
+            trsf.SetValues(v[0], v[1], v[2], v[3],
+                           v[4], v[5], v[6], v[7],
+                           v[8], v[9], v[10], v[11]);
+            return TopLoc_Location(trsf);
+        }
+    }
+    catch (const Standard_Failure&) {
+    }
+    FC_WARN("Invalid shape location '" << text << "'");
+    return TopLoc_Location();
+}
+
 void PropertyPartShape::Save (Base::Writer &writer) const
 {
     //See SaveDocFile(), RestoreDocFile()
@@ -281,8 +323,13 @@ void PropertyPartShape::Save (Base::Writer &writer) const
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
     if(!toXML) {
+        // Shapes that only differ in their location may share the file, which is then
+        // saved without the location. See SaveSharedDocFile().
+        const TopLoc_Location& loc = _Shape.getShape().Location();
+        if(writer.getMode("DeduplicateFiles") && !loc.IsIdentity())
+            writer.Stream() << " Location=\"" << writeLocation(loc) << '"';
         writer.Stream() << " file=\""
-                        << writer.addFile(getFileName(binary?".bin":".brp").c_str(), this)
+                        << writer.addSharedFile(getFileName(binary?".bin":".brp").c_str(), this)
                         << "\"/>\n";
     } else if(binary) {
         writer.Stream() << " binary=\"1\">\n";
@@ -331,6 +378,10 @@ void PropertyPartShape::Restore(Base::XMLReader &reader)
 
     TopoShape shape;
 
+    _Location = TopLoc_Location();
+    if (reader.hasAttribute("Location"))
+        _Location = readLocation(reader.getAttribute("Location"));
+
     if (reader.hasAttribute("file")) {
         std::string file = reader.getAttribute("file");
         if (!file.empty()) {
@@ -420,17 +471,12 @@ void PropertyPartShape::afterRestore()
 }
 
 // The following function is copied from OCCT BRepTools.cxx and modified
-// to disable saving of triangulation
+// to make saving of triangulation optional
 //
 
-static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File)
+static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, std::ostream& os,
+                                         Standard_Boolean withTriangles)
 {
-  std::ofstream os;
-  OSD_OpenStream(os, File, std::ios::out);
-
-  if (!os.rdbuf()->is_open())
-      return Standard_False;
-
   Standard_Boolean isGood = (os.good() && !os.eof());
   if(!isGood)
     return isGood;
@@ -442,7 +488,7 @@ static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_
       VERSION_3 = 3
   };
 
-  BRepTools_ShapeSet SS(Standard_False);
+  BRepTools_ShapeSet SS(withTriangles);
   SS.SetFormatNb(VERSION_1);
   // SS.SetProgress(PR);
   SS.Add(Sh);
@@ -453,77 +499,66 @@ static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_
   if(isGood )
     SS.Write(Sh,os);
   os.flush();
-  isGood = os.good();
-
-  errno = 0;
-  os.close();
-  isGood = os.good() && isGood && !errno;
+  isGood = os.good() && isGood;
 
   return isGood;
 }
 
-void PropertyPartShape::saveToFile(Base::Writer &writer) const
+bool PropertyPartShape::saveTriangulation()
 {
-    // create a temporary file and copy the content to the zip stream
-    // once the tmp. filename is known use always the same because otherwise
-    // we may run into some problems on the Linux platform
-    static Base::FileInfo fi(App::Application::getTempFileName());
+    // Storing the triangulation that was created for the visualization lets the
+    // view provider skip re-meshing on restore. BRepMesh_IncrementalMesh keeps an
+    // existing triangulation as long as it fits the requested deflection.
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("SaveTessellation", false);
+}
 
-    TopoDS_Shape myShape = _Shape.getShape();
-    if (!BRepTools_Write(myShape,static_cast<Standard_CString>(fi.filePath().c_str()))) {
-        // Note: Do NOT throw an exception here because if the tmp. file could
-        // not be created we should not abort.
+void PropertyPartShape::saveToBuffer(Base::Writer &writer, const TopoDS_Shape& myShape) const
+{
+    // write the shape into a memory buffer and copy the content to the zip stream
+    std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
+
+    if (!BRepTools_Write(myShape, buffer,
+                         saveTriangulation() ? Standard_True : Standard_False)) {
+        // Note: Do NOT throw an exception here because if the buffer could
+        // not be written we should not abort.
         // We only print an error message but continue writing the next files to the
         // stream...
         App::PropertyContainer* father = this->getContainer();
         if (father && father->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
             App::DocumentObject* obj = static_cast<App::DocumentObject*>(father);
-            Base::Console().Error("Shape of '%s' cannot be written to BRep file '%s'\n",
-                obj->Label.getValue(),fi.filePath().c_str());
+            Base::Console().Error("Shape of '%s' cannot be written to BRep file\n",
+                obj->Label.getValue());
         }
         else {
-            Base::Console().Error("Cannot save BRep file '%s'\n", fi.filePath().c_str());
+            Base::Console().Error("Cannot save BRep file\n");
         }
 
-        std::stringstream ss;
-        ss << "Cannot save BRep file '" << fi.filePath() << "'";
-        writer.addError(ss.str());
+        writer.addError("Cannot save BRep file");
     }
 
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    if (file) {
-        std::streambuf* buf = file.rdbuf();
-        writer.Stream() << buf;
+    if (buffer.tellp() > 0) {
+        writer.Stream() << buffer.rdbuf();
     }
-
-    file.close();
-    // remove temp file
-    fi.deleteFile();
 }
 
-void PropertyPartShape::loadFromFile(Base::Reader &reader)
+void PropertyPartShape::loadFromBuffer(Base::Reader &reader)
 {
     BRep_Builder builder;
-    // create a temporary file and copy the content from the zip stream
-    Base::FileInfo fi(App::Application::getTempFileName());
-
-    // read in the ASCII file and write back to the file stream
-    Base::ofstream file(fi, std::ios::out | std::ios::binary);
-    unsigned long ulSize = 0;
+    // copy the content from the zip stream into a memory buffer, unlike the zip
+    // stream the buffer can be read with random access
+    std::stringstream buffer(std::ios::in | std::ios::out | std::ios::binary);
     if (reader) {
-        std::streambuf* buf = file.rdbuf();
-        reader >> buf;
-        file.flush();
-        ulSize = buf->pubseekoff(0, std::ios::cur, std::ios::in);
+        reader >> buffer.rdbuf();
     }
-    file.close();
 
-    // Read the shape from the temp file, if the file is empty the stored shape was already empty.
-    // If it's still empty after reading the (non-empty) file there must occurred an error.
+    // Read the shape from the buffer, if it is empty the stored shape was already empty.
+    // If it's still empty after reading the (non-empty) buffer there must occurred an error.
     TopoDS_Shape shape;
-    if (ulSize > 0) {
-        if (!BRepTools::Read(shape, static_cast<Standard_CString>(fi.filePath().c_str()), builder)) {
-            // Note: Do NOT throw an exception here because if the tmp. created file could
+    if (buffer.tellp() > 0) {
+        BRepTools::Read(shape, buffer, builder);
+        if (shape.IsNull()) {
+            // Note: Do NOT throw an exception here because if the buffer could
             // not be read it's NOT an indication for an invalid input stream 'reader'.
             // We only print an error message but continue reading the next files from the
             // stream...
@@ -531,16 +566,17 @@ void PropertyPartShape::loadFromFile(Base::Reader &reader)
             if (father && father->isDerivedFrom(App::DocumentObject::getClassTypeId())) {
                 App::DocumentObject* obj = static_cast<App::DocumentObject*>(father);
                 Base::Console().Error("BRep file '%s' with shape of '%s' seems to be empty\n",
-                    fi.filePath().c_str(),obj->Label.getValue());
+                    reader.getFileName().c_str(),obj->Label.getValue());
             }
             else {
-                Base::Console().Warning("Loaded BRep file '%s' seems to be empty\n", fi.filePath().c_str());
+                Base::Console().Warning("Loaded BRep file '%s' seems to be empty\n",
+                    reader.getFileName().c_str());
             }
         }
     }
 
-    // delete the temp file
-    fi.deleteFile();
+    if (!_Location.IsIdentity())
+        shape.Location(_Location);
     setValue(shape);
 }
 
@@ -551,6 +587,8 @@ void PropertyPartShape::loadFromStream(Base::Reader &reader)
         BRep_Builder builder;
         TopoDS_Shape shape;
         BRepTools::Read(shape, reader, builder);
+        if (!_Location.IsIdentity())
+            shape.Location(_Location);
         setValue(shape);
     }
     catch (const std::exception&) {
@@ -565,22 +603,40 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull())
         return;
+    saveShape(writer, _Shape.getShape());
+}
+
+bool PropertyPartShape::SaveSharedDocFile(Base::Writer &writer) const
+{
+    // Shapes that only differ in their location share the file, which is then saved
+    // without the location. Save() writes the location as attribute.
     TopoDS_Shape myShape = _Shape.getShape();
+    if (myShape.IsNull() || myShape.Location().IsIdentity()) {
+        SaveDocFile(writer);
+        return false;
+    }
+    myShape.Location(TopLoc_Location());
+    saveShape(writer, myShape);
+    return true;
+}
+
+void PropertyPartShape::saveShape(Base::Writer &writer, const TopoDS_Shape& myShape) const
+{
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), saveTriangulation());
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
             ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
         if (!direct) {
-            saveToFile(writer);
+            saveToBuffer(writer, myShape);
         }
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), saveTriangulation());
         }
     }
 }
@@ -591,13 +647,15 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     if (brep.hasExtension("bin")) {
         TopoShape shape;
         shape.importBinary(reader);
+        if (!_Location.IsIdentity())
+            shape.locate(_Location);
         setValue(shape);
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
             ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
         if (!direct) {
-            loadFromFile(reader);
+            loadFromBuffer(reader);
         }
         else {
             auto iostate = reader.exceptions();
@@ -607,6 +665,19 @@ void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
     }
 }
 
+bool PropertyPartShape::RestoreSharedDocFile(const Base::Persistence &source)
+{
+    // share the already restored shape, its TShape is not copied. The shared
+    // file was saved without location, so this shape may be placed elsewhere.
+    auto prop = dynamic_cast<const PropertyPartShape*>(&source);
+    if (!prop)
+        return false;
+    TopoDS_Shape shape = prop->_Shape.getShape();
+    shape.Location(_Location);
+    setValue(shape);
+    return true;
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(BRepBuilderAPI_MakeShape& mkShape, TopAbs_ShapeEnum type,
@@ -89,11 +89,13 @@ public:
     virtual void beforeSave() const override;
 
     void SaveDocFile (Base::Writer &writer) const override;
+    bool SaveSharedDocFile(Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    bool RestoreSharedDocFile(const Base::Persistence &source) override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
-    unsigned int getMemSize () const override;
+    std::size_t getMemSize () const override;
     //@}
 
     /// Get valid paths for this property; used by auto completer
@@ -107,13 +109,17 @@ public:
     friend class Feature;
 
 private:
-    void saveToFile(Base::Writer &writer) const;
-    void loadFromFile(Base::Reader &reader);
+    static bool saveTriangulation();
+    void saveToBuffer(Base::Writer &writer, const TopoDS_Shape& myShape) const;
+    void saveShape(Base::Writer &writer, const TopoDS_Shape& myShape) const;
+    void loadFromBuffer(Base::Reader &reader);
     void loadFromStream(Base::Reader &reader);
 
 private:
     TopoShape _Shape;
     std::string _Ver;
+    // location of a shape whose file was saved without it, see Save()
+    TopLoc_Location _Location;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
 };
@@ -181,7 +187,7 @@ public:
     Property *Copy() const override;
     void Paste(const Property &from) override;
 
-    unsigned int getMemSize () const override {
+    std::size_t getMemSize () const override {
         return _lValueList.size() * sizeof(ShapeHistory);
     }
 
@@ -248,7 +254,7 @@ public:
     Property *Copy() const override;
     void Paste(const Property &from) override;
 
-    unsigned int getMemSize () const override {
+    std::size_t getMemSize () const override {
         return _lValueList.size() * sizeof(FilletElement);
     }
 
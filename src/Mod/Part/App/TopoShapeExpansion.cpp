@@ -807,6 +807,7 @@ void TopoShape::mapSubElementTypeForShape(const TopoShape& other,
     auto& shapeMap = _cache->getAncestry(type);
     auto& otherMap = other._cache->getAncestry(type);
     const char* shapeType = shapeName(type).c_str();
+    std::string postfix;
 
     // 1-indexed for readability (e.g. there is no "Edge0", we started at "Edge1", etc.)
     for (int outerCounter = 1; outerCounter <= count; ++outerCounter) {
@@ -846,8 +847,9 @@ void TopoShape::mapSubElementTypeForShape(const TopoShape& other,
             }
             char elementType {shapeName(type)[0]};
 
-            std::ostringstream ss;
-            ensureElementMap()->encodeElementName(elementType, name, ss, &sids, Tag, op, other.Tag);
+            postfix.clear();
+            ensureElementMap()
+                ->encodeElementName(elementType, name, postfix, &sids, Tag, op, other.Tag);
             elementMap()->setElementName(element, name, Tag, &sids);
         }
     }
@@ -927,7 +929,7 @@ void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool force
             checkHasher(other);
         }
         const char* shapetype = shapeName(type).c_str();
-        std::ostringstream ss;
+        std::string postfix;
 
         bool forward;
         int count;
@@ -972,9 +974,10 @@ void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool force
                         sids.clear();
                     }
                 }
-                ss.str("");
+                postfix.clear();
 
-                ensureElementMap()->encodeElementName(shapetype[0], name, ss, &sids, Tag, op, other.Tag);
+                ensureElementMap()
+                    ->encodeElementName(shapetype[0], name, postfix, &sids, Tag, op, other.Tag);
                 elementMap()->setElementName(element, name, Tag, &sids);
             }
         }
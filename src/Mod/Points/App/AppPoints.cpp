@@ -25,6 +25,7 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 
+#include "PagedFeature.h"
 #include "Points.h"
 #include "PointsPy.h"
 #include "Properties.h"
@@ -57,6 +58,7 @@ PyMOD_INIT_FUNC(Points)
     // add data types
     Points::Feature                 ::init();
     Points::Structured              ::init();
+    Points::PagedFeature            ::init();
     Points::FeatureCustom           ::init();
     Points::StructuredCustom        ::init();
     Points::FeaturePython           ::init();
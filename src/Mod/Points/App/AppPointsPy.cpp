@@ -22,7 +22,9 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <cstdint>
 #include <memory>
+#include <string>
 #endif
 
 #include <App/Application.h>
@@ -34,6 +36,8 @@
 #include <Base/FileInfo.h>
 #include <Base/Interpreter.h>
 
+#include "PagedFeature.h"
+#include "PagedPointKernel.h"
 #include "Points.h"
 #include "PointsAlgos.h"
 #include "PointsPy.h"
@@ -73,6 +77,61 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    /// Whether \a file is so large that its points are kept out-of-core
+    bool usePagedImport(const Base::FileInfo& file) const
+    {
+        if (!file.hasExtension("e57") && !file.hasExtension("ply")) {
+            return false;
+        }
+
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points");
+        // size in MB, zero disables the paged import
+        long pagedSize = hGrp->GetInt("PagedImportSize", 2048);
+        if (pagedSize <= 0) {
+            return false;
+        }
+
+        boost::system::error_code ec;
+        std::uintmax_t bytes =
+            boost::filesystem::file_size(Base::FileInfo::stringToPath(file.filePath()), ec);
+        return !ec && bytes > static_cast<std::uintmax_t>(pagedSize) * 1024 * 1024;
+    }
+    /// Reads the coordinates of \a file into a new cache directory and returns it
+    std::string readPaged(const Base::FileInfo& file) const
+    {
+        Base::Console().Log("Paged import of %s, colors and intensities are skipped\n",
+                            file.filePath().c_str());
+
+        // the cache is removed again if reading fails
+        auto kernel = std::make_unique<PagedPointKernel>();
+        if (file.hasExtension("e57")) {
+            auto setting = readE57Settings();
+            E57Reader reader(std::get<0>(setting), std::get<1>(setting), std::get<2>(setting));
+            reader.read(file.filePath(), *kernel);
+        }
+        else {
+            PlyReader reader;
+            reader.read(file.filePath(), *kernel);
+        }
+        kernel->build();
+        kernel->setTemporary(false);
+        return kernel->getDirectory();
+    }
+    /// Adds a feature showing a level of detail of the points in the cache \a directory
+    void addPagedFeature(const Base::FileInfo& file,
+                         const std::string& directory,
+                         App::Document* pcDoc)
+    {
+        auto pcFeature = static_cast<Points::PagedFeature*>(
+            pcDoc->addObject("Points::PagedFeature", file.fileNamePure().c_str()));
+        pcFeature->CacheDirectory.setValue(directory.c_str());
+        pcDoc->recomputeFeature(pcFeature);
+        pcFeature->purgeTouched();
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -91,6 +150,12 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
+            if (usePagedImport(file)) {
+                std::string directory = readPaged(file);
+                addPagedFeature(file, directory, App::GetApplication().newDocument());
+                return Py::None();
+            }
+
             std::unique_ptr<Reader> reader;
             if (file.hasExtension("asc")) {
                 reader = std::make_unique<AscReader>();
@@ -213,6 +278,16 @@ private:
                 throw Py::RuntimeError("No file extension");
             }
 
+            if (usePagedImport(file)) {
+                std::string directory = readPaged(file);
+                App::Document* pcDoc = App::GetApplication().getDocument(DocName);
+                if (!pcDoc) {
+                    pcDoc = App::GetApplication().newDocument(DocName);
+                }
+                addPagedFeature(file, directory, pcDoc);
+                return Py::None();
+            }
+
             std::unique_ptr<Reader> reader;
             if (file.hasExtension("asc")) {
                 reader = std::make_unique<AscReader>();
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <string>
+
+#include <QFile>
+#include <QtConcurrentMap>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+
+#include "AsciiParser.h"
+
+
+using namespace Points;
+
+namespace
+{
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+constexpr std::size_t chunkSize = 4 * 1024 * 1024;
+constexpr std::uint64_t maxExactMantissa = std::uint64_t(1) << 53;
+constexpr int maxMantissaDigits = 19;
+constexpr int maxExactPower = 22;
+constexpr std::array<double, maxExactPower + 1> powersOfTen {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool isSeparator(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == ',' || c == ';' || c == '\v' || c == '\f';
+}
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+const char* findLineEnd(const char* ptr, const char* end)
+{
+    const void* eol = std::memchr(ptr, '\n', end - ptr);
+    return eol ? static_cast<const char*>(eol) : end;
+}
+
+const char* parseWithStrtod(const char* ptr, const char* end, double& value)
+{
+    const char* stop = ptr;
+    while (stop != end && !isSeparator(*stop)) {
+        ++stop;
+    }
+
+    std::string token(ptr, stop);
+    char* last {};
+    value = std::strtod(token.c_str(), &last);
+    if (last != token.c_str() + token.size()) {
+        return nullptr;
+    }
+    return stop;
+}
+
+/// Parses the numbers of a line, returns false if the line contains something else
+bool parseLine(const char* ptr,
+               const char* eol,
+               double* row,
+               std::size_t columns,
+               std::size_t& count)
+{
+    count = 0;
+    for (;;) {
+        while (ptr != eol && isSeparator(*ptr)) {
+            ++ptr;
+        }
+        if (ptr == eol) {
+            return true;
+        }
+
+        double value {};
+        const char* next = AsciiParser::parseNumber(ptr, eol, value);
+        if (!next || (next != eol && !isSeparator(*next))) {
+            return false;
+        }
+        if (count < columns) {
+            row[count] = value;
+        }
+        ++count;
+        ptr = next;
+    }
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}  // namespace
+
+struct AsciiParser::Chunk
+{
+    const char* begin {nullptr};
+    const char* end {nullptr};
+    std::vector<double> values;
+    std::size_t rows {0};
+    std::size_t invalidRow {npos};
+    std::size_t offset {0};
+};
+
+AsciiParser::AsciiParser(const std::string& filename, std::size_t offset)
+{
+    Base::FileInfo fi(filename);
+    file = std::make_unique<QFile>(QString::fromUtf8(fi.filePath().c_str()));
+    if (!file->open(QIODevice::ReadOnly)) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+
+    qint64 size = file->size() - qint64(offset);
+    if (size <= 0) {
+        return;
+    }
+
+    // mapping the file avoids to hold a copy of huge files in memory
+    if (uchar* data = file->map(qint64(offset), size)) {
+        begin = reinterpret_cast<const char*>(data);  // NOLINT
+        end = begin + size;                           // NOLINT
+    }
+    else {
+        buffer.resize(std::size_t(size));
+        file->seek(qint64(offset));
+        size = file->read(buffer.data(), size);
+        begin = buffer.data();
+        end = begin + std::max<qint64>(size, 0);  // NOLINT
+    }
+}
+
+AsciiParser::AsciiParser(std::istream& inp)
+{
+    std::streampos pos = inp.tellg();
+    inp.seekg(0, std::ios::end);
+    std::streampos last = inp.tellg();
+    if (pos != std::streampos(-1) && last != std::streampos(-1)) {
+        inp.seekg(pos);
+        buffer.resize(std::size_t(last - pos));
+        inp.read(buffer.data(), std::streamsize(buffer.size()));
+        buffer.resize(std::size_t(inp.gcount()));
+    }
+    else {
+        inp.clear();
+        buffer.assign(std::istreambuf_iterator<char>(inp), std::istreambuf_iterator<char>());
+    }
+
+    begin = buffer.data();
+    end = begin + buffer.size();  // NOLINT
+}
+
+AsciiParser::AsciiParser(const char* text, std::size_t size)
+    : begin(text)
+    , end(text + size)  // NOLINT
+{}
+
+AsciiParser::~AsciiParser() = default;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+const char* AsciiParser::parseNumber(const char* ptr, const char* end, double& value)
+{
+    const char* start = ptr;
+    bool negative = false;
+    if (ptr != end && (*ptr == '-' || *ptr == '+')) {
+        negative = (*ptr == '-');
+        ++ptr;
+    }
+
+    std::uint64_t mantissa = 0;
+    int numDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    bool truncated = false;
+
+    auto addDigit = [&](char c) {
+        hasDigits = true;
+        if (numDigits < maxMantissaDigits) {
+            mantissa = mantissa * 10 + std::uint64_t(c - '0');
+            if (mantissa != 0) {
+                ++numDigits;
+            }
+            return true;
+        }
+        truncated = truncated || c != '0';
+        return false;
+    };
+
+    while (ptr != end && isDigit(*ptr)) {
+        if (!addDigit(*ptr)) {
+            ++exponent;
+        }
+        ++ptr;
+    }
+    if (ptr != end && *ptr == '.') {
+        ++ptr;
+        while (ptr != end && isDigit(*ptr)) {
+            if (addDigit(*ptr)) {
+                --exponent;
+            }
+            ++ptr;
+        }
+    }
+
+    if (!hasDigits) {
+        // nan, inf and alike
+        if (ptr != end && (*ptr == 'n' || *ptr == 'N' || *ptr == 'i' || *ptr == 'I')) {
+            return parseWithStrtod(start, end, value);
+        }
+        return nullptr;
+    }
+
+    if (ptr != end && (*ptr == 'e' || *ptr == 'E')) {
+        ++ptr;
+        bool negativeExp = false;
+        if (ptr != end && (*ptr == '-' || *ptr == '+')) {
+            negativeExp = (*ptr == '-');
+            ++ptr;
+        }
+        if (ptr == end || !isDigit(*ptr)) {
+            return nullptr;
+        }
+        int power = 0;
+        while (ptr != end && isDigit(*ptr)) {
+            if (power < 100000) {
+                power = power * 10 + (*ptr - '0');
+            }
+            ++ptr;
+        }
+        exponent += negativeExp ? -power : power;
+    }
+
+    if (mantissa == 0 && !truncated) {
+        value = negative ? -0.0 : 0.0;
+        return ptr;
+    }
+
+    // the conversion is exact if mantissa and power of ten are exact doubles
+    if (!truncated && mantissa <= maxExactMantissa && exponent >= -maxExactPower
+        && exponent <= maxExactPower) {
+        auto number = static_cast<double>(mantissa);
+        if (exponent < 0) {
+            number /= powersOfTen[-exponent];
+        }
+        else {
+            number *= powersOfTen[exponent];
+        }
+        value = negative ? -number : number;
+        return ptr;
+    }
+
+    return parseWithStrtod(start, end, value);
+}
+
+void AsciiParser::skipLines(std::size_t count)
+{
+    while (count > 0 && begin != end) {
+        const char* eol = findLineEnd(begin, end);
+        if (std::any_of(begin, eol, [](char c) {
+                return !isSeparator(c);
+            })) {
+            --count;
+        }
+        begin = eol == end ? end : eol + 1;
+    }
+}
+
+std::size_t AsciiParser::countColumns(std::size_t minColumns) const
+{
+    std::vector<double> row;
+    const char* ptr = begin;
+    while (ptr != end) {
+        const char* eol = findLineEnd(ptr, end);
+        std::size_t count = 0;
+        if (parseLine(ptr, eol, row.data(), 0, count) && count > 0 && count >= minColumns) {
+            return count;
+        }
+        ptr = eol == end ? end : eol + 1;
+    }
+    return 0;
+}
+
+void AsciiParser::parseChunk(Chunk& chunk, std::size_t minColumns, Mode mode) const
+{
+    const char* ptr = chunk.begin;
+    while (ptr != chunk.end) {
+        const char* eol = findLineEnd(ptr, chunk.end);
+        std::size_t pos = chunk.values.size();
+        chunk.values.resize(pos + numColumns, 0.0);
+
+        std::size_t count = 0;
+        bool valid = parseLine(ptr, eol, chunk.values.data() + pos, numColumns, count);
+        ptr = eol == chunk.end ? chunk.end : eol + 1;
+
+        if (valid && count == 0) {
+            // empty line
+            chunk.values.resize(pos);
+        }
+        else if (valid && count >= minColumns) {
+            ++chunk.rows;
+        }
+        else if (mode == Mode::Strict) {
+            if (chunk.invalidRow == npos) {
+                chunk.invalidRow = chunk.rows;
+            }
+            ++chunk.rows;
+        }
+        else {
+            chunk.values.resize(pos);
+        }
+    }
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+std::size_t AsciiParser::parse(std::size_t columns,
+                               std::size_t minColumns,
+                               Mode mode,
+                               std::size_t maxRows)
+{
+    numColumns = columns;
+    numRows = 0;
+    chunks.clear();
+
+    // split the text at line ends so that each chunk holds complete lines
+    const char* ptr = begin;
+    while (ptr != end) {
+        const char* stop = end;
+        if (std::size_t(end - ptr) > chunkSize) {
+            stop = findLineEnd(ptr + chunkSize, end);  // NOLINT
+            stop = stop == end ? end : stop + 1;       // NOLINT
+        }
+        Chunk chunk;
+        chunk.begin = ptr;
+        chunk.end = stop;
+        chunks.push_back(std::move(chunk));
+        ptr = stop;
+    }
+
+    QtConcurrent::blockingMap(chunks, [this, minColumns, mode](Chunk& chunk) {
+        parseChunk(chunk, minColumns, mode);
+    });
+
+    for (auto& chunk : chunks) {
+        chunk.offset = numRows;
+        if (chunk.invalidRow != npos && numRows + chunk.invalidRow < maxRows) {
+            throw Base::BadFormatError("Reading in points failed.");
+        }
+        numRows += chunk.rows;
+    }
+
+    numRows = std::min(numRows, maxRows);
+    return numRows;
+}
+
+bool AsciiParser::parseNext(std::size_t bytes,
+                            std::size_t columns,
+                            std::size_t minColumns,
+                            Mode mode,
+                            std::size_t maxRows)
+{
+    if (begin == end) {
+        numRows = 0;
+        chunks.clear();
+        return false;
+    }
+
+    const char* last = end;
+    if (std::size_t(end - begin) > bytes) {
+        const char* stop = findLineEnd(begin + bytes, end);  // NOLINT
+        end = stop == end ? end : stop + 1;                  // NOLINT
+    }
+
+    // the block is parsed as if it were the whole text
+    try {
+        parse(columns, minColumns, mode, maxRows);
+    }
+    catch (...) {
+        begin = end;
+        end = last;
+        throw;
+    }
+    begin = end;
+    end = last;
+    return true;
+}
+
+void AsciiParser::forEachRow(const std::function<void(std::size_t, const double*)>& func)
+{
+    std::size_t rows = numRows;
+    std::size_t columns = numColumns;
+    QtConcurrent::blockingMap(chunks, [&func, rows, columns](Chunk& chunk) {
+        const double* values = chunk.values.data();
+        for (std::size_t i = 0; i < chunk.rows && chunk.offset + i < rows; i++) {
+            func(chunk.offset + i, values + i * columns);  // NOLINT
+        }
+    });
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_ASCIIPARSER_H
+#define POINTS_ASCIIPARSER_H
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Mod/Points/PointsGlobal.h>
+
+class QFile;
+
+
+namespace Points
+{
+
+/** Parser for the ASCII data of point cloud files
+ *
+ * The text is split into chunks at line ends and the chunks are parsed
+ * concurrently. Every line holds one row of numbers separated by blanks,
+ * tabs, commas or semicolons. Empty lines are ignored.
+ *
+ * Numbers whose digits and power of ten are exact doubles are converted
+ * directly, which covers the output of scanners and CAD systems, all
+ * others fall back to strtod().
+ */
+class PointsExport AsciiParser
+{
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    enum class Mode
+    {
+        /// Lines that are not a row of numbers are skipped (comments, headers)
+        Skip,
+        /// Lines that are not a row of numbers raise an error
+        Strict
+    };
+
+    /// Maps the content of \a filename behind \a offset bytes into memory
+    explicit AsciiParser(const std::string& filename, std::size_t offset = 0);
+    /// Reads the remaining content of \a inp
+    explicit AsciiParser(std::istream& inp);
+    /// Parses \a size bytes of \a text, the text must outlive the parser
+    AsciiParser(const char* text, std::size_t size);
+    ~AsciiParser();
+
+    /// Ignores the next \a count non-empty lines
+    void skipLines(std::size_t count);
+    /// Returns the number of values of the first row with at least \a minColumns values
+    std::size_t countColumns(std::size_t minColumns = 1) const;
+
+    /** Parses the rows with \a columns values each. Missing values are set to zero
+     * and surplus values are ignored. Rows with less than \a minColumns values are
+     * treated like lines with invalid numbers. At most \a maxRows rows are kept.
+     * Returns the number of rows.
+     * @throws Base::BadFormatError in Strict mode if a row is invalid.
+     */
+    std::size_t parse(std::size_t columns,
+                      std::size_t minColumns = 1,
+                      Mode mode = Mode::Strict,
+                      std::size_t maxRows = npos);
+    /** Parses the rows of the next \a bytes of text like parse() and moves behind them,
+     * so that huge files can be handled block by block. Returns false at the end.
+     */
+    bool parseNext(std::size_t bytes,
+                   std::size_t columns,
+                   std::size_t minColumns = 1,
+                   Mode mode = Mode::Strict,
+                   std::size_t maxRows = npos);
+    /// Number of rows of the last call of parse()
+    std::size_t size() const
+    {
+        return numRows;
+    }
+    /// Number of values per row of the last call of parse()
+    std::size_t getColumns() const
+    {
+        return numColumns;
+    }
+    /// Calls \a func concurrently for each row with its index and values
+    void forEachRow(const std::function<void(std::size_t, const double*)>& func);
+
+    /// Converts the number at \a ptr, returns the end of the number or nullptr
+    static const char* parseNumber(const char* ptr, const char* end, double& value);
+
+    AsciiParser(const AsciiParser&) = delete;
+    AsciiParser(AsciiParser&&) = delete;
+    AsciiParser& operator=(const AsciiParser&) = delete;
+    AsciiParser& operator=(AsciiParser&&) = delete;
+
+private:
+    struct Chunk;
+    void parseChunk(Chunk& chunk, std::size_t minColumns, Mode mode) const;
+
+private:
+    std::unique_ptr<QFile> file;
+    std::vector<char> buffer;
+    const char* begin {nullptr};
+    const char* end {nullptr};
+    std::vector<Chunk> chunks;
+    std::size_t numRows {0};
+    std::size_t numColumns {0};
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_ASCIIPARSER_H
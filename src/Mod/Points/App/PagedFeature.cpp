@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <vector>
+#endif
+
+#include <Base/FileInfo.h>
+
+#include "PagedFeature.h"
+#include "PagedPointKernel.h"
+
+
+using namespace Points;
+
+//===========================================================================
+// PagedFeature
+//===========================================================================
+/*
+import Points
+pts=App.ActiveDocument.addObject('Points::PagedFeature','Scan')
+pts.CacheDirectory='/path/to/cache'
+pts.MaxPoints=500000
+App.ActiveDocument.recompute()
+*/
+
+// ---------------------------------------------------------
+
+PROPERTY_SOURCE(Points::PagedFeature, Points::Feature)
+
+PagedFeature::PagedFeature()
+{
+    ADD_PROPERTY_TYPE(CacheDirectory,
+                      (""),
+                      "Paged points",
+                      App::Prop_None,
+                      "Directory with the pages of the point cloud");
+    ADD_PROPERTY_TYPE(MaxPoints,
+                      (2000000),
+                      "Paged points",
+                      App::Prop_None,
+                      "Maximum number of points loaded into memory");
+}
+
+PagedFeature::~PagedFeature() = default;
+
+PagedPointKernel* PagedFeature::getKernel() const
+{
+    if (!kernel) {
+        std::string dir = CacheDirectory.getValue().string();
+        if (dir.empty() || !Base::FileInfo(dir).isDir()) {
+            return nullptr;
+        }
+        kernel = std::make_unique<PagedPointKernel>(dir);
+    }
+
+    return kernel->isBuilt() ? kernel.get() : nullptr;
+}
+
+short PagedFeature::mustExecute() const
+{
+    if (CacheDirectory.isTouched() || MaxPoints.isTouched()) {
+        return 1;
+    }
+    return Feature::mustExecute();
+}
+
+App::DocumentObjectExecReturn* PagedFeature::execute()
+{
+    PagedPointKernel* paged = getKernel();
+    if (!paged) {
+        return new App::DocumentObjectExecReturn("No paged point cloud in cache directory");
+    }
+
+    auto maxPoints = static_cast<std::size_t>(std::max<long>(MaxPoints.getValue(), 1));
+    std::vector<PointKernel::value_type> lod = paged->getLevelOfDetail(maxPoints);
+    PointKernel* pts = Points.startEditing();
+    pts->swap(lod);
+    Points.finishEditing();
+    return App::DocumentObject::StdReturn;
+}
+
+void PagedFeature::onChanged(const App::Property* prop)
+{
+    if (prop == &CacheDirectory) {
+        kernel.reset();
+    }
+
+    Feature::onChanged(prop);
+}
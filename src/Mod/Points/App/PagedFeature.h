@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_PAGEDFEATURE_H
+#define POINTS_PAGEDFEATURE_H
+
+#include <memory>
+
+#include <App/PropertyStandard.h>
+
+#include "PointsFeature.h"
+
+
+namespace Points
+{
+class PagedPointKernel;
+
+/*! The PagedFeature class refers to a huge point cloud that is kept out-of-core in the
+  cache directory of a PagedPointKernel. The Points property only holds a level of detail
+  with at most MaxPoints points that is used for display and by the algorithms working
+  on a Points::Feature.
+ */
+class PointsExport PagedFeature: public Feature
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(Points::PagedFeature);
+
+public:
+    /// Constructor
+    PagedFeature();
+    ~PagedFeature() override;
+
+    App::PropertyPath CacheDirectory; /**< The cache directory of the paged points. */
+    App::PropertyInteger MaxPoints;   /**< The maximum number of points to load. */
+
+    /// Returns the paged points or null if the cache directory holds no octree
+    PagedPointKernel* getKernel() const;
+
+    /** @name methods override Feature */
+    //@{
+    short mustExecute() const override;
+    /// recalculate the Feature
+    App::DocumentObjectExecReturn* execute() override;
+
+protected:
+    void onChanged(const App::Property* prop) override;
+    //@}
+
+private:
+    mutable std::unique_ptr<PagedPointKernel> kernel;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_PAGEDFEATURE_H
@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <iomanip>
+#include <queue>
+
+#include <QFile>
+#endif
+
+#include <App/Application.h>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "PagedPointKernel.h"
+
+
+using namespace Points;
+
+namespace
+{
+// Nodes deeper than this are not split anymore, e.g. for duplicated points
+constexpr int maxNodeDepth = 20;
+// The subsample of a node is taken from the finest grid with 2^k cells per side
+// that has not more occupied cells than the page size
+constexpr int maxGridLevel = 7;
+constexpr std::size_t writeBufferSize = 16384;
+constexpr const char* indexHeader = "PagedPointKernel";
+constexpr int indexVersion = 1;
+
+class PageWriter
+{
+public:
+    explicit PageWriter(const std::string& filename)
+        : out(Base::FileInfo(filename), std::ios::out | std::ios::binary | std::ios::trunc)
+    {
+        if (!out) {
+            throw Base::FileException("Cannot create page file", filename.c_str());
+        }
+        buffer.reserve(writeBufferSize);
+    }
+    ~PageWriter()
+    {
+        flush();
+    }
+    void add(const Base::Vector3f& pnt)
+    {
+        buffer.push_back(pnt);
+        if (buffer.size() == writeBufferSize) {
+            flush();
+        }
+        ++count;
+    }
+    std::uint64_t size() const
+    {
+        return count;
+    }
+
+    PageWriter(const PageWriter&) = delete;
+    PageWriter(PageWriter&&) = delete;
+    PageWriter& operator=(const PageWriter&) = delete;
+    PageWriter& operator=(PageWriter&&) = delete;
+
+private:
+    void flush()
+    {
+        out.write(reinterpret_cast<const char*>(buffer.data()),  // NOLINT
+                  std::streamsize(buffer.size() * sizeof(Base::Vector3f)));
+        buffer.clear();
+    }
+
+private:
+    Base::ofstream out;
+    std::vector<Base::Vector3f> buffer;
+    std::uint64_t count {0};
+};
+
+Base::BoundBox3f getOctantBox(const Base::BoundBox3f& box, int octant)
+{
+    Base::Vector3f center = box.GetCenter();
+    Base::BoundBox3f child = box;
+    ((octant & 1) ? child.MinX : child.MaxX) = center.x;
+    ((octant & 2) ? child.MinY : child.MaxY) = center.y;
+    ((octant & 4) ? child.MinZ : child.MaxZ) = center.z;
+    return child;
+}
+
+int getOctant(const Base::Vector3f& center, const Base::Vector3f& pnt)
+{
+    return (pnt.x >= center.x ? 1 : 0) | (pnt.y >= center.y ? 2 : 0) | (pnt.z >= center.z ? 4 : 0);
+}
+
+/// Cell of the finest grid, the cells of the coarser grids follow by shifting
+std::array<std::size_t, 3> getCell(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    constexpr std::ptrdiff_t grid = std::ptrdiff_t(1) << maxGridLevel;
+    auto index = [](float value) {
+        auto cell = static_cast<std::ptrdiff_t>(value * float(grid));
+        return std::size_t(std::clamp<std::ptrdiff_t>(cell, 0, grid - 1));
+    };
+    return {index((pnt.x - box.MinX) / box.LengthX()),
+            index((pnt.y - box.MinY) / box.LengthY()),
+            index((pnt.z - box.MinZ) / box.LengthZ())};
+}
+
+std::size_t getCellIndex(const std::array<std::size_t, 3>& cell, int level)
+{
+    int shift = maxGridLevel - level;
+    return ((((cell[2] >> shift) << level) + (cell[1] >> shift)) << level) + (cell[0] >> shift);
+}
+}  // namespace
+
+class PagedPointKernel::Page
+{
+public:
+    explicit Page(const std::string& filename)
+        : file(QString::fromUtf8(filename.c_str()))
+    {
+        if (!file.open(QIODevice::ReadOnly)) {
+            throw Base::FileException("Cannot open page file", filename.c_str());
+        }
+
+        qint64 bytes = file.size();
+        count = std::size_t(bytes) / sizeof(value_type);
+        if (count == 0) {
+            return;
+        }
+        if (uchar* data = file.map(0, bytes)) {
+            points = reinterpret_cast<const value_type*>(data);  // NOLINT
+        }
+        else {
+            buffer.resize(count);
+            file.read(reinterpret_cast<char*>(buffer.data()),  // NOLINT
+                      qint64(count * sizeof(value_type)));
+            points = buffer.data();
+        }
+    }
+    const value_type* data() const
+    {
+        return points;
+    }
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    Page(const Page&) = delete;
+    Page(Page&&) = delete;
+    Page& operator=(const Page&) = delete;
+    Page& operator=(Page&&) = delete;
+
+private:
+    QFile file;
+    std::vector<value_type> buffer;
+    const value_type* points {nullptr};
+    std::size_t count {0};
+};
+
+PagedPointKernel::PagedPointKernel(const std::string& dir, std::size_t size)
+    : directory(dir)
+    , pageSize(std::max<std::size_t>(size, 1))
+{
+    if (directory.empty()) {
+        Base::FileInfo cache(App::Application::getUserCachePath() + "PointCache");
+        cache.createDirectories();
+        directory = Base::FileInfo::getTempFileName("Points", cache.filePath().c_str());
+        temporary = true;
+    }
+
+    Base::FileInfo fi(directory);
+    if (!fi.exists() && !fi.createDirectories()) {
+        throw Base::FileException("Cannot create cache directory", fi);
+    }
+
+    loadIndex();
+}
+
+PagedPointKernel::~PagedPointKernel()
+{
+    staging.reset();
+    lastPage.reset();
+    if (temporary) {
+        Base::FileInfo(directory).deleteDirectoryRecursive();
+    }
+}
+
+std::string PagedPointKernel::getPageFile(const std::string& name) const
+{
+    return directory + "/" + name + ".bin";
+}
+
+std::string PagedPointKernel::getIndexFile() const
+{
+    return directory + "/index.txt";
+}
+
+void PagedPointKernel::append(const value_type* points, std::size_t count)
+{
+    if (isBuilt()) {
+        throw Base::RuntimeError("Cannot add points to a built octree");
+    }
+
+    if (!staging) {
+        Base::FileInfo fi(getPageFile("staging"));
+        staging = std::make_unique<Base::ofstream>(fi, std::ios::out | std::ios::binary);
+        if (!*staging) {
+            throw Base::FileException("Cannot create page file", fi);
+        }
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        boundBox.Add(points[i]);  // NOLINT
+    }
+    staging->write(reinterpret_cast<const char*>(points),  // NOLINT
+                   std::streamsize(count * sizeof(value_type)));
+    numPoints += count;
+}
+
+void PagedPointKernel::build()
+{
+    if (isBuilt()) {
+        return;
+    }
+
+    std::string input = getPageFile("staging");
+    if (staging) {
+        staging->close();
+        staging.reset();
+    }
+    else {
+        // an empty cloud
+        Base::ofstream str(Base::FileInfo(input), std::ios::out | std::ios::binary);
+    }
+
+    // the octree cells are cubes
+    Node root;
+    root.name = "r";
+    if (boundBox.IsValid()) {
+        Base::Vector3f center = boundBox.GetCenter();
+        float length = std::max({boundBox.LengthX(), boundBox.LengthY(), boundBox.LengthZ()});
+        root.box = Base::BoundBox3f(center, length > 0.0F ? 0.5F * length : 1.0F);
+    }
+    nodes.push_back(root);
+
+    buildNode(0, input);
+    sortLevelOrder();
+    saveIndex();
+}
+
+void PagedPointKernel::buildNode(std::size_t index, const std::string& input)
+{
+    const Node node = nodes[index];
+    const Base::Vector3f center = node.box.GetCenter();
+    std::array<std::uint64_t, 8> counts {};
+    std::uint64_t total = 0;
+
+    {
+        Page page(input);
+        total = page.size();
+        if (total <= pageSize || node.depth >= maxNodeDepth) {
+            nodes[index].count = total;
+        }
+        else {
+            const value_type* points = page.data();
+
+            // count the occupied cells of all grids to pick the finest one whose cells
+            // can be represented by one point each
+            int level = 0;
+            {
+                std::array<std::vector<bool>, maxGridLevel + 1> occupied;
+                std::array<std::size_t, maxGridLevel + 1> numCells {};
+                for (int j = 0; j <= maxGridLevel; j++) {
+                    occupied[j].resize(std::size_t(1) << (3 * j));
+                }
+                for (std::size_t i = 0; i < total; i++) {
+                    std::array<std::size_t, 3> cell = getCell(node.box, points[i]);  // NOLINT
+                    for (int j = maxGridLevel; j > 0; j--) {
+                        std::size_t index = getCellIndex(cell, j);
+                        if (occupied[j][index]) {
+                            // then the cell of the coarser grids is occupied, too
+                            break;
+                        }
+                        occupied[j][index] = true;
+                        numCells[j]++;
+                    }
+                }
+                for (int j = maxGridLevel; j > 0; j--) {
+                    if (numCells[j] <= pageSize) {
+                        level = j;
+                        break;
+                    }
+                }
+            }
+
+            // the first point of each cell belongs to the node, the others to the children
+            std::vector<bool> occupied(std::size_t(1) << (3 * level));
+            PageWriter own(getPageFile(node.name));
+            std::array<std::unique_ptr<PageWriter>, 8> writers;
+            for (std::size_t i = 0; i < total; i++) {
+                const value_type& pnt = points[i];  // NOLINT
+                std::size_t cell = getCellIndex(getCell(node.box, pnt), level);
+                if (!occupied[cell]) {
+                    occupied[cell] = true;
+                    own.add(pnt);
+                    continue;
+                }
+
+                int octant = getOctant(center, pnt);
+                if (!writers[octant]) {
+                    std::string name = node.name + char('0' + octant);
+                    writers[octant] = std::make_unique<PageWriter>(getPageFile(name) + ".tmp");
+                }
+                writers[octant]->add(pnt);
+            }
+
+            nodes[index].count = own.size();
+            for (int i = 0; i < 8; i++) {
+                counts[i] = writers[i] ? writers[i]->size() : 0;
+            }
+        }
+    }
+
+    if (total <= pageSize || node.depth >= maxNodeDepth) {
+        Base::FileInfo(input).renameFile(getPageFile(node.name).c_str());
+        return;
+    }
+
+    Base::FileInfo(input).deleteFile();
+    for (int i = 0; i < 8; i++) {
+        if (counts[i] > 0) {
+            Node child;
+            child.name = node.name + char('0' + i);
+            child.box = getOctantBox(node.box, i);
+            child.depth = node.depth + 1;
+            nodes.push_back(child);
+            nodes[index].children[i] = std::int32_t(nodes.size() - 1);
+            buildNode(nodes.size() - 1, getPageFile(child.name) + ".tmp");
+        }
+    }
+}
+
+void PagedPointKernel::sortLevelOrder()
+{
+    std::vector<Node> sorted;
+    sorted.reserve(nodes.size());
+    std::queue<std::size_t> queue;
+    queue.push(0);
+    while (!queue.empty()) {
+        Node node = nodes[queue.front()];
+        queue.pop();
+        for (auto& child : node.children) {
+            if (child >= 0) {
+                queue.push(std::size_t(child));
+                child = std::int32_t(sorted.size() + queue.size());
+            }
+        }
+        sorted.push_back(node);
+    }
+
+    std::uint64_t offset = 0;
+    for (auto& node : sorted) {
+        node.offset = offset;
+        offset += node.count;
+    }
+    nodes.swap(sorted);
+}
+
+void PagedPointKernel::saveIndex() const
+{
+    Base::ofstream str(Base::FileInfo(getIndexFile()), std::ios::out | std::ios::trunc);
+    str << std::setprecision(9);
+    str << indexHeader << " " << indexVersion << " " << numPoints << " " << nodes.size() << '\n';
+    str << boundBox.MinX << " " << boundBox.MinY << " " << boundBox.MinZ << " " << boundBox.MaxX
+        << " " << boundBox.MaxY << " " << boundBox.MaxZ << '\n';
+    for (const auto& node : nodes) {
+        const Base::BoundBox3f& box = node.box;
+        str << node.name << " " << node.depth << " " << node.count << " " << box.MinX << " "
+            << box.MinY << " " << box.MinZ << " " << box.MaxX << " " << box.MaxY << " "
+            << box.MaxZ;
+        for (auto child : node.children) {
+            str << " " << child;
+        }
+        str << '\n';
+    }
+}
+
+bool PagedPointKernel::loadIndex()
+{
+    Base::FileInfo fi(getIndexFile());
+    if (!fi.exists()) {
+        return false;
+    }
+
+    Base::ifstream str(fi, std::ios::in);
+    std::string header;
+    int version = 0;
+    std::size_t numNodes = 0;
+    str >> header >> version >> numPoints >> numNodes;
+    if (header != indexHeader || version != indexVersion) {
+        throw Base::BadFormatError("Unsupported point cache index");
+    }
+    str >> boundBox.MinX >> boundBox.MinY >> boundBox.MinZ >> boundBox.MaxX >> boundBox.MaxY
+        >> boundBox.MaxZ;
+
+    std::uint64_t offset = 0;
+    nodes.resize(numNodes);
+    for (auto& node : nodes) {
+        Base::BoundBox3f& box = node.box;
+        str >> node.name >> node.depth >> node.count >> box.MinX >> box.MinY >> box.MinZ
+            >> box.MaxX >> box.MaxY >> box.MaxZ;
+        for (auto& child : node.children) {
+            str >> child;
+        }
+        node.offset = offset;
+        offset += node.count;
+    }
+
+    if (!str || offset != numPoints) {
+        nodes.clear();
+        throw Base::BadFormatError("Corrupted point cache index");
+    }
+    return true;
+}
+
+int PagedPointKernel::getMaxDepth() const
+{
+    return nodes.empty() ? 0 : nodes.back().depth;
+}
+
+void PagedPointKernel::forEachPage(const PageFunction& func, int maxDepth) const
+{
+    for (const auto& node : nodes) {
+        if (maxDepth >= 0 && node.depth > maxDepth) {
+            break;
+        }
+        if (node.count > 0) {
+            Page page(getPageFile(node.name));
+            func(page.data(), page.size());
+        }
+    }
+}
+
+std::vector<std::size_t> PagedPointKernel::selectLevels(const Base::BoundBox3f& box,
+                                                        std::size_t maxPoints) const
+{
+    std::vector<std::uint64_t> levels(std::size_t(getMaxDepth()) + 1);
+    for (const auto& node : nodes) {
+        if (node.box.Intersect(box)) {
+            levels[node.depth] += node.count;
+        }
+    }
+
+    // the finest level so that all coarser levels together fit into the budget
+    int depth = 0;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < levels.size(); i++) {
+        total += levels[i];
+        if (total > maxPoints) {
+            break;
+        }
+        depth = int(i);
+    }
+
+    std::vector<std::size_t> selection;
+    for (std::size_t i = 0; i < nodes.size() && nodes[i].depth <= depth; i++) {
+        if (nodes[i].count > 0 && nodes[i].box.Intersect(box)) {
+            selection.push_back(i);
+        }
+    }
+    return selection;
+}
+
+std::vector<PagedPointKernel::value_type>
+PagedPointKernel::getLevelOfDetail(std::size_t maxPoints) const
+{
+    if (nodes.empty()) {
+        return {};
+    }
+    return getLevelOfDetail(nodes.front().box, maxPoints);
+}
+
+std::vector<PagedPointKernel::value_type>
+PagedPointKernel::getLevelOfDetail(const Base::BoundBox3f& box, std::size_t maxPoints) const
+{
+    std::vector<std::size_t> selection = selectLevels(box, maxPoints);
+    std::uint64_t total = 0;
+    for (std::size_t index : selection) {
+        total += nodes[index].count;
+    }
+
+    // if even the root exceeds the budget only every n-th point is taken
+    std::uint64_t stride = 1;
+    if (maxPoints > 0 && total > maxPoints) {
+        stride = (total + maxPoints - 1) / maxPoints;
+    }
+
+    std::vector<value_type> points;
+    points.reserve(std::size_t(std::min<std::uint64_t>(total, maxPoints)));
+    std::uint64_t counter = 0;
+    for (std::size_t index : selection) {
+        Page page(getPageFile(nodes[index].name));
+        const value_type* data = page.data();
+        for (std::size_t i = 0; i < page.size(); i++) {
+            if (box.IsInBox(data[i]) && counter++ % stride == 0) {  // NOLINT
+                points.push_back(data[i]);                        // NOLINT
+            }
+        }
+    }
+
+    return points;
+}
+
+PagedPointKernel::value_type PagedPointKernel::getPoint(std::uint64_t index) const
+{
+    if (index >= numPoints) {
+        throw Base::IndexError("Point index out of range");
+    }
+
+    // the last node whose offset is not greater than the index
+    auto it = std::upper_bound(nodes.begin(),
+                               nodes.end(),
+                               index,
+                               [](std::uint64_t value, const Node& node) {
+                                   return value < node.offset;
+                               });
+    std::size_t node = std::size_t(std::distance(nodes.begin(), it)) - 1;
+    while (nodes[node].count == 0) {
+        --node;
+    }
+
+    if (!lastPage || lastNode != node) {
+        lastPage.reset();
+        lastPage = std::make_unique<Page>(getPageFile(nodes[node].name));
+        lastNode = node;
+    }
+    return lastPage->data()[index - nodes[node].offset];  // NOLINT
+}
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef POINTS_PAGEDPOINTKERNEL_H
+#define POINTS_PAGEDPOINTKERNEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Base
+{
+class ofstream;
+}
+
+namespace Points
+{
+
+/** Out-of-core storage of huge point clouds
+ *
+ * The points are kept in an octree whose nodes are stored as page files in
+ * a cache directory. Every node holds a spatially even subsample of the points
+ * inside its box and its children hold the rest, so that the nodes up to a
+ * certain depth give a level of detail of the whole cloud. The pages are
+ * memory-mapped while they are accessed, so that the cloud may be much larger
+ * than the available memory.
+ *
+ * The points are added with append() and the octree is created with build().
+ * Afterwards the cache directory can be opened again without rebuilding.
+ */
+class PointsExport PagedPointKernel
+{
+public:
+    using value_type = Base::Vector3f;
+    using PageFunction = std::function<void(const value_type*, std::size_t)>;
+
+    /** Uses \a directory as cache. If it contains an octree it is opened, otherwise
+     * the points must be added. If \a directory is empty a temporary directory in the
+     * user cache is used that is removed together with the kernel.
+     * \a pageSize is the maximum number of points of a leaf node.
+     */
+    explicit PagedPointKernel(const std::string& directory = std::string(),
+                              std::size_t pageSize = 65536);
+    ~PagedPointKernel();
+
+    /// The cache directory
+    const std::string& getDirectory() const
+    {
+        return directory;
+    }
+    /// Removes the cache directory together with the kernel
+    void setTemporary(bool on)
+    {
+        temporary = on;
+    }
+
+    /** @name Creation */
+    //@{
+    /// Adds \a count points, this is only possible before build()
+    void append(const value_type* points, std::size_t count);
+    void append(const std::vector<value_type>& points)
+    {
+        append(points.data(), points.size());
+    }
+    /// Distributes the added points into the octree pages
+    void build();
+    /// Whether the octree is created
+    bool isBuilt() const
+    {
+        return !nodes.empty();
+    }
+    //@}
+
+    /** @name Access */
+    //@{
+    /// Number of points
+    std::uint64_t size() const
+    {
+        return numPoints;
+    }
+    /// Bounding box of the points
+    const Base::BoundBox3f& getBoundBox() const
+    {
+        return boundBox;
+    }
+    /// Number of octree nodes
+    std::size_t countNodes() const
+    {
+        return nodes.size();
+    }
+    /// Depth of the deepest octree node, the root has depth zero
+    int getMaxDepth() const;
+    /** Calls \a func for the points of each node with a depth up to \a maxDepth. The nodes
+     * are visited level by level so that the coarse levels come first. Only the current
+     * page is mapped into memory. A negative \a maxDepth visits all nodes.
+     */
+    void forEachPage(const PageFunction& func, int maxDepth = -1) const;
+    /** Returns the points of the finest complete levels with at most \a maxPoints points.
+     * If even the root has more points it is thinned out.
+     */
+    std::vector<value_type> getLevelOfDetail(std::size_t maxPoints) const;
+    /// Same as above, restricted to the points inside \a box
+    std::vector<value_type> getLevelOfDetail(const Base::BoundBox3f& box,
+                                             std::size_t maxPoints) const;
+    /** Returns the point with \a index. The indexes follow the order of forEachPage().
+     * The last accessed page stays mapped, so sequential access is cheap.
+     */
+    value_type getPoint(std::uint64_t index) const;
+    //@}
+
+    PagedPointKernel(const PagedPointKernel&) = delete;
+    PagedPointKernel(PagedPointKernel&&) = delete;
+    PagedPointKernel& operator=(const PagedPointKernel&) = delete;
+    PagedPointKernel& operator=(PagedPointKernel&&) = delete;
+
+private:
+    struct Node
+    {
+        std::string name;
+        Base::BoundBox3f box;
+        std::uint64_t count {0};
+        std::uint64_t offset {0};
+        int depth {0};
+        std::array<std::int32_t, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+    };
+    class Page;
+
+    std::string getPageFile(const std::string& name) const;
+    std::string getIndexFile() const;
+    void buildNode(std::size_t index, const std::string& input);
+    void sortLevelOrder();
+    void saveIndex() const;
+    bool loadIndex();
+    std::vector<std::size_t> selectLevels(const Base::BoundBox3f& box,
+                                          std::size_t maxPoints) const;
+
+private:
+    std::string directory;
+    std::size_t pageSize;
+    bool temporary {false};
+    std::uint64_t numPoints {0};
+    Base::BoundBox3f boundBox;
+    std::vector<Node> nodes;
+    std::unique_ptr<Base::ofstream> staging;
+    mutable std::unique_ptr<Page> lastPage;
+    mutable std::size_t lastNode {0};
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_PAGEDPOINTKERNEL_H
@@ -25,13 +25,14 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <sstream>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>  // needed for compilation on some systems
-#include <boost/regex.hpp>
 #endif
 
 #include <Base/Console.h>
@@ -41,6 +42,8 @@
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 
+#include "AsciiParser.h"
+#include "PagedPointKernel.h"
 #include "PointsAlgos.h"
 #include <E57Format.h>
 
@@ -66,59 +69,28 @@ void PointsAlgos::Load(PointKernel& points, const char* FileName)
 
 void PointsAlgos::LoadAscii(PointKernel& points, const char* FileName)
 {
-    boost::regex rx("^\\s*([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-                    "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$");
-    // boost::regex rx("(\\b[0-9]+\\.([0-9]+\\b)?|\\.[0-9]+\\b)");
-    // boost::regex
-    // rx("^\\s*(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s+(-?[0-9]*)\\.([0-9]+)\\s*$");
-    boost::cmatch what;
-
-    Base::Vector3d pt;
-    int LineCnt = 0;
-    std::string line;
-    Base::FileInfo fi(FileName);
+    AsciiParser parser(FileName);
+    parser.parse(3, 3, AsciiParser::Mode::Skip);
+    LoadAscii(points, parser);
+}
 
-    Base::ifstream tmp_str(fi, std::ios::in);
+void PointsAlgos::LoadAscii(PointKernel& points, AsciiParser& parser)
+{
+    Base::Matrix4D mat(points.getTransform());
+    mat.inverse();
 
-    // estimating size
-    while (std::getline(tmp_str, line)) {
-        LineCnt++;
+    points.resize(parser.size());
+    std::vector<PointKernel::value_type>& kernel = points.getBasicPoints();
+    if (mat.isUnity()) {
+        parser.forEachRow([&kernel](std::size_t row, const double* values) {
+            kernel[row].Set(float(values[0]), float(values[1]), float(values[2]));  // NOLINT
+        });
     }
-
-    // resize the PointKernel
-    points.resize(LineCnt);
-
-    Base::SequencerLauncher seq("Loading points...", LineCnt);
-
-    // again to the beginning
-    Base::ifstream file(fi, std::ios::in);
-    LineCnt = 0;
-
-    try {
-        // read file
-        while (std::getline(file, line)) {
-            if (boost::regex_match(line.c_str(), what, rx)) {
-                pt.x = std::atof(what[1].first);
-                pt.y = std::atof(what[4].first);
-                pt.z = std::atof(what[7].first);
-
-                points.setPoint(LineCnt, pt);
-                seq.next();
-                LineCnt++;
-            }
-        }
-    }
-    catch (...) {
-        points.clear();
-        throw Base::BadFormatError("Reading in points failed.");
-    }
-
-    // now remove the last points from the kernel
-    // Note: first we allocate memory corresponding to the number of lines (points and comments)
-    //       and read in the file twice. But then the size of the kernel is too high
-    if (LineCnt < (int)points.size()) {
-        points.erase(LineCnt, points.size());
+    else {
+        parser.forEachRow([&kernel, &mat](std::size_t row, const double* values) {
+            Base::Vector3d pnt = mat * Base::Vector3d(values[0], values[1], values[2]);  // NOLINT
+            kernel[row].Set(float(pnt.x), float(pnt.y), float(pnt.z));
+        });
     }
 }
 
@@ -194,9 +166,98 @@ int Reader::getHeight() const
 
 AscReader::AscReader() = default;
 
+namespace
+{
+std::vector<Base::Vector3f> getColumns(AsciiParser& parser, std::size_t col)
+{
+    std::vector<Base::Vector3f> values(parser.size());
+    parser.forEachRow([&values, col](std::size_t row, const double* data) {
+        values[row].Set(float(data[col]), float(data[col + 1]), float(data[col + 2]));  // NOLINT
+    });
+    return values;
+}
+
+bool isNormalColumns(const std::vector<Base::Vector3f>& values)
+{
+    return std::all_of(values.begin(), values.end(), [](const Base::Vector3f& value) {
+        return std::fabs(value.Length() - 1.0F) < 1.0e-3F;
+    });
+}
+
+bool isColorColumns(const std::vector<Base::Vector3f>& values)
+{
+    return std::all_of(values.begin(), values.end(), [](const Base::Vector3f& value) {
+        return value.x >= 0.0F && value.x <= 255.0F && value.y >= 0.0F && value.y <= 255.0F
+            && value.z >= 0.0F && value.z <= 255.0F;
+    });
+}
+
+void readAsciiData(AsciiParser& parser, Eigen::MatrixXd& data)
+{
+    auto numPoints = std::size_t(data.rows());
+    auto numFields = std::size_t(data.cols());
+    data.setZero();
+    parser.parse(numFields, 1, AsciiParser::Mode::Strict, numPoints);
+    parser.forEachRow([&data, numFields](std::size_t row, const double* values) {
+        for (std::size_t col = 0; col < numFields; col++) {
+            data(Eigen::Index(row), Eigen::Index(col)) = values[col];  // NOLINT
+        }
+    });
+}
+}  // namespace
+
 void AscReader::read(const std::string& filename)
 {
-    points.load(filename.c_str());
+    clear();
+
+    // The columns behind x, y, z are interpreted the way common exports write them:
+    // x y z i, x y z r g b (or x y z nx ny nz), x y z i r g b and x y z r g b nx ny nz
+    AsciiParser parser(filename);
+    std::size_t columns = std::max<std::size_t>(parser.countColumns(3), 3);
+    parser.parse(columns, 3, AsciiParser::Mode::Skip);
+    PointsAlgos::LoadAscii(points, parser);
+
+    std::size_t colorColumn = 0;
+    std::size_t normalColumn = 0;
+    if (columns == 4 || columns == 7) {
+        intensity.resize(parser.size());
+        parser.forEachRow([this](std::size_t row, const double* data) {
+            intensity[row] = float(data[3]);  // NOLINT
+        });
+        colorColumn = columns == 7 ? 4 : 0;
+    }
+    else if (columns == 6) {
+        std::vector<Base::Vector3f> values = getColumns(parser, 3);
+        if (isNormalColumns(values)) {
+            normals.swap(values);
+        }
+        else {
+            colorColumn = 3;
+        }
+    }
+    else if (columns == 9) {
+        colorColumn = 3;
+        normalColumn = 6;
+    }
+
+    if (colorColumn > 0) {
+        std::vector<Base::Vector3f> values = getColumns(parser, colorColumn);
+        if (isColorColumns(values)) {
+            bool bytes = std::any_of(values.begin(), values.end(), [](const Base::Vector3f& value) {
+                return value.x > 1.0F || value.y > 1.0F || value.z > 1.0F;
+            });
+            float scale = bytes ? 1.0F / 255.0F : 1.0F;
+            colors.reserve(values.size());
+            for (const auto& value : values) {
+                colors.emplace_back(value.x * scale, value.y * scale, value.z * scale);
+            }
+        }
+    }
+
+    if (normalColumn > 0) {
+        normals = getColumns(parser, normalColumn);
+    }
+
     this->height = 1;
     this->width = points.size();
 }
@@ -717,6 +778,61 @@ void PlyReader::read(const std::string& filename)
     }
 }
 
+void PlyReader::read(const std::string& filename, PagedPointKernel& kernel)
+{
+    Base::FileInfo fi(filename);
+    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+
+    std::string format;
+    std::vector<std::string> fields;
+    std::vector<std::string> types;
+    std::vector<int> sizes;
+    std::size_t offset = 0;
+    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
+
+    auto x = std::distance(fields.begin(), std::find(fields.begin(), fields.end(), "x"));
+    auto y = std::distance(fields.begin(), std::find(fields.begin(), fields.end(), "y"));
+    auto z = std::distance(fields.begin(), std::find(fields.begin(), fields.end(), "z"));
+    auto numFields = Eigen::Index(fields.size());
+    if (x == numFields || y == numFields || z == numFields) {
+        throw Base::BadFormatError("Missing x, y or z field");
+    }
+
+    // the vertices are read in blocks so that only one block is in memory
+    const Eigen::Index blockSize = 1 << 20;
+    std::vector<Base::Vector3f> block;
+    if (format == "ascii") {
+        AsciiParser parser(filename, std::size_t(inp.tellg()));
+        parser.skipLines(offset);
+        auto remaining = std::size_t(numPoints);
+        while (remaining > 0
+               && parser.parseNext(std::size_t(32 * blockSize),
+                                   fields.size(),
+                                   1,
+                                   AsciiParser::Mode::Strict,
+                                   remaining)) {
+            block.resize(parser.size());
+            parser.forEachRow([&block, x, y, z](std::size_t row, const double* values) {
+                block[row].Set(float(values[x]), float(values[y]), float(values[z]));  // NOLINT
+            });
+            kernel.append(block);
+            remaining -= parser.size();
+        }
+    }
+    else if (format == "binary_little_endian" || format == "binary_big_endian") {
+        bool swapByteOrder = (format == "binary_big_endian");
+        for (Eigen::Index start = 0; start < numPoints; start += blockSize) {
+            Eigen::MatrixXd data(std::min(blockSize, numPoints - start), numFields);
+            readBinary(swapByteOrder, inp, start == 0 ? offset : 0, types, sizes, data);
+            block.resize(std::size_t(data.rows()));
+            for (Eigen::Index i = 0; i < data.rows(); i++) {
+                block[i].Set(float(data(i, x)), float(data(i, y)), float(data(i, z)));
+            }
+            kernel.append(block);
+        }
+    }
+}
+
 std::size_t PlyReader::readHeader(std::istream& in,
                                   std::string& format,
                                   std::size_t& offset,
@@ -889,35 +1005,9 @@ std::size_t PlyReader::readHeader(std::istream& in,
 
 void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    AsciiParser parser(inp);
+    parser.skipLines(offset);
+    readAsciiData(parser, data);
 }
 
 void PlyReader::readBinary(bool swapByteOrder,
@@ -1259,30 +1349,8 @@ std::size_t PcdReader::readHeader(std::istream& in,
 
 void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
 {
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
+    AsciiParser parser(inp);
+    readAsciiData(parser, data);
 }
 
 void PcdReader::readBinary(bool transpose,
@@ -1433,6 +1501,12 @@ public:
         return normals;
     }
 
+    /// Adds the coordinates to \a kernel instead of keeping them
+    void setPagedKernel(PagedPointKernel* kernel)
+    {
+        paged = kernel;
+    }
+
 private:
     void readData3D(const e57::VectorNode& data3D)
     {
@@ -1663,8 +1737,12 @@ private:
                 }
                 if (!filter) {
                     cnt_pts++;
-                    points.push_back(pt);
                     last = pt;
+                    if (paged) {
+                        pending.emplace_back(float(pt.x), float(pt.y), float(pt.z));
+                        continue;
+                    }
+                    points.push_back(pt);
                     if (hasColor) {
                         colors.push_back(getColor(proto, i));
                     }
@@ -1676,6 +1754,11 @@ private:
                     }
                 }
             }
+
+            if (paged) {
+                paged->append(pending);
+                pending.clear();
+            }
         }
     }
 
@@ -1773,6 +1856,8 @@ private:
     std::vector<float> intensity;
     PointKernel points;
     std::vector<Base::Vector3f> normals;
+    PagedPointKernel* paged {nullptr};
+    std::vector<Base::Vector3f> pending;
 };
 }  // namespace
 
@@ -1802,6 +1887,21 @@ void E57Reader::read(const std::string& filename)
     }
 }
 
+void E57Reader::read(const std::string& filename, PagedPointKernel& kernel)
+{
+    try {
+        E57ReaderImp reader(filename, useColor, checkState, minDistance);
+        reader.setPagedKernel(&kernel);
+        reader.read();
+    }
+    catch (const Base::Exception&) {
+        throw;
+    }
+    catch (...) {
+        throw Base::BadFormatError("Reading E57 file failed");
+    }
+}
+
 // ----------------------------------------------------------------------------
 
 Writer::Writer(const PointKernel& p)
@@ -32,6 +32,9 @@
 namespace Points
 {
 
+class AsciiParser;
+class PagedPointKernel;
+
 /** The Points algorithms container class
  */
 class PointsExport PointsAlgos
@@ -43,6 +46,9 @@ public:
     /** Load a point cloud
      */
     static void LoadAscii(PointKernel&, const char* FileName);
+    /** Load the first three columns of the parsed rows
+     */
+    static void LoadAscii(PointKernel&, AsciiParser& parser);
 };
 
 class PointsExport Reader
@@ -93,6 +99,8 @@ class PointsExport PlyReader: public Reader
 public:
     PlyReader();
     void read(const std::string& filename) override;
+    /// Adds the coordinates to \a kernel without loading the whole file into memory
+    void read(const std::string& filename, PagedPointKernel& kernel);
 
 private:
     std::size_t readHeader(std::istream&,
@@ -135,6 +143,8 @@ class PointsExport E57Reader: public Reader
 public:
     E57Reader(bool Color, bool State, double Distance);
     void read(const std::string& filename) override;
+    /// Adds the coordinates to \a kernel without loading the whole file into memory
+    void read(const std::string& filename, PagedPointKernel& kernel);
 
 protected:
     bool useColor, checkState;
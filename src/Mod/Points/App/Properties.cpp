@@ -181,9 +181,9 @@ void PropertyGreyValueList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyGreyValueList::getMemSize() const
+std::size_t PropertyGreyValueList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    return _lValueList.size() * sizeof(float);
 }
 
 void PropertyGreyValueList::removeIndices(const std::vector<unsigned long>& uIndices)
@@ -353,9 +353,9 @@ void PropertyNormalList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyNormalList::getMemSize() const
+std::size_t PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    return _lValueList.size() * sizeof(Base::Vector3f);
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -636,7 +636,7 @@ void PropertyCurvatureList::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyCurvatureList::getMemSize() const
+std::size_t PropertyCurvatureList::getMemSize() const
 {
     return sizeof(CurvatureInfo) * this->_lValueList.size();
 }
@@ -88,7 +88,7 @@ public:
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Modify */
     //@{
@@ -141,7 +141,7 @@ public:
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     /** @name Modify */
     //@{
@@ -223,7 +223,7 @@ public:
     App::Property* Copy() const override;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Modify */
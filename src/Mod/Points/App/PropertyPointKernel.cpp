@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <utility>
 #endif
 
 #include <Base/Matrix.h>
@@ -43,9 +44,15 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+PropertyPointKernel::~PropertyPointKernel()
+{
+    unshare();
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
+    detachCopy(&m == &*_cPoints);
     *_cPoints = m;
     hasSetValue();
 }
@@ -62,6 +69,7 @@ const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detachCopy(true);
     _cPoints->setTransform(rclTrf);
 }
 
@@ -77,6 +85,10 @@ Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 
 PyObject* PropertyPointKernel::getPyObject()
 {
+    // the wrapper must not reference the point kernel of the owner
+    if (sharedOwner) {
+        detachCopy(true);
+    }
     PointsPy* points = new PointsPy(&*_cPoints);
     points->setConst();  // set immutable
     return points;
@@ -115,6 +127,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detachCopy(true);
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,6 +142,7 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachCopy(true);
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
@@ -136,7 +150,16 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 App::Property* PropertyPointKernel::Copy() const
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    if (sharedCopy || sharedOwner) {
+        (*prop->_cPoints) = (*this->_cPoints);
+    }
+    else {
+        // The copy references the same point kernel until one of both properties
+        // gets modified. So, an undo step of unchanged points doesn't duplicate them.
+        prop->_cPoints = this->_cPoints;
+        prop->sharedOwner = this;
+        sharedCopy = prop;
+    }
     return prop;
 }
 
@@ -144,18 +167,56 @@ void PropertyPointKernel::Paste(const App::Property& from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
+    detachCopy(false);
     *(this->_cPoints) = *(prop._cPoints);
     hasSetValue();
 }
 
-unsigned int PropertyPointKernel::getMemSize() const
+void PropertyPointKernel::detachCopy(bool keepContent)
 {
+    if (sharedCopy) {
+        // The copy gets the current data and this property keeps its kernel.
+        // If the data will be replaced anyway it is moved to the copy.
+        Base::Reference<PointKernel> points(new PointKernel());
+        if (keepContent) {
+            *points = *_cPoints;
+        }
+        else {
+            *points = std::move(*_cPoints);
+        }
+        sharedCopy->_cPoints = points;
+    }
+    else if (sharedOwner) {
+        _cPoints = new PointKernel(*_cPoints);
+    }
+    unshare();
+}
+
+void PropertyPointKernel::unshare()
+{
+    if (sharedCopy) {
+        sharedCopy->sharedOwner = nullptr;
+        sharedCopy = nullptr;
+    }
+    if (sharedOwner) {
+        sharedOwner->sharedCopy = nullptr;
+        sharedOwner = nullptr;
+    }
+}
+
+std::size_t PropertyPointKernel::getMemSize() const
+{
+    // A copy sharing the point kernel of its owner is already counted by the owner
+    if (sharedOwner) {
+        return 0;
+    }
     return sizeof(Base::Vector3f) * this->_cPoints->size();
 }
 
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detachCopy(true);
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +260,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachCopy(true);
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -37,6 +37,7 @@ class PointsExport PropertyPointKernel: public App::PropertyComplexGeoData
 
 public:
     PropertyPointKernel();
+    ~PropertyPointKernel() override;
 
     /** @name Getter/setter */
     //@{
@@ -67,7 +68,7 @@ public:
     App::Property* Copy() const override;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     //@}
 
     /** @name Save/restore */
@@ -87,8 +88,16 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    void detachCopy(bool keepContent);
+    void unshare();
+
 private:
     Base::Reference<PointKernel> _cPoints;
+    // The copy made by Copy() (mainly for undo/redo) shares the point kernel
+    // with this property until one of them gets modified.
+    mutable PropertyPointKernel* sharedCopy {nullptr};
+    const PropertyPointKernel* sharedOwner {nullptr};
 };
 
 }  // namespace Points
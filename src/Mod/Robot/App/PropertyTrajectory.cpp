@@ -114,7 +114,7 @@ void PropertyTrajectory::Paste(const App::Property& from)
     hasSetValue();
 }
 
-unsigned int PropertyTrajectory::getMemSize() const
+std::size_t PropertyTrajectory::getMemSize() const
 {
     return _Trajectory.getMemSize();
 }
@@ -154,7 +154,7 @@ void Robot6Axis::readKinematic(const char* FileName)
     setKinematic(temp);
 }
 
-unsigned int Robot6Axis::getMemSize() const
+std::size_t Robot6Axis::getMemSize() const
 {
     return 0;
 }
@@ -313,7 +313,7 @@ void Trajectory::addWaypoint(const Waypoint& WPnt)
 }
 
 
-unsigned int Trajectory::getMemSize() const
+std::size_t Trajectory::getMemSize() const
 {
     return 0;
 }
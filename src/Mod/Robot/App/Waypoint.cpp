@@ -68,7 +68,7 @@ Waypoint::Waypoint()
 
 Waypoint::~Waypoint() = default;
 
-unsigned int Waypoint::getMemSize() const
+std::size_t Waypoint::getMemSize() const
 {
     return 0;
 }
@@ -378,9 +378,9 @@ void PropertyConstraintList::Paste(const Property& from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyConstraintList::getMemSize() const
+std::size_t PropertyConstraintList::getMemSize() const
 {
-    int size = sizeof(PropertyConstraintList);
+    std::size_t size = sizeof(PropertyConstraintList);
     for (int i = 0; i < getSize(); i++) {
         size += _lValueList[i]->getMemSize();
     }
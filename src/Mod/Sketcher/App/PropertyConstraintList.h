@@ -125,7 +125,7 @@ public:
     Property* Copy() const override;
     void Paste(const App::Property& from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     void acceptGeometry(const std::vector<Part::Geometry*>& GeoList);
     bool checkGeometry(const std::vector<Part::Geometry*>& GeoList);
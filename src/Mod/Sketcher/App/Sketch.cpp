@@ -72,6 +72,7 @@ Sketch::Sketch()
     , RecalculateInitialSolutionWhileMovingPoint(false)
     , resolveAfterGeometryUpdated(false)
     , GCSsys()
+    , diagnosisReused(false)
     , ConstraintsCounter(0)
     , isInitMove(false)
     , isFine(true)
@@ -193,6 +194,33 @@ bool Sketch::analyseBlockedGeometry(const std::vector<Part::Geometry*>& internal
     return doesBlockAffectOtherConstraints;
 }
 
+void Sketch::clearDiagnosisCache()
+{
+    lastDiagnosis.clear();
+    diagnosisReused = false;
+}
+
+bool Sketch::isDiagnosisValid()
+{
+    return !diagnosisReused || GCSsys.isDiagnosisRankValid();
+}
+
+int Sketch::diagnoseSolution()
+{
+    clearDiagnosisCache();
+    GCSsys.invalidatedDiagnosis();
+    GCSsys.initSolution(defaultSolverRedundant);
+
+    GCSsys.getConflicting(Conflicting);
+    GCSsys.getRedundant(Redundant);
+    GCSsys.getPartiallyRedundant(PartiallyRedundant);
+    GCSsys.getDependentParams(pDependentParametersList);
+
+    calculateDependentParametersElements();
+
+    return GCSsys.dofsNumber();
+}
+
 int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                         const std::vector<Constraint*>& ConstraintList,
                         int extGeoCount)
@@ -271,8 +299,24 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
     clearTemporaryConstraints();
     GCSsys.declareUnknowns(Parameters);
     GCSsys.declareDrivenParams(DrivenParameters);
+
+    // The costly QR diagnosis is skipped if the system has the same structure as the last one.
+    // The rank of the Jacobian may still change with the values of datums or the position of the
+    // geometry, so it has to be checked with isDiagnosisValid() after solving and the solution
+    // diagnosed again with diagnoseSolution() if it changed. Blocked geometry is post-analysed
+    // with further diagnoses below, and conflicting or redundant constraints are classified by
+    // solving, which depends on the values.
+    diagnosisReused = !doesBlockAffectOtherConstraints && GCSsys.setDiagnosis(lastDiagnosis);
+
     GCSsys.initSolution(defaultSolverRedundant);
 
+    if (!diagnosisReused
+        && (doesBlockAffectOtherConstraints || !GCSsys.getDiagnosis(lastDiagnosis)
+            || !lastDiagnosis.conflictingTags.empty() || !lastDiagnosis.redundantTags.empty()
+            || !lastDiagnosis.partiallyRedundantTags.empty())) {
+        lastDiagnosis.clear();
+    }
+
     // Post-analysis
     // Now that we have all the parameters information, we deal properly with the block constraints
     // if necessary
@@ -5361,7 +5405,7 @@ TopoShape Sketch::toShape() const
 
 // Persistence implementer -------------------------------------------------
 
-unsigned int Sketch::getMemSize() const
+std::size_t Sketch::getMemSize() const
 {
     return 0;
 }
@@ -46,7 +46,7 @@ public:
     ~Sketch() override;
 
     // from base class
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
 
@@ -73,10 +73,27 @@ public:
      * an over-constrained sketch will always contain conflicting constraints
      * a fully constrained or under-constrained sketch may contain conflicting
      * constraints or may not
+     *
+     * if the solver system has the same structure as the one of the previous
+     * call, e.g. only a datum or the position of some geometry changed, the
+     * previous diagnosis is taken over instead of running the QR decomposition
      */
     int setUpSketch(const std::vector<Part::Geometry*>& GeoList,
                     const std::vector<Constraint*>& ConstraintList,
                     int extGeoCount = 0);
+    /// true if the last setUpSketch took over the diagnosis of a previous one
+    bool isDiagnosisReused() const
+    {
+        return diagnosisReused;
+    }
+    /// force a full diagnosis on the next setUpSketch
+    void clearDiagnosisCache();
+    /** false if the last setUpSketch took over the diagnosis of a previous one, but the rank
+     * of the Jacobian at the solution differs from it, e.g. a datum made a constraint redundant
+     */
+    bool isDiagnosisValid();
+    /// diagnoses the solved sketch from scratch and returns the dofs like setUpSketch
+    int diagnoseSolution();
     /// return the actual geometry of the sketch a TopoShape
     Part::TopoShape toShape() const;
     /// add unspecified geometry
@@ -573,6 +590,9 @@ private:
     std::vector<GeoDef> Geoms;
     std::vector<ConstrDef> Constrs;
     GCS::System GCSsys;
+    // diagnosis of the last set up system, to be reused if the structure does not change
+    GCS::System::Diagnosis lastDiagnosis;
+    bool diagnosisReused;
     int ConstraintsCounter;
     std::vector<int> Conflicting;
     std::vector<int> Redundant;
@@ -663,6 +683,14 @@ public:
     {
         return GCSsys.qrAlgorithm;
     }
+    inline void setSolverMatrix(GCS::SolverMatrix matrix)
+    {
+        GCSsys.solverMatrix = matrix;
+    }
+    inline GCS::SolverMatrix getSolverMatrix()
+    {
+        return GCSsys.solverMatrix;
+    }
     inline void setQRPivotThreshold(double val)
     {
         GCSsys.qrpivotThreshold = val;
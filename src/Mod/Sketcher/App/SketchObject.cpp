@@ -558,6 +558,27 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     }
     else {
         lastSolverStatus = solvedSketch.solve();
+        if (lastSolverStatus != 0 && solvedSketch.isDiagnosisReused()) {
+            // the new values may have made the sketch degenerate, so that the diagnosis taken
+            // over from the previous set up does not apply anymore. Diagnose it from scratch.
+            solvedSketch.clearDiagnosisCache();
+            return solve(updateGeoAfterSolving);
+        }
+        if (lastSolverStatus == 0 && !solvedSketch.isDiagnosisValid()) {
+            // the rank changed at the solution, e.g. a datum made a constraint redundant.
+            // Diagnose the solution from scratch, as the next set up would do.
+            lastDoF = solvedSketch.diagnoseSolution();
+            retrieveSolverDiagnostics();
+            if (lastHasRedundancies) {
+                err = -2;
+            }
+            if (lastDoF < 0) {
+                err = -4;
+            }
+            else if (lastHasConflict) {
+                err = -3;
+            }
+        }
         if (lastSolverStatus != 0) {// solving
             err = -1;
         }
@@ -10085,7 +10106,7 @@ PyObject* SketchObject::getPyObject()
     return Py::new_reference_to(PythonObject);
 }
 
-unsigned int SketchObject::getMemSize() const
+std::size_t SketchObject::getMemSize() const
 {
     return 0;
 }
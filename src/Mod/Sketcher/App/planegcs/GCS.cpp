@@ -47,10 +47,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <thread>
+#include <type_traits>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -451,6 +454,9 @@ void SolverReportingManager::LogMatrix(const std::string str, MatrixIndexType ma
 
 using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
 
+// below this number of parameters starting threads costs more than solving the components
+constexpr int minParallelParameters = 200;
+
 ///////////////////////////////////////
 // Solver
 ///////////////////////////////////////
@@ -467,6 +473,7 @@ System::System()
     , subSystemsAux(0)
     , reference(0)
     , dofs(0)
+    , diagnosisRank(0)
     , hasUnknowns(false)
     , hasDiagnosis(false)
     , isInit(false)
@@ -479,6 +486,7 @@ System::System()
     , convergenceRedundant(1e-10)
     , qrAlgorithm(EigenSparseQR)
     , dogLegGaussStep(FullPivLU)
+    , solverMatrix(EigenDenseMatrix)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
     , LM_eps(1E-10)
@@ -537,6 +545,173 @@ void System::invalidatedDiagnosis()
     pDependentParametersGroups.clear();
 }
 
+std::vector<int> System::getDiagnosisStructure() const
+{
+    // The Jacobian used by diagnose() only depends on which unknowns enter which constraints, but
+    // not on the values of the parameters or of the datums. Parameters that are no unknowns are
+    // all encoded as -1, their values do not enter the structure either.
+    std::vector<int> structure;
+    structure.reserve(2 + clist.size() * 8);
+    structure.push_back(int(plist.size()));
+    for (double* param : pdrivenlist) {
+        MAP_pD_I::const_iterator it = pIndex.find(param);
+        structure.push_back(it != pIndex.end() ? it->second : -1);
+    }
+    structure.push_back(-2);
+
+    for (Constraint* constr : clist) {
+        structure.push_back(int(constr->getTypeId()));
+        structure.push_back(constr->getTag());
+        structure.push_back(constr->isDriving() ? 1 : 0);
+
+        std::map<Constraint*, VEC_pD>::const_iterator params = c2p.find(constr);
+        if (params == c2p.end()) {
+            structure.push_back(0);
+            continue;
+        }
+
+        structure.push_back(int(params->second.size()));
+        for (double* param : params->second) {
+            MAP_pD_I::const_iterator it = pIndex.find(param);
+            structure.push_back(it != pIndex.end() ? it->second : -1);
+        }
+    }
+    return structure;
+}
+
+bool System::getDiagnosis(Diagnosis& diagnosis) const
+{
+    diagnosis.clear();
+    if (!hasUnknowns || !hasDiagnosis) {
+        return false;
+    }
+
+    diagnosis.structure = getDiagnosisStructure();
+    diagnosis.dofs = dofs;
+    diagnosis.rank = diagnosisRank;
+    diagnosis.emptyDiagnoseMatrix = emptyDiagnoseMatrix;
+    diagnosis.conflictingTags = conflictingTags;
+    diagnosis.redundantTags = redundantTags;
+    diagnosis.partiallyRedundantTags = partiallyRedundantTags;
+
+    for (int i = 0; i < int(clist.size()); i++) {
+        if (redundant.count(clist[i]) > 0) {
+            diagnosis.redundant.push_back(i);
+        }
+    }
+
+    auto toIndex = [this](double* param) {
+        MAP_pD_I::const_iterator it = pIndex.find(param);
+        return it != pIndex.end() ? it->second : -1;
+    };
+
+    diagnosis.dependentParameters.reserve(pDependentParameters.size());
+    for (double* param : pDependentParameters) {
+        diagnosis.dependentParameters.push_back(toIndex(param));
+    }
+
+    diagnosis.dependentParametersGroups.resize(pDependentParametersGroups.size());
+    for (std::size_t i = 0; i < pDependentParametersGroups.size(); i++) {
+        for (double* param : pDependentParametersGroups[i]) {
+            diagnosis.dependentParametersGroups[i].push_back(toIndex(param));
+        }
+    }
+
+    return true;
+}
+
+bool System::setDiagnosis(const Diagnosis& diagnosis)
+{
+    if (!hasUnknowns || diagnosis.structure.empty()
+        || diagnosis.structure != getDiagnosisStructure()) {
+        return false;
+    }
+
+    auto toParam = [this](int index) {
+        return index >= 0 && index < int(plist.size()) ? plist[index] : nullptr;
+    };
+
+    VEC_pD dependentParameters;
+    dependentParameters.reserve(diagnosis.dependentParameters.size());
+    for (int index : diagnosis.dependentParameters) {
+        if (!toParam(index)) {
+            return false;
+        }
+        dependentParameters.push_back(toParam(index));
+    }
+
+    std::vector<VEC_pD> dependentParametersGroups(diagnosis.dependentParametersGroups.size());
+    for (std::size_t i = 0; i < diagnosis.dependentParametersGroups.size(); i++) {
+        for (int index : diagnosis.dependentParametersGroups[i]) {
+            if (!toParam(index)) {
+                return false;
+            }
+            dependentParametersGroups[i].push_back(toParam(index));
+        }
+    }
+
+    redundant.clear();
+    for (int index : diagnosis.redundant) {
+        if (index >= 0 && index < int(clist.size())) {
+            redundant.insert(clist[index]);
+        }
+    }
+
+    dofs = diagnosis.dofs;
+    diagnosisRank = diagnosis.rank;
+    emptyDiagnoseMatrix = diagnosis.emptyDiagnoseMatrix;
+    conflictingTags = diagnosis.conflictingTags;
+    redundantTags = diagnosis.redundantTags;
+    partiallyRedundantTags = diagnosis.partiallyRedundantTags;
+    pDependentParameters = std::move(dependentParameters);
+    pDependentParametersGroups = std::move(dependentParametersGroups);
+    hasDiagnosis = true;
+    return true;
+}
+
+bool System::isDiagnosisRankValid()
+{
+    if (!hasDiagnosis) {
+        return false;
+    }
+    // same exit as in diagnose()
+    if (!hasUnknowns || plist.empty() || (plist.size() - pdrivenlist.size()) == 0) {
+        return true;
+    }
+
+    Eigen::MatrixXd J;
+    std::map<int, int> jacobianconstraintmap;
+    GCS::VEC_pD pdiagnoselist;
+    std::map<int, int> tagmultiplicity;
+    makeReducedJacobian(J, jacobianconstraintmap, pdiagnoselist, tagmultiplicity);
+
+    // In contrast to diagnose(), neither the dependent parameters nor the conflicting or redundant
+    // constraints are identified. The rank of the dense J is the same as of its transpose, but a
+    // column pivoting decomposition of J is faster.
+    int rank = 0;
+    if (J.rows() > 0) {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+        if (qrAlgorithm == EigenSparseQR) {
+            Eigen::MatrixXd R;
+            Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJ;
+            makeSparseQRDecomposition(J,
+                                      jacobianconstraintmap,
+                                      SqrJ,
+                                      rank,
+                                      R,
+                                      /*transposed=*/true,
+                                      /*silent=*/true);
+            return rank == diagnosisRank;
+        }
+#endif
+        Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qrJ(J.topRows(jacobianconstraintmap.size()));
+        qrJ.setThreshold(qrpivotThreshold);
+        rank = int(qrJ.rank());
+    }
+
+    return rank == diagnosisRank;
+}
+
 void System::clearByTag(int tagId)
 {
     std::vector<Constraint*> constrvec;
@@ -1981,26 +2156,68 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    // the decoupled components that have to be solved, largest first for a better load balance
+    std::vector<int> components;
+    int numParams = 0;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            components.push_back(cid);
+            numParams += int(plists[cid].size());
         }
+    }
+    std::stable_sort(components.begin(), components.end(), [this](int cid1, int cid2) {
+        return plists[cid1].size() > plists[cid2].size();
+    });
+
+    if (!components.empty()) {
+        resetToReference();
+    }
+
+    auto solveComponent = [&](int cid) {
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            return solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            return solve(subSystems[cid], isFine, alg, isRedundantsolving);
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+        return solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+    };
+
+    // The components share neither parameters nor constraints, so that they can be solved
+    // concurrently. A component that already satisfies its constraints returns at the first
+    // convergence check of the solver, so effectively only the components touched by a change are
+    // solved. The iteration level debug output is not thread-safe.
+    std::size_t numThreads = 1;
+    if (components.size() > 1 && numParams >= minParallelParameters
+        && debugMode != IterationLevel) {
+        numThreads = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U),
+                                           components.size());
+    }
+
+    VEC_I results(components.size(), Success);
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t index = next++; index < components.size(); index = next++) {
+            results[index] = solveComponent(components[index]);
         }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t thread = 1; thread < numThreads; thread++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
     }
+
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -2158,12 +2375,146 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// Linear algebra of the LevenbergMarquardt and DogLeg steps, for a dense or a sparse Jacobian
+template<typename Matrix>
+class StepSolver;
+
+template<>
+class StepSolver<Eigen::MatrixXd>
+{
+public:
+    explicit StepSolver(DogLegGaussStep gaussStep)
+        : gaussStep(gaussStep)
+    {}
+
+    // sets up the normal equations J^T J and returns their diagonal
+    Eigen::VectorXd setNormalMatrix(const Eigen::MatrixXd& J)
+    {
+        JtJ = J.transpose() * J;
+        return JtJ.diagonal();
+    }
+
+    // solves the augmented normal equations (J^T J + mu I) h = g, returns the relative error
+    double solveDamped(double mu, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+    {
+        A = JtJ;
+        A.diagonal().array() += mu;
+        h = A.fullPivLu().solve(g);
+        return (A * h - g).norm() / g.norm();
+    }
+
+    // get the gauss-newton step
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    void solveGaussNewton(const Eigen::MatrixXd& J, const Eigen::VectorXd& fx, Eigen::VectorXd& h)
+    {
+        switch (gaussStep) {
+            case FullPivLU:
+                h = J.fullPivLu().solve(-fx);
+                break;
+            case LeastNormFullPivLU:
+                h = J.adjoint() * (J * J.adjoint()).fullPivLu().solve(-fx);
+                break;
+            case LeastNormLdlt:
+                h = J.adjoint() * (J * J.adjoint()).ldlt().solve(-fx);
+                break;
+        }
+    }
+
+private:
+    DogLegGaussStep gaussStep;
+    Eigen::MatrixXd JtJ, A;
+};
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+template<>
+class StepSolver<Eigen::SparseMatrix<double>>
+{
+public:
+    explicit StepSolver(DogLegGaussStep /*gaussStep*/)
+    {}
+
+    Eigen::VectorXd setNormalMatrix(const Eigen::SparseMatrix<double>& J)
+    {
+        JtJ = J.transpose() * J;
+        return JtJ.diagonal();
+    }
+
+    double solveDamped(double mu, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+    {
+        // each unknown enters at least one constraint, so the diagonal is part of the pattern
+        A = JtJ;
+        for (Eigen::Index i = 0; i < A.rows(); i++) {
+            A.coeffRef(i, i) += mu;
+        }
+        if (!factorize(normalSolver, A, normalNonZeros)) {
+            return std::numeric_limits<double>::infinity();
+        }
+        h = normalSolver.solve(g);
+        return (A * h - g).norm() / g.norm();
+    }
+
+    // least norm gauss-newton step h = J^T (J J^T)^-1 (-fx)
+    void solveGaussNewton(const Eigen::SparseMatrix<double>& J,
+                          const Eigen::VectorXd& fx,
+                          Eigen::VectorXd& h)
+    {
+        JJt = J * J.transpose();
+        if (factorize(gaussSolver, JJt, gaussNonZeros)) {
+            h = J.transpose() * gaussSolver.solve(-fx);
+        }
+        else {
+            // J J^T is singular, e.g. for a degenerate configuration
+            Eigen::MatrixXd dense(J);
+            h = dense.fullPivLu().solve(-fx);
+        }
+    }
+
+private:
+    using Solver = Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>;
+
+    // The sparsity pattern of the Jacobian does not change between iterations, so the symbolic
+    // analysis is only done once.
+    static bool
+    factorize(Solver& solver, const Eigen::SparseMatrix<double>& matrix, Eigen::Index& nonZeros)
+    {
+        if (matrix.nonZeros() != nonZeros) {
+            solver.analyzePattern(matrix);
+            nonZeros = matrix.nonZeros();
+        }
+        solver.factorize(matrix);
+        return solver.info() == Eigen::Success;
+    }
+
+    Eigen::SparseMatrix<double> JtJ, A, JJt;
+    Solver normalSolver, gaussSolver;
+    Eigen::Index normalNonZeros = -1;
+    Eigen::Index gaussNonZeros = -1;
+};
+#endif
+
+}  // namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (solverMatrix == EigenSparseMatrix) {
+        return solveLM<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solveLM<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename Matrix>
+int System::solveLM(SubSystem* subsys, bool isRedundantsolving)
+{
     int xsize = subsys->pSize();
     int csize = subsys->cSize();
 
@@ -2173,8 +2524,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    Matrix J;          // Jacobi of the subsystem
+    StepSolver<Matrix> stepSolver(dogLegGaussStep);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2221,14 +2572,12 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // J^T J, J^T e
         subsys->calcJacobi(J);
-        ;
 
-        A = J.transpose() * J;
+        diag_A = stepSolver.setNormalMatrix(J);
         g = J.transpose() * e;
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2245,14 +2594,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
-
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
+            // solve augmented normal equations (A+uI)*h=-g
+            double rel_error = stepSolver.solveDamped(mu, g, h);
 
             // check if solving works
             if (rel_error < 1e-5) {
@@ -2301,9 +2644,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
 
             k++;
         }
@@ -2339,6 +2679,17 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (solverMatrix == EigenSparseMatrix) {
+        return solveDL<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solveDL<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename Matrix>
+int System::solveDL(SubSystem* subsys, bool isRedundantsolving)
+{
     double tolg = (isRedundantsolving ? DL_tolgRedundant : DL_tolg);
     double tolx = (isRedundantsolving ? DL_tolxRedundant : DL_tolx);
     double tolf = (isRedundantsolving ? DL_tolfRedundant : DL_tolf);
@@ -2360,10 +2711,12 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         stream << "DL: tolg: " << tolg << ", tolx: " << tolx << ", tolf: " << tolf
                << ", convergence: " << (isRedundantsolving ? convergenceRedundant : convergence)
                << ", dogLegGaussStep: "
-               << (dogLegGaussStep == FullPivLU
-                       ? "FullPivLU"
-                       : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
-                                                                : "LeastNormLdlt"))
+               << (!std::is_same<Matrix, Eigen::MatrixXd>::value
+                       ? "LeastNormSparseLdlt"
+                       : (dogLegGaussStep == FullPivLU
+                              ? "FullPivLU"
+                              : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
+                                                                       : "LeastNormLdlt")))
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
                << "\n";
 
@@ -2373,7 +2726,8 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Matrix Jx, Jx_new;
+    StepSolver<Matrix> stepSolver(dogLegGaussStep);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2419,19 +2773,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             h_sd = alpha * g;
 
             // get the gauss-newton step
-            // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-            // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-            switch (dogLegGaussStep) {
-                case FullPivLU:
-                    h_gn = Jx.fullPivLu().solve(-fx);
-                    break;
-                case LeastNormFullPivLU:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                    break;
-                case LeastNormLdlt:
-                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                    break;
-            }
+            stepSolver.solveGaussNewton(Jx, fx, h_gn);
 
             double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
             if (rel_error > 1e15) {
@@ -2489,7 +2831,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
         if (dF > 0 && dL > 0) {
             x = x_new;
-            Jx = Jx_new;
+            Jx.swap(Jx_new);
             fx = fx_new;
             err = err_new;
 
@@ -4878,10 +5220,11 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
                                  std::map<int, int>& tagmultiplicity)
 {
     // construct specific parameter list for diagonose ignoring driven constraint parameters
+    SET_pD drivenparams(pdrivenlist.begin(), pdrivenlist.end());
+    MAP_pD_I diagnoseindex;
     for (int j = 0; j < int(plist.size()); j++) {
-        auto result1 = std::find(std::begin(pdrivenlist), std::end(pdrivenlist), plist[j]);
-
-        if (result1 == std::end(pdrivenlist)) {
+        if (drivenparams.count(plist[j]) == 0) {
+            diagnoseindex[plist[j]] = int(pdiagnoselist.size());
             pdiagnoselist.push_back(plist[j]);
         }
     }
@@ -4897,8 +5240,12 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
         ++allcount;
         if ((*constr)->getTag() >= 0 && (*constr)->isDriving()) {
             jacobianconstraintcount++;
-            for (int j = 0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount - 1, j) = (*constr)->grad(pdiagnoselist[j]);
+            // the gradient is zero for all the parameters the constraint does not depend on
+            for (double* param : c2p[*constr]) {
+                MAP_pD_I::const_iterator it = diagnoseindex.find(param);
+                if (it != diagnoseindex.end()) {
+                    J(jacobianconstraintcount - 1, it->second) = (*constr)->grad(param);
+                }
             }
 
             // parallel processing: create tag multiplicity map
@@ -4931,6 +5278,7 @@ int System::diagnose(Algorithm alg)
     //         two high priority constraints. For this reason, tagging
     //         constraints with 0 should be used carefully.
     hasDiagnosis = false;
+    diagnosisRank = 0;
     if (!hasUnknowns) {
         dofs = -1;
         return dofs;
@@ -5091,6 +5439,7 @@ int System::diagnose(Algorithm alg)
             fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
 
             dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+            diagnosisRank = rank;
 
             // Detecting conflicting or redundant constraints
             if (constrNum > rank) {  // conflicting or redundant constraints
@@ -5164,6 +5513,7 @@ int System::diagnose(Algorithm alg)
             fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
 
             dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+            diagnosisRank = rank;
 
             // Detecting conflicting or redundant constraints
             if (constrNum > rank) {
@@ -5551,14 +5901,24 @@ void System::identifyDependentGeometryParametersInTransposedJacobianDenseQRDecom
 
 void System::eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank)
 {
+    // The rows of R are sparse, in particular for sketches made of decoupled components, so only
+    // the non zero entries of the pivot row are subtracted from the rows above.
+    std::vector<int> nonzeros;
     for (int i = 1; i < rank; i++) {
         // eliminate non zeros above pivot
         assert(R(i, i) != 0);
+        nonzeros.clear();
+        for (int col = i + 1; col < R.cols(); col++) {
+            if (R(i, col) != 0) {
+                nonzeros.push_back(col);
+            }
+        }
         for (int row = 0; row < i; row++) {
             if (R(row, i) != 0) {
                 double coef = R(row, i) / R(i, i);
-                R.block(row, i + 1, 1, R.cols() - i - 1) -=
-                    coef * R.block(i, i + 1, 1, R.cols() - i - 1);
+                for (int col : nonzeros) {
+                    R(row, col) -= coef * R(i, col);
+                }
                 R(row, i) = 0;
             }
         }
@@ -78,6 +78,13 @@ enum QRAlgorithm
     EigenSparseQR = 1
 };
 
+// Storage of the Jacobian and of the linear systems in the LevenbergMarquardt and DogLeg solvers
+enum SolverMatrix
+{
+    EigenDenseMatrix = 0,
+    EigenSparseMatrix = 1
+};
+
 enum DebugMode
 {
     NoDebug = 0,
@@ -134,6 +141,7 @@ private:
     std::vector<MAP_pD_pD> reductionmaps;  // for simplification of equality constraints
 
     int dofs;
+    int diagnosisRank;  // rank of the reduced Jacobian found by the last diagnosis
     std::set<Constraint*> redundant;
     VEC_I conflictingTags, redundantTags, partiallyRedundantTags;
 
@@ -146,6 +154,12 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    template<typename Matrix>
+    int solveLM(SubSystem* subsys, bool isRedundantsolving);
+    template<typename Matrix>
+    int solveDL(SubSystem* subsys, bool isRedundantsolving);
+
+    std::vector<int> getDiagnosisStructure() const;
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -223,7 +237,8 @@ public:
     double convergence;
     double convergenceRedundant;
     QRAlgorithm qrAlgorithm;
-    DogLegGaussStep dogLegGaussStep;
+    DogLegGaussStep dogLegGaussStep;  // only used with EigenDenseMatrix
+    SolverMatrix solverMatrix;
     double qrpivotThreshold;
     DebugMode debugMode;
     double LM_eps;
@@ -240,6 +255,26 @@ public:
     double DL_tolfRedundant;
 
 public:
+    // Result of a diagnosis in terms of indices into the constraint and the unknown parameter
+    // lists, so that it can be transferred to another system with the same structure.
+    struct Diagnosis
+    {
+        // types, tags, driving flags and parameter indices of the constraints
+        std::vector<int> structure;
+        int dofs = 0;
+        int rank = 0;
+        bool emptyDiagnoseMatrix = true;
+        VEC_I conflictingTags, redundantTags, partiallyRedundantTags;
+        std::vector<int> redundant;
+        std::vector<int> dependentParameters;
+        std::vector<std::vector<int>> dependentParametersGroups;
+
+        void clear()
+        {
+            *this = Diagnosis();
+        }
+    };
+
     System();
     /*System(std::vector<Constraint *> clist_);*/
     ~System();
@@ -615,6 +650,16 @@ public:
 
     void invalidatedDiagnosis();
 
+    // Stores the current diagnosis, returns false if the system has no diagnosis
+    bool getDiagnosis(Diagnosis& diagnosis) const;
+    // Takes over the diagnosis of a system with the same constraints and unknowns instead of
+    // running diagnose(). Returns false, leaving the system untouched, if the structure differs.
+    bool setDiagnosis(const Diagnosis& diagnosis);
+    // Checks that the rank of the Jacobian at the current parameter values still matches the
+    // diagnosis, e.g. after solving with a transferred diagnosis. This needs a single QR
+    // decomposition, but none of the analysis of diagnose().
+    bool isDiagnosisRankValid();
+
     // Unit testing interface - not intended for use by production code
 protected:
     size_t _getNumberOfConstraints(int tagID = -1)
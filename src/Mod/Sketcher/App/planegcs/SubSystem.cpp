@@ -273,7 +273,40 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // only evaluate the gradients of the parameters a constraint actually depends on
+    jacobi.setZero(csize, psize);
+    for (int i = 0; i < csize; i++) {
+        std::map<Constraint*, VEC_pD>::const_iterator it = c2p.find(clist[i]);
+        if (it != c2p.end()) {
+            for (double* param : it->second) {
+                jacobi(i, param - pvals.data()) = clist[i]->grad(param);
+            }
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    if (jacobi.rows() != csize || jacobi.cols() != psize || !jacobi.isCompressed()) {
+        std::vector<Eigen::Triplet<double>> entries;
+        for (int i = 0; i < csize; i++) {
+            std::map<Constraint*, VEC_pD>::const_iterator it = c2p.find(clist[i]);
+            if (it != c2p.end()) {
+                for (double* param : it->second) {
+                    entries.emplace_back(i, int(param - pvals.data()), 0.0);
+                }
+            }
+        }
+        jacobi.resize(csize, psize);
+        jacobi.setFromTriplets(entries.begin(), entries.end());
+        jacobi.makeCompressed();
+    }
+
+    for (int j = 0; j < jacobi.outerSize(); j++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(jacobi, j); it; ++it) {
+            it.valueRef() = clist[it.row()]->grad(&pvals[j]);
+        }
+    }
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
@@ -49,6 +49,7 @@
 #define DEFAULT_SOLVER_DEBUG 1    // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
 #define DEFAULT_DOGLEG_GAUSS_STEP 0  // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
+#define DEFAULT_SOLVER_MATRIX 0      // DENSE=0, SPARSE=1
 
 using namespace SketcherGui;
 using namespace Gui::TaskView;
@@ -70,6 +71,7 @@ TaskSketcherSolverAdvanced::TaskSketcherSolverAdvanced(ViewProviderSketch* sketc
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxSolverMatrix->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -97,6 +99,10 @@ void TaskSketcherSolverAdvanced::setupConnections()
             qOverload<int>(&QComboBox::currentIndexChanged),
             this,
             &TaskSketcherSolverAdvanced::onComboBoxDogLegGaussStepCurrentIndexChanged);
+    connect(ui->comboBoxSolverMatrix,
+            qOverload<int>(&QComboBox::currentIndexChanged),
+            this,
+            &TaskSketcherSolverAdvanced::onComboBoxSolverMatrixCurrentIndexChanged);
     connect(ui->spinBoxMaxIter,
             qOverload<int>(&QSpinBox::valueChanged),
             this,
@@ -179,7 +185,9 @@ void TaskSketcherSolverAdvanced::updateDefaultMethodParameters()
     int currentindex = ui->comboBoxDefaultSolver->currentIndex();
     int redundantcurrentindex = ui->comboBoxRedundantDefaultSolver->currentIndex();
 
-    if (redundantcurrentindex == 2 || currentindex == 2) {
+    // with sparse matrices DogLeg always takes the least norm step with an LDLT decomposition
+    if ((redundantcurrentindex == 2 || currentindex == 2)
+        && ui->comboBoxSolverMatrix->currentIndex() == GCS::EigenDenseMatrix) {
         ui->comboBoxDogLegGaussStep->setEnabled(true);
     }
     else {
@@ -280,7 +288,8 @@ void TaskSketcherSolverAdvanced::updateRedundantMethodParameters()
     int currentindex = ui->comboBoxDefaultSolver->currentIndex();
     int redundantcurrentindex = ui->comboBoxRedundantDefaultSolver->currentIndex();
 
-    if (redundantcurrentindex == 2 || currentindex == 2) {
+    if ((redundantcurrentindex == 2 || currentindex == 2)
+        && ui->comboBoxSolverMatrix->currentIndex() == GCS::EigenDenseMatrix) {
         ui->comboBoxDogLegGaussStep->setEnabled(true);
     }
     else {
@@ -560,6 +569,14 @@ void TaskSketcherSolverAdvanced::onComboBoxDogLegGaussStepCurrentIndexChanged(in
     updateDefaultMethodParameters();
 }
 
+void TaskSketcherSolverAdvanced::onComboBoxSolverMatrixCurrentIndexChanged(int index)
+{
+    ui->comboBoxSolverMatrix->onSave();
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setSolverMatrix((GCS::SolverMatrix)index);
+    updateDefaultMethodParameters();
+}
+
 void TaskSketcherSolverAdvanced::onSpinBoxMaxIterValueChanged(int i)
 {
     ui->spinBoxMaxIter->onSave();
@@ -695,6 +712,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
     // Set other settings
     hGrp->SetInt("DefaultSolver", DEFAULT_SOLVER);
     hGrp->SetInt("DogLegGaussStep", DEFAULT_DOGLEG_GAUSS_STEP);
+    hGrp->SetInt("SolverMatrix", DEFAULT_SOLVER_MATRIX);
 
     hGrp->SetInt("RedundantDefaultSolver", DEFAULT_RSOLVER);
     hGrp->SetInt("MaxIter", MAX_ITER);
@@ -709,6 +727,7 @@ void TaskSketcherSolverAdvanced::onPushButtonDefaultsClicked(bool checked /* = f
 
     ui->comboBoxDefaultSolver->onRestore();
     ui->comboBoxDogLegGaussStep->onRestore();
+    ui->comboBoxSolverMatrix->onRestore();
     ui->spinBoxMaxIter->onRestore();
     ui->checkBoxSketchSizeMultiplier->onRestore();
     ui->lineEditConvergence->onRestore();
@@ -750,6 +769,8 @@ void TaskSketcherSolverAdvanced::updateSketchObject()
         static_cast<GCS::Algorithm>(ui->comboBoxDefaultSolver->currentIndex());
     const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
         .setDogLegGaussStep((GCS::DogLegGaussStep)ui->comboBoxDogLegGaussStep->currentIndex());
+    const_cast<Sketcher::Sketch&>(sketchView->getSketchObject()->getSolvedSketch())
+        .setSolverMatrix((GCS::SolverMatrix)ui->comboBoxSolverMatrix->currentIndex());
 
     updateDefaultMethodParameters();
     updateRedundantMethodParameters();
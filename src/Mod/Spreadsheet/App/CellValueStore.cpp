@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+
+#include "CellValueStore.h"
+
+
+using namespace Spreadsheet;
+
+void CellValueStore::set(App::CellAddress address,
+                         ValueType type,
+                         double value,
+                         const Base::Unit& unit)
+{
+    if (type == None) {
+        erase(address);
+        return;
+    }
+    if (Value* slot = this->slot(address, type, unit)) {
+        if (type == Integer) {
+            slot->integer = static_cast<long>(value);
+        }
+        else {
+            slot->real = value;
+        }
+    }
+}
+
+void CellValueStore::setInteger(App::CellAddress address, long value)
+{
+    if (Value* slot = this->slot(address, Integer, Base::Unit())) {
+        slot->integer = value;
+    }
+}
+
+CellValueStore::Value*
+CellValueStore::slot(App::CellAddress address, ValueType type, const Base::Unit& unit)
+{
+    if (!address.isValid()) {
+        return nullptr;
+    }
+
+    auto col = static_cast<std::size_t>(address.col());
+    auto row = static_cast<std::size_t>(address.row());
+    if (col >= columns.size()) {
+        columns.resize(col + 1);
+    }
+
+    Column& column = columns[col];
+    if (row >= column.types.size()) {
+        column.values.resize(row + 1, Value {0.0});
+        column.units.resize(row + 1);
+        column.types.resize(row + 1, None);
+    }
+
+    if (column.types[row] == None) {
+        ++count;
+    }
+    column.units[row] = unit;
+    column.types[row] = type;
+    return &column.values[row];
+}
+
+CellValueStore::ValueType
+CellValueStore::get(App::CellAddress address, double& value, Base::Unit& unit) const
+{
+    if (!address.isValid()) {
+        return None;
+    }
+
+    auto col = static_cast<std::size_t>(address.col());
+    auto row = static_cast<std::size_t>(address.row());
+    if (col >= columns.size() || row >= columns[col].types.size()) {
+        return None;
+    }
+
+    const Column& column = columns[col];
+    switch (column.types[row]) {
+        case None:
+            break;
+        case Integer:
+            value = static_cast<double>(column.values[row].integer);
+            unit = column.units[row];
+            break;
+        default:
+            value = column.values[row].real;
+            unit = column.units[row];
+            break;
+    }
+    return column.types[row];
+}
+
+bool CellValueStore::getInteger(App::CellAddress address, long& value) const
+{
+    if (!address.isValid()) {
+        return false;
+    }
+
+    auto col = static_cast<std::size_t>(address.col());
+    auto row = static_cast<std::size_t>(address.row());
+    if (col >= columns.size() || row >= columns[col].types.size()
+        || columns[col].types[row] != Integer) {
+        return false;
+    }
+
+    value = columns[col].values[row].integer;
+    return true;
+}
+
+void CellValueStore::erase(App::CellAddress address)
+{
+    if (!address.isValid()) {
+        return;
+    }
+
+    auto col = static_cast<std::size_t>(address.col());
+    auto row = static_cast<std::size_t>(address.row());
+    if (col >= columns.size() || row >= columns[col].types.size()) {
+        return;
+    }
+
+    Column& column = columns[col];
+    if (column.types[row] == None) {
+        return;
+    }
+    column.types[row] = None;
+    --count;
+
+    // Trim unused rows at the end of the column
+    std::size_t size = column.types.size();
+    while (size > 0 && column.types[size - 1] == None) {
+        --size;
+    }
+    column.values.resize(size);
+    column.units.resize(size);
+    column.types.resize(size);
+}
+
+std::vector<App::CellAddress> CellValueStore::getAddresses() const
+{
+    std::vector<App::CellAddress> addresses;
+    addresses.reserve(count);
+    for (std::size_t col = 0; col < columns.size(); ++col) {
+        const Column& column = columns[col];
+        for (std::size_t row = 0; row < column.types.size(); ++row) {
+            if (column.types[row] != None) {
+                addresses.emplace_back(static_cast<int>(row), static_cast<int>(col));
+            }
+        }
+    }
+    return addresses;
+}
+
+void CellValueStore::clear()
+{
+    columns.clear();
+    count = 0;
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef SPREADSHEET_CELLVALUESTORE_H
+#define SPREADSHEET_CELLVALUESTORE_H
+
+#include <cstddef>
+#include <vector>
+
+#include <App/Range.h>
+#include <Base/Unit.h>
+#include <Mod/Spreadsheet/SpreadsheetGlobal.h>
+
+
+namespace Spreadsheet
+{
+
+/** Storage of the numeric results of spreadsheet cells
+ *
+ * The values are kept in contiguous per-column arrays indexed by row, so that
+ * a sheet does not need one dynamic property per computed cell. The sheet only
+ * creates the property of a cell when it is looked up by name.
+ */
+class SpreadsheetExport CellValueStore
+{
+public:
+    enum ValueType : unsigned char
+    {
+        None,
+        Integer,
+        Float,
+        Quantity,
+    };
+
+    /// Store the result of the cell at \a address
+    void set(App::CellAddress address,
+             ValueType type,
+             double value,
+             const Base::Unit& unit = Base::Unit());
+
+    /// Store the integer result of the cell at \a address without going through a double
+    void setInteger(App::CellAddress address, long value);
+
+    /// Get the result of the cell at \a address, returns None if there is no numeric result
+    ValueType get(App::CellAddress address, double& value, Base::Unit& unit) const;
+
+    /// Get the exact integer result of the cell at \a address, returns false if it has none
+    bool getInteger(App::CellAddress address, long& value) const;
+
+    /// Remove the result of the cell at \a address
+    void erase(App::CellAddress address);
+
+    /// Addresses of all cells with a stored result, ordered by column and row
+    std::vector<App::CellAddress> getAddresses() const;
+
+    void clear();
+
+    /// Number of stored results
+    std::size_t size() const
+    {
+        return count;
+    }
+
+private:
+    /// Integer results are kept as such, a double only holds 53 bits of them
+    union Value
+    {
+        double real;
+        long integer;
+    };
+
+    struct Column
+    {
+        std::vector<Value> values;
+        std::vector<Base::Unit> units;
+        std::vector<ValueType> types;
+    };
+
+    Value* slot(App::CellAddress address, ValueType type, const Base::Unit& unit);
+
+    std::vector<Column> columns;
+    std::size_t count = 0;
+};
+
+}  // namespace Spreadsheet
+
+#endif  // SPREADSHEET_CELLVALUESTORE_H
@@ -73,6 +73,8 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellToDependantCellMap.clear();
+    cellToLocalCellMap.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -287,6 +289,8 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellToDependantCellMap(other.cellToDependantCellMap)
+    , cellToLocalCellMap(other.cellToLocalCellMap)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -1219,7 +1223,7 @@ void PropertySheet::removeColumns(int col, int count)
     signaller.tryInvoke();
 }
 
-unsigned int PropertySheet::getMemSize() const
+std::size_t PropertySheet::getMemSize() const
 {
     return sizeof(*this);
 }
@@ -1384,6 +1388,21 @@ void PropertySheet::addDependencies(CellAddress key)
                 propertyNameToCellMap[propName].insert(key);
                 cellToPropertyNameMap[key].insert(propName);
 
+                // Also a cell of this sheet?
+                if (!name.empty() && docObj == owner) {
+                    CellAddress addr = stringToAddress(name.c_str(), true);
+                    if (!addr.isValid()) {
+                        auto j = revAliasProp.find(name);
+                        if (j != revAliasProp.end()) {
+                            addr = j->second;
+                        }
+                    }
+                    if (addr.isValid()) {
+                        cellToDependantCellMap[addr].insert(key);
+                        cellToLocalCellMap[key].insert(addr);
+                    }
+                }
+
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom(Sheet::getClassTypeId())) {
                     auto other = static_cast<Sheet*>(docObj);
@@ -1434,6 +1453,26 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToPropertyNameMap.erase(i1);
     }
 
+    /* Remove from Cell <-> Key maps */
+
+    auto i3 = cellToLocalCellMap.find(key);
+
+    if (i3 != cellToLocalCellMap.end()) {
+        for (const auto& addr : i3->second) {
+            auto k = cellToDependantCellMap.find(addr);
+
+            if (k != cellToDependantCellMap.end()) {
+                k->second.erase(key);
+
+                if (k->second.empty()) {
+                    cellToDependantCellMap.erase(k);
+                }
+            }
+        }
+
+        cellToLocalCellMap.erase(i3);
+    }
+
     /* Remove from DocumentObject <-> Key maps */
 
     std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
@@ -1643,6 +1682,19 @@ const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
     }
 }
 
+const std::set<CellAddress>& PropertySheet::getDependants(CellAddress pos) const
+{
+    static std::set<CellAddress> empty;
+    auto i = cellToDependantCellMap.find(pos);
+
+    if (i != cellToDependantCellMap.end()) {
+        return i->second;
+    }
+    else {
+        return empty;
+    }
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -180,7 +180,7 @@ public:
 
     void removeColumns(int col, int count);
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
     bool mergeCells(App::CellAddress from, App::CellAddress to);
 
@@ -200,6 +200,9 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    /// Cells of the owner sheet that directly depend on the cell at \a pos
+    const std::set<App::CellAddress>& getDependants(App::CellAddress pos) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -322,6 +325,14 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Cell dependencies within the owner sheet, i.e. when the cell given in key
+      changes, the set of addresses needs to be recomputed.
+      */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToDependantCellMap;
+
+    /*! Cells of the owner sheet this cell depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToLocalCellMap;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -38,6 +38,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
+#include <Base/Tools.h>
 
 #include "Sheet.h"
 #include "SheetObserver.h"
@@ -129,6 +130,7 @@ void Sheet::clearAll()
 
     propAddress.clear();
     cellErrors.clear();
+    cellValues.clear();
     columnWidths.clear();
     rowHeights.clear();
 
@@ -313,7 +315,9 @@ bool Sheet::exportToFile(const std::string& filename,
     auto i = usedCells.begin();
 
     while (i != usedCells.end()) {
-        Property* prop = getProperty(*i);
+        double value;
+        Base::Unit unit;
+        CellValueStore::ValueType type = cellValues.get(*i, value, unit);
 
         if (prevRow != -1 && prevRow != i->row()) {
             for (int j = prevRow; j < i->row(); ++j) {
@@ -328,8 +332,16 @@ bool Sheet::exportToFile(const std::string& filename,
         }
 
         std::stringstream field;
+        Property* prop = type == CellValueStore::None ? getProperty(*i) : nullptr;
 
-        if (prop->isDerivedFrom((PropertyQuantity::getClassTypeId()))) {
+        long integer;
+        if (cellValues.getInteger(*i, integer)) {
+            field << integer;
+        }
+        else if (type != CellValueStore::None) {
+            field << value;
+        }
+        else if (prop->isDerivedFrom((PropertyQuantity::getClassTypeId()))) {
             field << static_cast<PropertyQuantity*>(prop)->getValue();
         }
         else if (prop->isDerivedFrom((PropertyFloat::getClassTypeId()))) {
@@ -481,7 +493,92 @@ PyObject* Sheet::getPyObject()
 
 Property* Sheet::getProperty(CellAddress key) const
 {
-    return props.getDynamicPropertyByName(key.toString(CellAddress::Cell::ShowRowColumn).c_str());
+    Property* prop =
+        props.getDynamicPropertyByName(key.toString(CellAddress::Cell::ShowRowColumn).c_str());
+    if (!prop && !materializing) {
+        prop = const_cast<Sheet*>(this)->materializeProperty(key);
+    }
+    return prop;
+}
+
+/**
+ * @brief Create the property of a cell holding a numeric result.
+ *
+ * Numeric results are kept in cellValues, and the corresponding property is
+ * only added when it is looked up for the first time.
+ *
+ * @param key Address of the cell.
+ * @return Pointer to the new property, or 0 if the cell has no numeric result.
+ */
+
+Property* Sheet::materializeProperty(CellAddress key)
+{
+    double value;
+    Base::Unit unit;
+    CellValueStore::ValueType type = cellValues.get(key, value, unit);
+
+    Base::StateLocker guard(materializing);
+    switch (type) {
+        case CellValueStore::Integer: {
+            long integer = 0;
+            cellValues.getInteger(key, integer);
+            return setIntegerProperty(key, integer);
+        }
+        case CellValueStore::Float:
+            return setFloatProperty(key, value);
+        case CellValueStore::Quantity:
+            return setQuantityProperty(key, value, unit);
+        default:
+            return nullptr;
+    }
+}
+
+/**
+ * @brief Add the property holding the numeric result of a cell.
+ *
+ * The property only mirrors cellValues. It is added like any other dynamic
+ * property, so that undoing its creation removes it again.
+ *
+ * @param type Type name of the property.
+ * @param name Name of the property, i.e. the cell address.
+ * @return The new property.
+ */
+
+Property* Sheet::addCellProperty(const char* type, const char* name)
+{
+    return addDynamicProperty(type,
+                              name,
+                              nullptr,
+                              nullptr,
+                              Prop_ReadOnly | Prop_Hidden | Prop_NoPersist);
+}
+
+/**
+ * @brief Get the numeric result of a cell without creating its property.
+ *
+ * @param address Address of the cell.
+ * @param value Set to the computed value.
+ * @param unit Set to the computed unit.
+ * @return Type of the result, or CellValueStore::None if the cell has no numeric result.
+ */
+
+CellValueStore::ValueType
+Sheet::getCellValue(CellAddress address, double& value, Base::Unit& unit) const
+{
+    return cellValues.get(address, value, unit);
+}
+
+/**
+ * @brief Get the exact integer result of a cell without creating its property.
+ *
+ * @param address Address of the cell.
+ * @param value Set to the computed value.
+ * @return True if the cell has an integer result.
+ */
+
+bool Sheet::getCellInteger(CellAddress address, long& value) const
+{
+    return cellValues.getInteger(address, value);
 }
 
 /**
@@ -569,6 +666,8 @@ void Sheet::onSettingDocument()
 
 Property* Sheet::setFloatProperty(CellAddress key, double value)
 {
+    cellValues.set(key, CellValueStore::Float, value);
+
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyFloat* floatProp;
@@ -578,12 +677,12 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
         }
+        if (!materializing) {
+            // Created on demand by getProperty()
+            return nullptr;
+        }
         floatProp = freecad_dynamic_cast<PropertyFloat>(
-            addDynamicProperty("App::PropertyFloat",
-                               name.c_str(),
-                               nullptr,
-                               nullptr,
-                               Prop_ReadOnly | Prop_Hidden | Prop_NoPersist));
+            addCellProperty("App::PropertyFloat", name.c_str()));
     }
     else {
         floatProp = static_cast<PropertyFloat*>(prop);
@@ -597,6 +696,8 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
 
 Property* Sheet::setIntegerProperty(CellAddress key, long value)
 {
+    cellValues.setInteger(key, value);
+
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyInteger* intProp;
@@ -606,12 +707,12 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
         }
+        if (!materializing) {
+            // Created on demand by getProperty()
+            return nullptr;
+        }
         intProp = freecad_dynamic_cast<PropertyInteger>(
-            addDynamicProperty("App::PropertyInteger",
-                               name.c_str(),
-                               nullptr,
-                               nullptr,
-                               Prop_ReadOnly | Prop_Hidden | Prop_NoPersist));
+            addCellProperty("App::PropertyInteger", name.c_str()));
     }
     else {
         intProp = static_cast<PropertyInteger*>(prop);
@@ -637,6 +738,11 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
 
 Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::Unit& unit)
 {
+    cellValues.set(key, CellValueStore::Quantity, value, unit);
+    if (!materializing) {
+        cells.setComputedUnit(key, unit);
+    }
+
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertySpreadsheetQuantity* quantityProp;
@@ -646,11 +752,12 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
             this->removeDynamicProperty(name.c_str());
             propAddress.erase(prop);
         }
-        Property* p = addDynamicProperty("Spreadsheet::PropertySpreadsheetQuantity",
-                                         name.c_str(),
-                                         nullptr,
-                                         nullptr,
-                                         Prop_ReadOnly | Prop_Hidden | Prop_NoPersist);
+        if (!materializing) {
+            // Created on demand by getProperty()
+            return nullptr;
+        }
+        Property* p =
+            addCellProperty("Spreadsheet::PropertySpreadsheetQuantity", name.c_str());
         quantityProp = freecad_dynamic_cast<PropertySpreadsheetQuantity>(p);
     }
     else {
@@ -661,8 +768,6 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
     quantityProp->setValue(value);
     quantityProp->setUnit(unit);
 
-    cells.setComputedUnit(key, unit);
-
     return quantityProp;
 }
 
@@ -678,6 +783,8 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
 
 Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
 {
+    cellValues.erase(key);
+
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyString* stringProp = freecad_dynamic_cast<PropertyString>(prop);
@@ -703,6 +810,8 @@ Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
 
 Property* Sheet::setObjectProperty(CellAddress key, Py::Object object)
 {
+    cellValues.erase(key);
+
     std::string name = key.toString(CellAddress::Cell::ShowRowColumn);
     Property* prop = props.getDynamicPropertyByName(name.c_str());
     PropertyPythonObject* pyProp = freecad_dynamic_cast<PropertyPythonObject>(prop);
@@ -772,6 +881,7 @@ void Sheet::updateProperty(CellAddress key)
                 output = std::make_unique<StringExpression>(this, s);
             }
             else {
+                cellValues.erase(key);
                 this->removeDynamicProperty(key.toString().c_str());
                 return;
             }
@@ -860,18 +970,35 @@ Property* Sheet::getDynamicPropertyByName(const char* name) const
     }
 }
 
+// The property enumerations only list the cell properties that already exist. Cells whose
+// result has not been looked up by name yet are left alone, listing them must not add
+// properties (and undo records) to the sheet.
+
 void Sheet::getPropertyNamedList(std::vector<std::pair<const char*, Property*>>& List) const
 {
     DocumentObject::getPropertyNamedList(List);
     List.reserve(List.size() + cells.aliasProp.size());
     for (auto& v : cells.aliasProp) {
-        auto prop = getProperty(v.first);
+        auto prop = props.getDynamicPropertyByName(
+            v.first.toString(CellAddress::Cell::ShowRowColumn).c_str());
         if (prop) {
             List.emplace_back(v.second.c_str(), prop);
         }
     }
 }
 
+void Sheet::getPropertyMap(std::map<std::string, Property*>& Map) const
+{
+    DocumentObject::getPropertyMap(Map);
+    for (auto& v : cells.aliasProp) {
+        auto prop = props.getDynamicPropertyByName(
+            v.first.toString(CellAddress::Cell::ShowRowColumn).c_str());
+        if (prop) {
+            Map[v.second] = prop;
+        }
+    }
+}
+
 void Sheet::touchCells(Range range)
 {
     do {
@@ -1037,50 +1164,56 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
+    // Collect the dirty cells and all cells depending on them, counting for
+    // each one the number of inputs that still need to be recomputed.
+    std::map<CellAddress, int> pendingInputs;
+    for (const auto& addr : dirtyCells) {
+        pendingInputs.emplace(addr, 0);
+    }
     std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
     while (!workQueue.empty()) {
         CellAddress currPos = workQueue.front();
         workQueue.pop_front();
 
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
+        // Process cells that depend on the current cell
+        for (auto& dep : providesTo(currPos)) {
+            ++pendingInputs[dep];
+            if (dirtyCells.insert(dep).second) {
+                workQueue.push_back(dep);
+            }
         }
+    }
+
+    // Sort the cells topologically to find evaluation order
+    std::vector<CellAddress> make_order;
+    make_order.reserve(pendingInputs.size());
+    for (const auto& v : pendingInputs) {
+        if (v.second == 0) {
+            workQueue.push_back(v.first);
+        }
+    }
+    while (!workQueue.empty()) {
+        CellAddress currPos = workQueue.front();
+        workQueue.pop_front();
+        make_order.push_back(currPos);
 
-        // Process cells that depend on the current cell
         for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
-                }
+            if (--pendingInputs[dep] == 0) {
+                workQueue.push_back(dep);
             }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
         }
     }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+
+    if (make_order.size() == pendingInputs.size()) {
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
+        for (const auto& addr : make_order) {
             FC_TRACE(addr.toString());
             recomputeCell(addr);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
+    else {
+        for (auto& v : pendingInputs) {
             Cell* cell = cells.getValue(v.first);
             // Mark as erroneous
             if (cell) {
@@ -1220,6 +1353,8 @@ void Sheet::clear(CellAddress address, bool /*all*/)
         cells.clear(address);
     }
 
+    cellValues.erase(address);
+
     std::string addr = address.toString();
     if (auto prop = props.getDynamicPropertyByName(addr.c_str())) {
         propAddress.erase(prop);
@@ -1621,9 +1756,9 @@ void Sheet::providesTo(CellAddress address, std::set<std::string>& result) const
  * @param result Set of links.
  */
 
-std::set<CellAddress> Sheet::providesTo(CellAddress address) const
+const std::set<CellAddress>& Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName() + "." + address.toString());
+    return cells.getDependants(address);
 }
 
 void Sheet::onDocumentRestored()
@@ -37,6 +37,7 @@
 #include <App/Range.h>
 #include <Base/Unit.h>
 
+#include "CellValueStore.h"
 #include "PropertyColumnWidths.h"
 #include "PropertyRowHeights.h"
 #include "PropertySheet.h"
@@ -162,6 +163,11 @@ public:
 
     void setComputedUnit(App::CellAddress address, const Base::Unit& unit);
 
+    CellValueStore::ValueType
+    getCellValue(App::CellAddress address, double& value, Base::Unit& unit) const;
+
+    bool getCellInteger(App::CellAddress address, long& value) const;
+
     void setAlias(App::CellAddress address, const std::string& alias);
 
     std::string getAddressFromAlias(const std::string& alias) const;
@@ -189,6 +195,8 @@ public:
     void
     getPropertyNamedList(std::vector<std::pair<const char*, App::Property*>>& List) const override;
 
+    void getPropertyMap(std::map<std::string, App::Property*>& Map) const override;
+
     short mustExecute() const override;
 
     App::DocumentObjectExecReturn* execute() override;
@@ -239,7 +247,7 @@ protected:
 
     void updateColumnsOrRows(bool horizontal, int section, int count);
 
-    std::set<App::CellAddress> providesTo(App::CellAddress address) const;
+    const std::set<App::CellAddress>& providesTo(App::CellAddress address) const;
 
     void onDocumentRestored() override;
 
@@ -249,6 +257,10 @@ protected:
 
     App::Property* getProperty(const char* addr) const;
 
+    App::Property* materializeProperty(App::CellAddress key);
+
+    App::Property* addCellProperty(const char* type, const char* name);
+
     void updateProperty(App::CellAddress key);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
@@ -274,6 +286,12 @@ protected:
     /* Set of cells with errors */
     std::set<App::CellAddress> cellErrors;
 
+    /* Numeric cell results, exposed as properties only when looked up */
+    CellValueStore cellValues;
+
+    /* True while a cell property is being created from cellValues */
+    bool materializing = false;
+
     /* Properties */
 
     /* Cell data */
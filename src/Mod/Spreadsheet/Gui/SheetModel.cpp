@@ -187,9 +187,16 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
         return {};
     }
 
-    // Get display value as computed property
-    std::string address = CellAddress(row, col).toString();
-    Property* prop = sheet->getPropertyByName(address.c_str());
+    // Get display value from the numeric result or the computed property. The property of a
+    // numeric result is created on demand by the sheet, so it is not looked up here.
+    double value {};
+    Base::Unit unit;
+    CellValueStore::ValueType type = sheet->getCellValue(CellAddress(row, col), value, unit);
+    Property* prop = nullptr;
+    if (type == CellValueStore::None) {
+        std::string address = CellAddress(row, col).toString();
+        prop = sheet->getPropertyByName(address.c_str());
+    }
 
     if (role == Qt::BackgroundRole) {
         Color color;
@@ -253,7 +260,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
     auto dirtyCells = sheet->getCells()->getDirty();
     auto dirty = (dirtyCells.find(CellAddress(row, col)) != dirtyCells.end());
 
-    if (!prop || dirty) {
+    if ((type == CellValueStore::None && !prop) || dirty) {
         switch (role) {
             case Qt::ForegroundRole: {
                 return QColor(0,
@@ -286,7 +293,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom(App::PropertyString::getClassTypeId())) {
+    else if (type == CellValueStore::None
+             && prop->isDerivedFrom(App::PropertyString::getClassTypeId())) {
         /* String */
         const App::PropertyString* stringProp = static_cast<const App::PropertyString*>(prop);
 
@@ -321,9 +329,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom(App::PropertyQuantity::getClassTypeId())) {
+    else if (type == CellValueStore::Quantity) {
         /* Number */
-        const App::PropertyQuantity* floatProp = static_cast<const App::PropertyQuantity*>(prop);
 
         switch (role) {
             case Qt::ForegroundRole: {
@@ -334,7 +341,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                         QColor(255.0 * color.r, 255.0 * color.g, 255.0 * color.b, 255.0 * color.a));
                 }
                 else {
-                    if (floatProp->getValue() < 0) {
+                    if (value < 0) {
                         return QVariant::fromValue(QColor(negativeFgColor));
                     }
                     else {
@@ -355,18 +362,15 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
             }
             case Qt::DisplayRole: {
                 QString v;
-                const Base::Unit& computedUnit = floatProp->getUnit();
                 DisplayUnit displayUnit;
 
                 // Display locale specific decimal separator (#0003875,#0003876)
                 if (cell->getDisplayUnit(displayUnit)) {
-                    if (computedUnit.isEmpty() || computedUnit == displayUnit.unit) {
-                        QString number =
-                            QLocale().toString(floatProp->getValue() / displayUnit.scaler,
-                                               'f',
-                                               Base::UnitsApi::getDecimals());
-                        // QString number = QString::number(floatProp->getValue() /
-                        // displayUnit.scaler);
+                    if (unit.isEmpty() || unit == displayUnit.unit) {
+                        QString number = QLocale().toString(value / displayUnit.scaler,
+                                                            'f',
+                                                            Base::UnitsApi::getDecimals());
+                        // QString number = QString::number(value / displayUnit.scaler);
                         v = number + QString::fromStdString(" " + displayUnit.stringRep);
                     }
                     else {
@@ -377,8 +381,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
 
                     // When displaying a quantity then use the globally set scheme
                     // See: https://forum.freecad.org/viewtopic.php?f=3&t=50078
-                    Base::Quantity value = floatProp->getQuantityValue();
-                    v = value.getUserString();
+                    Base::Quantity quantity(value, unit);
+                    v = quantity.getUserString();
                 }
                 return formatCellDisplay(v, cell);
             }
@@ -386,19 +390,13 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom(App::PropertyFloat::getClassTypeId())
-             || prop->isDerivedFrom(App::PropertyInteger::getClassTypeId())) {
+    else if (type == CellValueStore::Float || type == CellValueStore::Integer) {
         /* Number */
-        double d {};
-        long l {};
-        bool isInteger = false;
-        if (prop->isDerivedFrom(App::PropertyFloat::getClassTypeId())) {
-            d = static_cast<const App::PropertyFloat*>(prop)->getValue();
-        }
-        else {
-            isInteger = true;
-            l = static_cast<const App::PropertyInteger*>(prop)->getValue();
-            d = l;
+        double d = value;
+        bool isInteger = type == CellValueStore::Integer;
+        long l = static_cast<long>(value);
+        if (isInteger) {
+            sheet->getCellInteger(CellAddress(row, col), l);
         }
 
         switch (role) {
@@ -454,7 +452,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom(App::PropertyPythonObject::getClassTypeId())) {
+    else if (type == CellValueStore::None
+             && prop->isDerivedFrom(App::PropertyPythonObject::getClassTypeId())) {
         auto pyProp = static_cast<const App::PropertyPythonObject*>(prop);
 
         switch (role) {
@@ -816,7 +816,7 @@ std::pair<Base::Vector3d, Base::Vector3d> CenterLine::calcEndPoints2Points(const
 }
 
 // Persistence implementers
-unsigned int CenterLine::getMemSize () const
+std::size_t CenterLine::getMemSize () const
 {
     return 1;
 }
@@ -207,7 +207,7 @@ void CosmeticEdge::dump(const char* title) const
 }
 
 // Persistence implementers
-unsigned int CosmeticEdge::getMemSize () const
+std::size_t CosmeticEdge::getMemSize () const
 {
     return 1;
 }
@@ -419,7 +419,7 @@ std::string GeomFormat::toString() const
 }
 
 // Persistence implementer
-unsigned int GeomFormat::getMemSize () const
+std::size_t GeomFormat::getMemSize () const
 {
     return 1;
 }
@@ -67,7 +67,7 @@ public:
 
     // from base class
     PyObject *getPyObject() override;
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 public:
     std::vector<TechDraw::BaseGeomPtr> getGeometry() { return geom; }
@@ -197,9 +197,9 @@ void PropertyCosmeticEdgeList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyCosmeticEdgeList::getMemSize() const
+std::size_t PropertyCosmeticEdgeList::getMemSize() const
 {
-    int size = sizeof(PropertyCosmeticEdgeList);
+    std::size_t size = sizeof(PropertyCosmeticEdgeList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i]->getMemSize();
     return size;
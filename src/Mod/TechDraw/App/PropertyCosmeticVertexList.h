@@ -82,7 +82,7 @@ public:
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
 
-    unsigned int getMemSize() const override;
+    std::size_t getMemSize() const override;
 
 private:
     std::vector<CosmeticVertex*> _lValueList;
@@ -207,9 +207,9 @@ void PropertyGeomFormatList::Paste(const Property &from)
     setValues(FromList._lValueList);
 }
 
-unsigned int PropertyGeomFormatList::getMemSize() const
+std::size_t PropertyGeomFormatList::getMemSize() const
 {
-    int size = sizeof(PropertyGeomFormatList);
+    std::size_t size = sizeof(PropertyGeomFormatList);
     for (int i = 0; i < getSize(); i++)
         size += _lValueList[i]->getMemSize();
     return size;
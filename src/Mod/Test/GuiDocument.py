@@ -55,3 +55,40 @@ class TestGuiDocument(unittest.TestCase):
         # Check if the new function returns the correct root objects
         expected_root_objects = [group1, group2, obj1, part1]
         self.assertEqual(set(root_objects), set(expected_root_objects))
+
+    def testAddSelections(self):
+        group = self.doc.addObject("App::DocumentObjectGroup", "Group")
+        obj1 = group.newObject("App::FeaturePython", "Object1")
+        obj2 = group.newObject("App::FeaturePython", "Object2")
+
+        class Observer:
+            def __init__(self):
+                self.added = []
+                self.set = []
+
+            def addSelection(self, doc, obj, sub, pnt):
+                self.added.append((doc, obj, sub))
+
+            def setSelection(self, doc):
+                self.set.append(doc)
+
+        observer = Observer()
+        FreeCADGui.Selection.clearSelection()
+        FreeCADGui.Selection.addObserver(observer, 0)
+        try:
+            # several elements at once still notify each added element
+            FreeCADGui.Selection.addSelection(group, [obj1.Name + ".", obj2.Name + "."])
+        finally:
+            FreeCADGui.Selection.removeObserver(observer)
+
+        self.assertEqual(
+            observer.added,
+            [
+                (self.doc.Name, group.Name, obj1.Name + "."),
+                (self.doc.Name, group.Name, obj2.Name + "."),
+            ],
+        )
+        self.assertEqual(observer.set, [self.doc.Name])
+        self.assertEqual(len(FreeCADGui.Selection.getSelectionEx("", 0)), 1)
+        self.assertEqual(len(FreeCADGui.Selection.getSelectionEx("", 0)[0].SubElementNames), 2)
+        FreeCADGui.Selection.clearSelection()
@@ -58,6 +58,10 @@ ConstEntryPointer ZipInputStream::getNextEntry() {
   return izf->getNextEntry() ;
 }
 
+bool ZipInputStream::readRawEntry( std::string &data ) {
+  return izf->readRawEntry( data ) ;
+}
+
 ZipInputStream::~ZipInputStream() {
   // It's ok to call delete with a Null pointer.
   delete izf ;
@@ -49,6 +49,10 @@ public:
   */
   ConstEntryPointer getNextEntry() ;
 
+  /** Reads the still compressed data of the current entry, see
+      ZipInputStreambuf::readRawEntry(). */
+  bool readRawEntry( std::string &data ) ;
+
   /** Destructor. */
   virtual ~ZipInputStream() ;
 
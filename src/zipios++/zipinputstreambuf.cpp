@@ -79,6 +79,18 @@ ConstEntryPointer ZipInputStreambuf::getNextEntry() {
 }
 
 
+bool ZipInputStreambuf::readRawEntry( std::string &data ) {
+  if ( ! _open_entry )
+    return false ;
+
+  _inbuf->pubseekoff( _data_start, ios::beg, ios::in ) ;
+  data.resize( _curr_entry.getCompressedSize() ) ;
+  int count = data.empty() ? 0 : _inbuf->sgetn( &( data[ 0 ] ), data.size() ) ;
+  _open_entry = false ;
+  return count == static_cast< int >( data.size() ) ;
+}
+
+
 ZipInputStreambuf::~ZipInputStreambuf() {
 }
 
@@ -39,6 +39,11 @@ public:
   */
   ConstEntryPointer getNextEntry() ;
 
+  /** Reads the still compressed data of the current entry into data,
+      bypassing the inflater. The entry is consumed afterwards.
+      @return false if there is no open entry or the data could not be read. */
+  bool readRawEntry( std::string &data ) ;
+
   /** Destructor. */
   virtual ~ZipInputStreambuf() ;
 protected:
@@ -5,6 +5,7 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObject.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +95,39 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, undoLimitDropsOldestTransactions)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto obj = doc()->addObject("App::FeatureTest", "Test");
+    doc()->setUndoLimit(2500);
+
+    // Act
+    for (int i = 0; i < 5; i++) {
+        doc()->openTransaction("Label");
+        obj->Label.setValue(std::string(1000, char('a' + i)));
+        doc()->commitTransaction();
+    }
+
+    // Assert
+    EXPECT_EQ(doc()->getAvailableUndos(), 2);
+    EXPECT_LE(doc()->getUndoMemSize(), doc()->getUndoLimit());
+    EXPECT_GE(doc()->getUndoMemSize(), 2000U);
+}
+
+TEST_F(DocumentTest, undoLimitAbove4GiBIsKept)
+{
+    // Arrange
+    if (sizeof(std::size_t) < 8) {
+        GTEST_SKIP() << "size_t has only 32 bits";
+    }
+    const std::size_t limit = std::size_t(5) * 1024 * 1024 * 1024;
+
+    // Act
+    doc()->setUndoLimit(limit);
+
+    // Assert
+    EXPECT_EQ(doc()->getUndoLimit(), limit);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -427,6 +427,57 @@ TEST_F(ElementMapTest, mimicSimpleUnion)
     // "Face3" is the localized name
 }
 
+TEST_F(ElementMapTest, encodeElementNameIntoStringMatchesStream)
+{
+    // Arrange
+    LessComplexPart part(3L, "Fusion", _hasher);
+    struct Case
+    {
+        const char* prefilled;
+        const char* postfix;
+        long tag;
+        bool forceTag;
+    };
+    std::vector<Case> cases {{"", ";FUS", 1L, false},
+                             {"", "FUS", -0x2aL, false},
+                             {";:C", nullptr, 0x1234L, false},
+                             {"", ";FUS", 0L, true},
+                             {"", nullptr, 3L, false}};
+
+    for (const auto& test : cases) {
+        // Act
+        std::ostringstream ss;
+        ss << test.prefilled;
+        Data::MappedName streamName("Face6");
+        part.elementMapPtr->encodeElementName('F',
+                                              streamName,
+                                              ss,
+                                              nullptr,
+                                              part.Tag,
+                                              test.postfix,
+                                              test.tag,
+                                              test.forceTag);
+        std::string buffer(test.prefilled);
+        Data::MappedName stringName("Face6");
+        part.elementMapPtr->encodeElementName('F',
+                                              stringName,
+                                              buffer,
+                                              nullptr,
+                                              part.Tag,
+                                              test.postfix,
+                                              test.tag,
+                                              test.forceTag);
+
+        // Assert
+        EXPECT_EQ(stringName.toString(), streamName.toString());
+        EXPECT_EQ(buffer, ss.str());
+    }
+    std::string buffer;
+    Data::MappedName name("Face6");
+    part.elementMapPtr->encodeElementName('F', name, buffer, nullptr, part.Tag, ";FUS", -0x2a);
+    EXPECT_EQ(name.toString(), "Face6;FUS;:H-2a:4,F");
+}
+
 TEST_F(ElementMapTest, mimicOperationAgainstSelf)
 {
     // Arrange
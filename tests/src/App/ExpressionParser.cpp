@@ -7,6 +7,8 @@
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
+#include "App/PropertyUnits.h"
+#include "Base/Interpreter.h"
 
 #include "src/App/InitApplication.h"
 
@@ -117,4 +119,33 @@ TEST_F(ExpressionParserTest, isTokenAConstant)
     }
 }
 
+TEST_F(ExpressionParserTest, nativeEvaluationMatchesPython)
+{
+    auto length = static_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "Len"));
+    length->setValue(5.0);
+
+    std::array<const char*, 18> expressions {
+        "1 + 2", "7 / 2", "7 % -3", "-7 % 3", "2 ^ 10", "2 ^ -1", "3.5 % 2", "-(1 + 1)",
+        "10 mm * 2", "-3 mm + 5 mm", "7 mm % 4", "(2 mm) ^ 2", "1 mm < 2 mm", "1 == 1",
+        "(1 > 0) ? 3 : 4.5", "sin(30 deg)", "hypot(3 mm, 4 mm)", "Len * 2 + 1 mm",
+    };
+    for (const auto& text : expressions) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text));
+        auto native = expression->getValueAsAny();
+        App::any python;
+        {
+            Base::PyGILStateLocker lock;
+            python = App::pyObjectToAny(expression->getPyValue());
+        }
+        EXPECT_EQ(native.type(), python.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(native, python)) << text;
+    }
+
+    // values that cannot be represented natively fall back to Python
+    std::unique_ptr<App::Expression> overflow(App::ExpressionParser::parse(this_obj(), "2 ^ 62 * 4 / 8"));
+    EXPECT_EQ(App::any_cast<double>(overflow->getValueAsAny()), 2305843009213693952.0);
+    std::unique_ptr<App::Expression> mismatch(App::ExpressionParser::parse(this_obj(), "1 mm + 1 s"));
+    EXPECT_ANY_THROW(mismatch->getValueAsAny());
+}
+
 // clang-format on
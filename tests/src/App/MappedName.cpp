@@ -649,6 +649,23 @@ TEST(MappedName, compare)
     EXPECT_EQ(mappedName1 < mappedName6, true);
 }
 
+TEST(MappedName, compareAcrossPostfix)
+{
+    // Arrange
+    Data::MappedName mappedName1(Data::MappedName("TE"), "STPOSTFIXA");
+    Data::MappedName mappedName2(Data::MappedName("TESTPOSTFI"), "XB");
+    Data::MappedName mappedName3(Data::MappedName("TESTPOSTFIXA"));
+    Data::MappedName mappedName4(Data::MappedName("TESTPOST"), "FIXAA");
+
+    // Act & Assert
+    EXPECT_EQ(mappedName1.compare(mappedName2), -1);
+    EXPECT_EQ(mappedName2.compare(mappedName1), 1);
+    EXPECT_EQ(mappedName1.compare(mappedName3), 0);
+    EXPECT_EQ(mappedName3.compare(mappedName1), 0);
+    EXPECT_EQ(mappedName1.compare(mappedName4), -1);
+    EXPECT_EQ(mappedName4.compare(mappedName3), 1);
+}
+
 TEST(MappedName, subscriptOperator)
 {
     // Arrange
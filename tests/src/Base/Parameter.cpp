@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <boost/core/ignore_unused.hpp>
 #include <QLockFile>
 #include <Base/FileInfo.h>
@@ -250,6 +253,82 @@ TEST_F(ParameterTest, TestString)
     EXPECT_EQ(grp->GetASCIIs().size(), 1);
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+
+    // a missing parameter always returns the given preset
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+    EXPECT_EQ(grp->GetInt("Int", 2), 2);
+    EXPECT_EQ(grp->GetFloat("Float", 1.5), 1.5);
+
+    grp->SetInt("Int", 3);
+    grp->SetFloat("Float", 2.5);
+    EXPECT_EQ(grp->GetInt("Int", 1), 3);
+    EXPECT_EQ(grp->GetFloat("Float", 1.5), 2.5);
+
+    grp->SetInt("Int", 4);
+    EXPECT_EQ(grp->GetInt("Int", 1), 4);
+
+    // same name but different type
+    EXPECT_EQ(grp->GetUnsigned("Int", 5), 5);
+    EXPECT_EQ(grp->GetBool("Int", true), true);
+
+    grp->RemoveInt("Int");
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+
+    grp->SetBool("Bool", true);
+    EXPECT_EQ(grp->GetBool("Bool", false), true);
+    grp->Clear(true);
+    EXPECT_EQ(grp->GetBool("Bool", false), false);
+    EXPECT_EQ(grp->GetFloat("Float", 1.5), 1.5);
+}
+
+TEST_F(ParameterTest, TestCachedValuesNotify)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+
+    // observers already see the new value
+    long value = 0;
+    auto conn = cfg->signalParamChanged.connect(
+        [&value](ParameterGrp* param, ParameterGrp::ParamType, const char* name, const char*) {
+            value = param->GetInt(name, 1);
+        });
+    grp->SetInt("Int", 3);
+    EXPECT_EQ(value, 3);
+    grp->RemoveInt("Int");
+    EXPECT_EQ(value, 1);
+    conn.disconnect();
+}
+
+TEST_F(ParameterTest, TestCachedValuesThreads)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    grp->SetInt("Int", 3);
+    grp->SetFloat("Float", 2.5);
+
+    std::atomic<int> errors {0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&grp, &errors]() {
+            for (int j = 0; j < 1000; j++) {
+                if (grp->GetInt("Int", 1) != 3 || grp->GetFloat("Float", 1.5) != 2.5
+                    || grp->GetBool("Bool", true) != true) {
+                    errors++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(errors, 0);
+}
+
 TEST_F(ParameterTest, TestCopy)
 {
     auto cfg = getCreateConfig();
@@ -7,10 +7,13 @@
 #endif
 
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <iterator>
 #include <xercesc/util/PlatformUtils.hpp>
 
 namespace fs = boost::filesystem;
@@ -342,3 +345,101 @@ TEST_F(ReaderTest, invalidDefaults)
         { Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+namespace
+{
+// restores the text of its file, and takes it over from the source if share is set
+class SharedText: public Base::Persistence
+{
+public:
+    explicit SharedText(bool share)
+        : share(share)
+    {}
+    std::size_t getMemSize() const override
+    {
+        return static_cast<unsigned int>(text.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << text;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        text.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+        restored++;
+    }
+    bool RestoreSharedDocFile(const Base::Persistence& source) override
+    {
+        if (!share) {
+            return false;
+        }
+        text = static_cast<const SharedText&>(source).text;
+        shared++;
+        return true;
+    }
+
+    std::string text;
+    int restored {0};
+    int shared {0};
+
+private:
+    bool share;
+};
+
+// writes a project file with one shared file and returns its content
+std::string writeSharedProject(const std::string& text, std::string& fileName)
+{
+    SharedText first {false};
+    SharedText second {false};
+    first.text = text;
+    second.text = text;
+    std::ostringstream stream;
+    {
+        Base::ZipWriter writer(stream);
+        writer.setMode("DeduplicateFiles");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><Document/>)";
+        fileName = writer.addSharedFile("Shape.brp", &first);
+        EXPECT_EQ(writer.addSharedFile("Shape.brp", &second), fileName);
+        writer.writeFiles();
+    }
+    return stream.str();
+}
+}  // namespace
+
+TEST_F(ReaderTest, restoreSharedFile)
+{
+    std::string fileName;
+    const std::string project = writeSharedProject("shared content", fileName);
+    for (int threads : {1, 2}) {
+        // Arrange
+        SharedText first {false};
+        SharedText taking {true};
+        SharedText copying {false};
+        std::istringstream stream(project);
+        zipios::ZipInputStream zip(stream);
+        Base::XMLReader reader("Document.xml", zip);
+        reader.setThreadCount(threads);
+        reader.addFile(fileName.c_str(), &first);
+        reader.addFile(fileName.c_str(), &taking);
+        reader.addFile(fileName.c_str(), &copying);
+
+        // Act
+        reader.readFiles(zip);
+
+        // Assert: the file is read for the first object, which is the source for the others
+        EXPECT_FALSE(reader.hasReadFailed(fileName));
+        EXPECT_EQ(first.restored, 1);
+        EXPECT_EQ(first.text, "shared content");
+        EXPECT_EQ(taking.restored, 0);
+        EXPECT_EQ(taking.shared, 1);
+        EXPECT_EQ(taking.text, "shared content");
+        EXPECT_EQ(copying.restored, 1);
+        EXPECT_EQ(copying.shared, 0);
+        EXPECT_EQ(copying.text, "shared content");
+    }
+}
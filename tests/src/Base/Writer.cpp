@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <map>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +133,160 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+// writes a fixed text as its file content
+class TextFile: public Base::Persistence
+{
+public:
+    explicit TextFile(std::string text)
+        : text(std::move(text))
+    {}
+    std::size_t getMemSize() const override
+    {
+        return static_cast<unsigned int>(text.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << text;
+    }
+
+private:
+    std::string text;
+};
+
+// leaves its header out of the content that it shares with other objects
+class HeaderFile: public TextFile
+{
+public:
+    HeaderFile(std::string header, std::string text)
+        : TextFile(std::move(text))
+        , header(std::move(header))
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << header;
+        TextFile::SaveDocFile(writer);
+    }
+    bool SaveSharedDocFile(Base::Writer& writer) const override
+    {
+        TextFile::SaveDocFile(writer);
+        return true;
+    }
+
+private:
+    std::string header;
+};
+
+std::map<std::string, std::string> readZipEntries(std::istream& stream)
+{
+    std::map<std::string, std::string> entries;
+    // the first entry is already opened by the constructor, in these tests it's the Document.xml
+    zipios::ZipInputStream zip(stream);
+    entries["Document.xml"] = std::string {std::istreambuf_iterator<char>(zip),
+                                           std::istreambuf_iterator<char>()};
+    try {
+        for (zipios::ConstEntryPointer entry = zip.getNextEntry(); entry->isValid();
+             entry = zip.getNextEntry()) {
+            entries[entry->getName()] = std::string {std::istreambuf_iterator<char>(zip),
+                                                     std::istreambuf_iterator<char>()};
+        }
+    }
+    catch (const std::exception&) {
+        // reading the central directory after the last entry fails
+    }
+    return entries;
+}
+}  // namespace
+
+TEST(ZipWriterTest, addSharedFileDeduplicates)
+{
+    // Arrange
+    TextFile first {"identical content"};
+    TextFile second {"identical content"};
+    TextFile third {"other content"};
+    std::stringstream stream;
+    std::string name1, name2, name3;
+
+    // Act
+    {
+        Base::ZipWriter writer(stream);
+        writer.setMode("DeduplicateFiles");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        name1 = writer.addSharedFile("Shape.brp", &first);
+        name2 = writer.addSharedFile("Shape.brp", &second);
+        name3 = writer.addSharedFile("Shape.brp", &third);
+        // the pending entry is not affected by the serialization of the shared files
+        writer.Stream() << "<!-- end -->";
+        writer.writeFiles();
+    }
+
+    // Assert
+    EXPECT_EQ(name1, name2);
+    EXPECT_NE(name1, name3);
+    auto entries = readZipEntries(stream);
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries["Document.xml"], "<Document/><!-- end -->");
+    EXPECT_EQ(entries[name1], "identical content");
+    EXPECT_EQ(entries[name3], "other content");
+}
+
+TEST(ZipWriterTest, addSharedFileWritesUniqueFilesInFull)
+{
+    // Arrange
+    HeaderFile first {"first:", "identical content"};
+    HeaderFile second {"second:", "identical content"};
+    HeaderFile third {"third:", "other content"};
+    std::stringstream stream;
+    std::string name1, name2, name3;
+
+    // Act
+    {
+        Base::ZipWriter writer(stream);
+        writer.setMode("DeduplicateFiles");
+        writer.putNextEntry("Document.xml");
+        name1 = writer.addSharedFile("Shape.brp", &first);
+        name2 = writer.addSharedFile("Shape.brp", &second);
+        name3 = writer.addSharedFile("Shape.brp", &third);
+        writer.writeFiles();
+    }
+
+    // Assert
+    EXPECT_EQ(name1, name2);
+    auto entries = readZipEntries(stream);
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[name1], "identical content");
+    EXPECT_EQ(entries[name3], "third:other content");
+}
+
+TEST(ZipWriterTest, addSharedFileWithoutMode)
+{
+    // Arrange
+    TextFile first {"identical content"};
+    TextFile second {"identical content"};
+    std::stringstream stream;
+    std::string name1, name2;
+
+    // Act
+    {
+        Base::ZipWriter writer(stream);
+        writer.setThreadCount(2);
+        writer.putNextEntry("Document.xml");
+        name1 = writer.addSharedFile("Shape.brp", &first);
+        name2 = writer.addSharedFile("Shape.brp", &second);
+        writer.writeFiles();
+    }
+
+    // Assert
+    EXPECT_NE(name1, name2);
+    auto entries = readZipEntries(stream);
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[name1], "identical content");
+    EXPECT_EQ(entries[name2], "identical content");
+}
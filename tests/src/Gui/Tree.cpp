@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <QTest>
+#include <QTreeWidgetItemIterator>
+
+#include <Inventor/SoDB.h>
+#include <Inventor/SoInteraction.h>
+#include <Inventor/nodekits/SoNodeKit.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObjectGroup.h>
+
+#include "Gui/Application.h"
+#include "Gui/SoFCDB.h"
+#include "Gui/Tree.h"
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class testTree: public QObject
+{
+    Q_OBJECT
+
+public:
+    testTree()
+    {
+        tests::initApplication();
+        Gui::Application::initApplication();
+        if (!Gui::Application::Instance) {
+            new Gui::Application(false);
+        }
+        if (!SoDB::isInitialized()) {
+            SoDB::init();
+            SoNodeKit::init();
+            SoInteraction::init();
+        }
+        if (!Gui::SoFCDB::isInitialized()) {
+            Gui::SoFCDB::init();
+        }
+    }
+
+private Q_SLOTS:
+
+    void init()
+    {
+        tree = std::make_unique<Gui::TreeWidget>("testTree");
+        docName = App::GetApplication().getUniqueDocumentName("test");
+        doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    }
+
+    void cleanup()
+    {
+        App::GetApplication().closeDocument(docName.c_str());
+        tree.reset();
+    }
+
+    void test_RootItemsKeepObjectOrder()  // NOLINT
+    {
+        const int count = 50;
+        for (int i = 0; i < count; ++i) {
+            doc->addObject("App::DocumentObjectGroup", "Group");
+        }
+        updateStatus();
+
+        auto first = findItem("Group");
+        QVERIFY(first);
+        auto docItem = first->parent();
+        QCOMPARE(docItem->childCount(), count);
+        for (int i = 0; i < count; ++i) {
+            auto obj = doc->getObjects()[i];
+            QCOMPARE(docItem->child(i)->text(0), QString::fromUtf8(obj->Label.getValue()));
+        }
+    }
+
+    void test_ExpandedItemsGetTheirStatus()  // NOLINT
+    {
+        auto group = static_cast<App::DocumentObjectGroup*>(
+            doc->addObject("App::DocumentObjectGroup", "Group"));
+        auto child = doc->addObject("App::DocumentObjectGroup", "Child");
+        group->addObject(child);
+        updateStatus();
+
+        auto groupItem = findItem("Group");
+        QVERIFY(groupItem);
+        groupItem->setExpanded(true);
+        auto childItem = findItem("Child");
+        QVERIFY(childItem);
+        QVERIFY(!childItem->data(0, Qt::ForegroundRole).isValid());
+
+        // the status of items in collapsed branches is checked once they are expanded
+        groupItem->setExpanded(false);
+        child->Visibility.setValue(false);
+        updateStatus();
+        groupItem->setExpanded(true);
+        QVERIFY(childItem->data(0, Qt::ForegroundRole).isValid());
+    }
+
+private:
+    void updateStatus()
+    {
+        QMetaObject::invokeMethod(tree.get(), "onUpdateStatus");
+    }
+
+    QTreeWidgetItem* findItem(const char* label) const
+    {
+        for (QTreeWidgetItemIterator it(tree.get()); *it; ++it) {
+            if ((*it)->type() == Gui::TreeWidget::ObjectType
+                && (*it)->text(0) == QLatin1String(label)) {
+                return *it;
+            }
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<Gui::TreeWidget> tree;
+    std::string docName;
+    App::Document* doc {nullptr};
+};
+
+// NOLINTEND(readability-magic-numbers)
+
+QTEST_MAIN(testTree)
+
+#include "Tree.moc"
@@ -0,0 +1,154 @@
+#include "gtest/gtest.h"
+#include <list>
+#include <thread>
+#include <vector>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <App/Application.h>
+#include <src/App/InitApplication.h>
+#include <Mod/CAM/App/Area.h>
+#include <Mod/CAM/libarea/Area.h>
+
+class AreaTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {
+        setSectionThreads(0);
+    }
+
+    static void setSectionThreads(unsigned long threads)
+    {
+        App::GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/CAM")
+            ->SetUnsigned("AreaSectionThreads", threads);
+    }
+
+    // a square with a square hole, so that the zigzag passes need reordering
+    static CArea makeFrame(double size)
+    {
+        CArea area;
+        CCurve outer;
+        outer.append(CVertex(Point(0, 0)));
+        outer.append(CVertex(Point(size, 0)));
+        outer.append(CVertex(Point(size, size)));
+        outer.append(CVertex(Point(0, size)));
+        outer.append(CVertex(Point(0, 0)));
+        area.append(outer);
+        CCurve inner;
+        double a = size / 3.0;
+        double b = 2.0 * size / 3.0;
+        inner.append(CVertex(Point(a, a)));
+        inner.append(CVertex(Point(a, b)));
+        inner.append(CVertex(Point(b, b)));
+        inner.append(CVertex(Point(b, a)));
+        inner.append(CVertex(Point(a, a)));
+        area.append(inner);
+        return area;
+    }
+
+    static std::list<CCurve> makeZigZag(const CArea& area)
+    {
+        std::list<CCurve> toolpath;
+        CAreaPocketParams params(1.0, 0.0, 0.7, false, ZigZagPocketMode, 30.0);
+        area.MakePocketToolpath(toolpath, params);
+        return toolpath;
+    }
+
+    static void expectSamePath(const std::list<CCurve>& expected, const std::list<CCurve>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        auto it = actual.begin();
+        for (const CCurve& curve : expected) {
+            ASSERT_EQ(curve.m_vertices.size(), it->m_vertices.size());
+            auto vt = it->m_vertices.begin();
+            for (const CVertex& vertex : curve.m_vertices) {
+                EXPECT_EQ(vertex.m_type, vt->m_type);
+                EXPECT_DOUBLE_EQ(vertex.m_p.x, vt->m_p.x);
+                EXPECT_DOUBLE_EQ(vertex.m_p.y, vt->m_p.y);
+                ++vt;
+            }
+            ++it;
+        }
+    }
+
+    static std::vector<gp_Pnt> vertices(const TopoDS_Shape& shape)
+    {
+        std::vector<gp_Pnt> points;
+        for (TopExp_Explorer xp(shape, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            points.push_back(BRep_Tool::Pnt(TopoDS::Vertex(xp.Current())));
+        }
+        return points;
+    }
+
+    static TopoDS_Shape pocketSections(unsigned long threads)
+    {
+        setSectionThreads(threads);
+        Path::Area area;
+        Path::AreaParams params;
+        params.SectionCount = 5;
+        params.Stepdown = 2.0;
+        params.SectionMode = Path::Area::SectionModeBoundBox;
+        area.setParams(params);
+        area.add(BRepPrimAPI_MakeBox(gp_Pnt(0, 0, 0), 30.0, 20.0, 10.0).Shape());
+        return area.makePocket(-1, Path::Area::PocketModeZigZag, 1.0);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(AreaTest, parallelZigZagMatchesSerial)
+{
+    // non default settings on the calling thread, which the workers must pick up
+    double accuracy = CArea::get_accuracy();
+    CArea::set_accuracy(0.05);
+
+    std::vector<CArea> sections;
+    for (int i = 0; i < 8; ++i) {
+        sections.push_back(makeFrame(20.0 + 3.0 * i));
+    }
+    std::vector<std::list<CCurve>> serial;
+    for (const CArea& area : sections) {
+        serial.push_back(makeZigZag(area));
+    }
+
+    std::vector<std::list<CCurve>> parallel(sections.size());
+    CArea::ThreadSettings settings;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < sections.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            settings.apply();
+            parallel[i] = makeZigZag(sections[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CArea::set_accuracy(accuracy);
+
+    for (std::size_t i = 0; i < sections.size(); ++i) {
+        EXPECT_FALSE(serial[i].empty());
+        expectSamePath(serial[i], parallel[i]);
+    }
+}
+
+TEST_F(AreaTest, parallelSectionPocketMatchesSerial)
+{
+    std::vector<gp_Pnt> serial = vertices(pocketSections(1));
+    std::vector<gp_Pnt> parallel = vertices(pocketSections(4));
+    ASSERT_FALSE(serial.empty());
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_TRUE(serial[i].IsEqual(parallel[i], 1e-9)) << "vertex " << i;
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <Mod/Inspection/App/InspectionFeature.h>
+
+class InspectionFeatureTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {}
+
+    void TearDown() override
+    {}
+
+    // compares the tessellated nominal with the exact one at the given points
+    static void compareWithExactNominal(const TopoDS_Shape& shape,
+                                        const std::vector<Base::Vector3f>& points,
+                                        float tolerance)
+    {
+        const float searchRadius = 20.0F;
+        Inspection::InspectNominalShape exact(shape, searchRadius);
+        Inspection::InspectNominalTessellatedShape tessellated(shape, searchRadius);
+        ASSERT_FALSE(tessellated.isEmpty());
+        for (const auto& pnt : points) {
+            EXPECT_NEAR(tessellated.getDistance(pnt), exact.getDistance(pnt), tolerance)
+                << "at (" << pnt.x << ", " << pnt.y << ", " << pnt.z << ")";
+        }
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(InspectionFeatureTest, tessellatedBoxMatchesExactNominal)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    std::vector<Base::Vector3f> points {
+        {15.0F, 5.0F, 5.0F},   // outside a face
+        {5.0F, 5.0F, 2.0F},    // inside
+        {13.0F, 14.0F, 5.0F},  // outside an edge
+        {12.0F, 12.0F, 12.0F}  // outside a vertex
+    };
+    compareWithExactNominal(box, points, 1.0e-4F);
+}
+
+TEST_F(InspectionFeatureTest, tessellatedCylinderMatchesExactNominal)
+{
+    TopoDS_Shape cylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0).Shape();
+    std::vector<Base::Vector3f> points {
+        {8.0F, 0.0F, 5.0F},   // outside the lateral face
+        {0.0F, -6.5F, 3.0F},  // outside the lateral face
+        {2.0F, 1.0F, 5.0F},   // inside
+        {1.0F, 1.0F, 13.0F}   // above the top face
+    };
+    // the distance to the curved face is refined by projecting onto the surface
+    compareWithExactNominal(cylinder, points, 1.0e-3F);
+}
+
+TEST_F(InspectionFeatureTest, tessellatedNominalKeepsShapeUntouched)
+{
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+    Inspection::InspectNominalTessellatedShape nominal(box, 1.0F);
+    ASSERT_FALSE(nominal.isEmpty());
+
+    for (TopExp_Explorer xp(box, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        EXPECT_TRUE(BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull());
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
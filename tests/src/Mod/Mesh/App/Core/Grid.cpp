@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class GridTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a wavy surface with enough facets to fill the grid on several threads
+        const int nx = 200;
+        const int ny = 50;
+        auto point = [](int i, int j) {
+            return Base::Vector3f(float(i), float(j), 5.0F * std::sin(0.1F * float(i + j)));
+        };
+
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < ny; j++) {
+                facets.emplace_back(point(i, j), point(i + 1, j), point(i + 1, j + 1));
+                facets.emplace_back(point(i, j), point(i + 1, j + 1), point(i, j + 1));
+            }
+        }
+        kernel = facets;
+    }
+
+    void TearDown() override
+    {}
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(GridTest, TestFacetGridVerify)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel());
+    EXPECT_TRUE(grid.Verify());
+}
+
+TEST_F(GridTest, TestFacetGridElements)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel());
+
+    std::vector<unsigned long> count(GetKernel().CountFacets());
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        unsigned long ulX {}, ulY {}, ulZ {};
+        it.GetGridPos(ulX, ulY, ulZ);
+        MeshCore::MeshGrid::ElementSpan span = grid.GetElementSpan(ulX, ulY, ulZ);
+        EXPECT_EQ(span.size(), it.GetCtElements());
+        EXPECT_TRUE(std::is_sorted(span.begin(), span.end()));
+        EXPECT_TRUE(std::adjacent_find(span.begin(), span.end()) == span.end());
+        for (MeshCore::ElementIndex index : span) {
+            count[index]++;
+        }
+    }
+
+    // each facet is in at least one grid element
+    EXPECT_TRUE(std::find(count.begin(), count.end(), 0) == count.end());
+}
+
+TEST_F(GridTest, TestFacetGridNearest)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel());
+
+    std::vector<Base::Vector3f> points {Base::Vector3f(10.3F, 20.7F, 1.0F),
+                                        Base::Vector3f(0.2F, 10.0F, 0.0F),
+                                        Base::Vector3f(60.2F, 49.9F, -3.0F),
+                                        Base::Vector3f(119.5F, 0.5F, 4.0F)};
+    for (const auto& pnt : points) {
+        float minDist = FLOAT_MAX;
+        MeshCore::MeshFacetIterator it(GetKernel());
+        for (it.Init(); it.More(); it.Next()) {
+            minDist = std::min(minDist, it->DistanceToPoint(pnt));
+        }
+
+        MeshCore::ElementIndex index = grid.SearchNearestFromPoint(pnt);
+        ASSERT_NE(index, MeshCore::ELEMENT_INDEX_MAX);
+        EXPECT_FLOAT_EQ(GetKernel().GetFacet(index).DistanceToPoint(pnt), minDist);
+    }
+}
+
+TEST_F(GridTest, TestFacetGridInside)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel());
+
+    Base::BoundBox3f box(20.0F, 10.0F, -10.0F, 30.0F, 20.0F, 10.0F);
+    std::vector<MeshCore::ElementIndex> elements;
+    grid.Inside(box, elements);
+    std::set<MeshCore::ElementIndex> elementSet;
+    grid.Inside(box, elementSet);
+
+    EXPECT_FALSE(elements.empty());
+    EXPECT_EQ(elements.size(), elementSet.size());
+    EXPECT_TRUE(std::equal(elements.begin(), elements.end(), elementSet.begin()));
+
+    // all facets inside the box must be found
+    MeshCore::MeshFacetIterator it(GetKernel());
+    for (it.Init(); it.More(); it.Next()) {
+        if (box.IsInBox(it->GetBoundBox())) {
+            EXPECT_EQ(elementSet.count(it.Position()), 1);
+        }
+    }
+}
+
+TEST_F(GridTest, TestPointGrid)
+{
+    MeshCore::MeshPointGrid grid(GetKernel());
+    EXPECT_EQ(grid.GetCtElements(0, 0, 0), grid.GetElementSpan(0, 0, 0).size());
+
+    const MeshCore::MeshPointArray& points = GetKernel().GetPoints();
+    for (MeshCore::PointIndex index = 0; index < points.size(); index++) {
+        std::set<MeshCore::ElementIndex> elements;
+        grid.FindElements(points[index], elements);
+        EXPECT_EQ(elements.count(index), 1);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
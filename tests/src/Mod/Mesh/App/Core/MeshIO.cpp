@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <Mod/Mesh/App/Core/IO/ParallelWriter.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshIOTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a tessellated unit cube with more facets than fit into one chunk per thread
+        const int n = 100;
+        const float step = 1.0F / float(n);
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        auto addFace = [&](const Base::Vector3f& base,
+                           const Base::Vector3f& u,
+                           const Base::Vector3f& v) {
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) {
+                    Base::Vector3f p0 = base + u * (float(i) * step) + v * (float(j) * step);
+                    Base::Vector3f p1 = p0 + u * step;
+                    Base::Vector3f p2 = p1 + v * step;
+                    Base::Vector3f p3 = p0 + v * step;
+                    facets.emplace_back(p0, p1, p2);
+                    facets.emplace_back(p0, p2, p3);
+                }
+            }
+        };
+
+        Base::Vector3f x(1, 0, 0), y(0, 1, 0), z(0, 0, 1);
+        addFace(Base::Vector3f(0, 0, 0), y, x);
+        addFace(Base::Vector3f(0, 0, 1), x, y);
+        addFace(Base::Vector3f(0, 0, 0), x, z);
+        addFace(Base::Vector3f(0, 1, 0), z, x);
+        addFace(Base::Vector3f(0, 0, 0), z, y);
+        addFace(Base::Vector3f(1, 0, 0), y, z);
+        kernel = facets;
+    }
+
+    void TearDown() override
+    {
+        MeshCore::ParallelWriter::setMaxThreads(0);
+    }
+
+    std::string save(std::size_t threads, MeshCore::MeshIO::Format format) const
+    {
+        MeshCore::ParallelWriter::setMaxThreads(threads);
+        MeshCore::MeshOutput output(kernel);
+        std::ostringstream str;
+        EXPECT_TRUE(output.SaveFormat(str, format));
+        return str.str();
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshIOTest, TestParallelOutputMatchesSerial)
+{
+    ASSERT_GT(kernel.CountFacets(), 4U * 16384U);
+    for (auto format : {MeshCore::MeshIO::ASTL,
+                        MeshCore::MeshIO::BSTL,
+                        MeshCore::MeshIO::OBJ,
+                        MeshCore::MeshIO::APLY,
+                        MeshCore::MeshIO::PLY}) {
+        std::string serial = save(1, format);
+        std::string parallel = save(4, format);
+        EXPECT_FALSE(serial.empty());
+        EXPECT_TRUE(serial == parallel) << "format " << int(format);
+    }
+}
+
+TEST_F(MeshIOTest, TestParallelWriterKeepsOrderAcrossRounds)
+{
+    MeshCore::ParallelWriter::setMaxThreads(3);
+    std::ostringstream str;
+    std::string expected;
+    {
+        MeshCore::ParallelWriter writer(str, 7);
+        for (int pass = 0; pass < 2; pass++) {
+            writer.write(1000, [](std::string& buffer, std::size_t index) {
+                buffer.append(std::to_string(index)).append(" ");
+            });
+            for (std::size_t i = 0; i < 1000; i++) {
+                expected.append(std::to_string(i)).append(" ");
+            }
+        }
+    }
+    EXPECT_EQ(str.str(), expected);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshKernelTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a finely tessellated unit cube with enough elements to be processed on several threads
+        const int n = 150;
+        const float step = 1.0F / float(n);
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        auto addFace = [&](const Base::Vector3f& base,
+                           const Base::Vector3f& u,
+                           const Base::Vector3f& v) {
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) {
+                    Base::Vector3f p0 = base + u * (float(i) * step) + v * (float(j) * step);
+                    Base::Vector3f p1 = p0 + u * step;
+                    Base::Vector3f p2 = p1 + v * step;
+                    Base::Vector3f p3 = p0 + v * step;
+                    facets.emplace_back(p0, p1, p2);
+                    facets.emplace_back(p0, p2, p3);
+                }
+            }
+        };
+
+        Base::Vector3f x(1, 0, 0), y(0, 1, 0), z(0, 0, 1);
+        addFace(Base::Vector3f(0, 0, 0), y, x);
+        addFace(Base::Vector3f(0, 0, 1), x, y);
+        addFace(Base::Vector3f(0, 0, 0), x, z);
+        addFace(Base::Vector3f(0, 1, 0), z, x);
+        addFace(Base::Vector3f(0, 0, 0), z, y);
+        addFace(Base::Vector3f(1, 0, 0), y, z);
+        kernel = facets;
+    }
+
+    void TearDown() override
+    {}
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshKernelTest, TestSurfaceAndVolume)
+{
+    EXPECT_NEAR(kernel.GetSurface(), 6.0F, 1e-4F);
+    EXPECT_NEAR(kernel.GetVolume(), 1.0F, 1e-4F);
+
+    // same as the sum over the single facets
+    double surface = 0.0;
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        surface += it->Area();
+    }
+    EXPECT_FLOAT_EQ(kernel.GetSurface(), float(surface));
+}
+
+TEST_F(MeshKernelTest, TestVertexNormals)
+{
+    std::vector<Base::Vector3f> expected(kernel.CountPoints());
+    MeshCore::MeshFacetIterator it(kernel);
+    for (it.Init(); it.More(); it.Next()) {
+        const MeshCore::MeshGeomFacet& facet = *it;
+        Base::Vector3f normal = (facet._aclPoints[1] - facet._aclPoints[0])
+            % (facet._aclPoints[2] - facet._aclPoints[0]);
+        const MeshCore::MeshFacet& indices = kernel.GetFacets()[it.Position()];
+        for (int i = 0; i < 3; i++) {
+            expected[indices._aulPoints[i]] += normal;
+        }
+    }
+
+    // the normals are accumulated in facet order and thus must be identical
+    std::vector<Base::Vector3f> normals = kernel.CalcVertexNormals();
+    ASSERT_EQ(normals.size(), expected.size());
+    EXPECT_TRUE(normals == expected);
+}
+
+TEST_F(MeshKernelTest, TestTransform)
+{
+    Base::Matrix4D mat;
+    mat.scale(2.0, 3.0, 4.0);
+    mat.move(Base::Vector3d(1.0, -1.0, 0.5));
+    kernel.Transform(mat);
+
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 1.0F);
+    EXPECT_FLOAT_EQ(box.MinY, -1.0F);
+    EXPECT_FLOAT_EQ(box.MinZ, 0.5F);
+    EXPECT_FLOAT_EQ(box.MaxX, 3.0F);
+    EXPECT_FLOAT_EQ(box.MaxY, 2.0F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 4.5F);
+    EXPECT_NEAR(kernel.GetVolume(), 24.0F, 1e-3F);
+
+    kernel.RecalcBoundBox();
+    EXPECT_EQ(kernel.GetBoundBox().GetMinimum(), box.GetMinimum());
+    EXPECT_EQ(kernel.GetBoundBox().GetMaximum(), box.GetMaximum());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderMapped.h>
+#include <cstring>
+#include <fstream>
 #include <zipios++/fcoll.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -27,4 +30,99 @@ TEST(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+TEST(ImporterTest, TestMappedSTL)
+{
+    // a square made of two triangles, one corner is written once as -0 and once as +0
+    const float tria1[12] = {0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0};
+    const float tria2[12] = {0, 0, 1, -0.0F, 0, 0, 1, 1, 0, 0, 1, 0};
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".stl");
+    {
+        std::ofstream str(fi.filePath(), std::ios::out | std::ios::binary);
+        char header[80] {};
+        uint32_t count = 2;
+        uint16_t attr = 0;
+        str.write(header, sizeof(header));
+        str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        str.write(reinterpret_cast<const char*>(tria1), sizeof(tria1));
+        str.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+        str.write(reinterpret_cast<const char*>(tria2), sizeof(tria2));
+        str.write(reinterpret_cast<const char*>(&attr), sizeof(attr));
+    }
+
+    MeshCore::MeshKernel mesh;
+    MeshCore::ReaderMapped reader(mesh, nullptr);
+    EXPECT_EQ(reader.LoadBinarySTL(fi.filePath()), true);
+    EXPECT_EQ(mesh.CountPoints(), 4);
+    EXPECT_EQ(mesh.CountEdges(), 5);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+    fi.deleteFile();
+
+    // ASCII files are left to the stream reader
+    {
+        std::ofstream str(fi.filePath());
+        str << "solid test\n"
+            << "  facet normal 0 0 1\n"
+            << "    outer loop\n"
+            << "      vertex 0 0 0\n"
+            << "      vertex 1 0 0\n"
+            << "      vertex 1 1 0\n"
+            << "    endloop\n"
+            << "  endfacet\n"
+            << "endsolid test\n";
+    }
+    EXPECT_EQ(reader.LoadBinarySTL(fi.filePath()), false);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+    fi.deleteFile();
+}
+
+TEST(ImporterTest, TestMappedPLY)
+{
+    const float points[12] = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0};
+    auto writeFile = [&points](const std::string& fn, bool polygon) {
+        std::ofstream str(fn, std::ios::out | std::ios::binary);
+        str << "ply\n"
+            << "format binary_little_endian 1.0\n"
+            << "comment written by a test\n"
+            << "element vertex 4\n"
+            << "property float x\n"
+            << "property float y\n"
+            << "property float z\n"
+            << "element face " << (polygon ? 1 : 2) << "\n"
+            << "property list uchar int vertex_indices\n"
+            << "end_header\n";
+        str.write(reinterpret_cast<const char*>(points), sizeof(points));
+        if (polygon) {
+            const unsigned char count = 4;
+            const int32_t quad[4] = {0, 1, 2, 3};
+            str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            str.write(reinterpret_cast<const char*>(quad), sizeof(quad));
+        }
+        else {
+            const unsigned char count = 3;
+            const int32_t tria1[3] = {0, 1, 2};
+            const int32_t tria2[3] = {0, 2, 3};
+            str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            str.write(reinterpret_cast<const char*>(tria1), sizeof(tria1));
+            str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            str.write(reinterpret_cast<const char*>(tria2), sizeof(tria2));
+        }
+    };
+
+    Base::FileInfo fi(Base::FileInfo::getTempFileName() + ".ply");
+    writeFile(fi.filePath(), false);
+
+    MeshCore::MeshKernel mesh;
+    MeshCore::ReaderMapped reader(mesh, nullptr);
+    EXPECT_EQ(reader.LoadBinaryPLY(fi.filePath()), true);
+    EXPECT_EQ(mesh.CountPoints(), 4);
+    EXPECT_EQ(mesh.CountEdges(), 5);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+
+    // polygons are left to the stream reader
+    writeFile(fi.filePath(), true);
+    EXPECT_EQ(reader.LoadBinaryPLY(fi.filePath()), false);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+    fi.deleteFile();
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
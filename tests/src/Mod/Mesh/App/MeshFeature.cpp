@@ -1,6 +1,17 @@
 #include "gtest/gtest.h"
+#include <memory>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
 #include <src/App/InitApplication.h>
+#include <Mod/Mesh/App/FeatureMeshDefects.h>
+#include <Mod/Mesh/App/FeatureMeshSolid.h>
 #include <Mod/Mesh/App/MeshFeature.h>
+#include <Mod/Mesh/App/MeshProperties.h>
 
 class MeshFeatureTest: public ::testing::Test
 {
@@ -37,4 +48,193 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+
+TEST_F(MeshFeatureTest, undoCopyOfMeshIsCountedOnce)
+{
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacets(std::vector<MeshCore::MeshGeomFacet> {
+        MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                Base::Vector3f(1, 0, 0),
+                                Base::Vector3f(0, 1, 0))});
+    Mesh::PropertyMeshKernel prop;
+    prop.setValue(kernel);
+    std::size_t size = prop.getMemSize();
+    ASSERT_GT(size, 0U);
+
+    // the copy shares the mesh of the property
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    EXPECT_EQ(copy->getMemSize(), 0U);
+
+    // and gets its own one when the property is modified
+    prop.transformGeometry(Base::Matrix4D());
+    EXPECT_EQ(copy->getMemSize(), size);
+    EXPECT_EQ(prop.getMemSize(), size);
+}
+
+TEST_F(MeshFeatureTest, parallelRecompute)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelRecompute", true);
+    hGrp->SetInt("RecomputeThreads", 4);
+
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+
+    // independent branches of a cube and two chained flips that can run on worker threads
+    const int branches = 8;
+    std::vector<Mesh::Cube*> cubes;
+    std::vector<Mesh::FlipNormals*> flips;
+    std::vector<Mesh::FlipNormals*> flipsBack;
+    for (int i = 0; i < branches; i++) {
+        auto cube = dynamic_cast<Mesh::Cube*>(doc->addObject("Mesh::Cube"));
+        cube->Length.setValue(1.0 + i);
+        auto flip = dynamic_cast<Mesh::FlipNormals*>(doc->addObject("Mesh::FlipNormals"));
+        flip->Source.setValue(cube);
+        auto flipBack = dynamic_cast<Mesh::FlipNormals*>(doc->addObject("Mesh::FlipNormals"));
+        flipBack->Source.setValue(flip);
+        cubes.push_back(cube);
+        flips.push_back(flip);
+        flipsBack.push_back(flipBack);
+    }
+
+    // all notifications must arrive on this thread with the before signal first
+    std::thread::id mainThread = std::this_thread::get_id();
+    std::set<std::tuple<const App::DocumentObject*, const App::Property*>> changing;
+    bool wrongThread = false;
+    bool wrongOrder = false;
+    auto before = doc->signalBeforeChangeObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            wrongThread = wrongThread || std::this_thread::get_id() != mainThread;
+            changing.emplace(&obj, &prop);
+        });
+    auto changed = doc->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            wrongThread = wrongThread || std::this_thread::get_id() != mainThread;
+            auto flip = dynamic_cast<const Mesh::FlipNormals*>(&obj);
+            if (flip && &prop == &flip->Mesh && changing.erase({&obj, &prop}) == 0) {
+                wrongOrder = true;
+            }
+        });
+
+    // the signals of the objects themselves, e.g. used by links, as well
+    std::vector<boost::signals2::scoped_connection> objectConnections;
+    auto checkThread = [&](const App::DocumentObject& /*obj*/, const App::Property& /*prop*/) {
+        wrongThread = wrongThread || std::this_thread::get_id() != mainThread;
+    };
+    for (auto flip : flips) {
+        objectConnections.emplace_back(flip->signalBeforeChange.connect(checkThread));
+        objectConnections.emplace_back(flip->signalEarlyChanged.connect(checkThread));
+        objectConnections.emplace_back(flip->signalChanged.connect(checkThread));
+    }
+
+    int count = doc->recompute();
+    before.disconnect();
+    changed.disconnect();
+    objectConnections.clear();
+    hGrp->RemoveBool("ParallelRecompute");
+    hGrp->RemoveInt("RecomputeThreads");
+
+    EXPECT_EQ(count, 3 * branches);
+    EXPECT_FALSE(wrongThread);
+    EXPECT_FALSE(wrongOrder);
+    for (int i = 0; i < branches; i++) {
+        EXPECT_TRUE(flips[i]->isValid());
+        EXPECT_TRUE(flipsBack[i]->isValid());
+
+        const MeshCore::MeshKernel& cube = cubes[i]->Mesh.getValue().getKernel();
+        const MeshCore::MeshKernel& flip = flips[i]->Mesh.getValue().getKernel();
+        const MeshCore::MeshKernel& flipBack = flipsBack[i]->Mesh.getValue().getKernel();
+        ASSERT_EQ(flip.CountFacets(), cube.CountFacets());
+        ASSERT_EQ(flipBack.CountFacets(), cube.CountFacets());
+        Base::Vector3f normal = cube.GetFacet(0).GetNormal();
+        EXPECT_TRUE(flip.GetFacet(0).GetNormal().IsEqual(-normal, 1e-6F));
+        EXPECT_TRUE(flipBack.GetFacet(0).GetNormal().IsEqual(normal, 1e-6F));
+    }
+
+    App::GetApplication().closeDocument(docName.c_str());
+}
+
+TEST_F(MeshFeatureTest, parallelRecomputeKeepsDependentsOfFailureTouched)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelRecompute", true);
+    hGrp->SetInt("RecomputeThreads", 4);
+
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+
+    // the flips depend on a feature that fails
+    auto failing = doc->addObject("App::FeatureTestException");
+    auto flip = dynamic_cast<Mesh::FlipNormals*>(doc->addObject("Mesh::FlipNormals"));
+    flip->Source.setValue(failing);
+    auto flipBack = dynamic_cast<Mesh::FlipNormals*>(doc->addObject("Mesh::FlipNormals"));
+    flipBack->Source.setValue(flip);
+
+    std::set<const App::DocumentObject*> recomputed;
+    auto connection = doc->signalRecomputedObject.connect([&](const App::DocumentObject& obj) {
+        recomputed.insert(&obj);
+    });
+
+    bool hasError = false;
+    doc->recompute({}, false, &hasError);
+    connection.disconnect();
+    hGrp->RemoveBool("ParallelRecompute");
+    hGrp->RemoveInt("RecomputeThreads");
+
+    // like the serial recompute the dependents are neither recomputed nor cleaned
+    EXPECT_TRUE(hasError);
+    EXPECT_EQ(recomputed.count(flip), 0);
+    EXPECT_EQ(recomputed.count(flipBack), 0);
+    EXPECT_TRUE(flip->isTouched());
+    EXPECT_TRUE(flipBack->isTouched());
+
+    App::GetApplication().closeDocument(docName.c_str());
+}
+
+TEST_F(MeshFeatureTest, saveAndRestoreWithParallelCompression)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    hGrp->SetBool("ParallelCompression", true);
+    hGrp->SetInt("CompressionThreads", 4);
+
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+
+    // enough mesh files to keep all workers busy
+    const int count = 12;
+    std::vector<std::string> names;
+    std::vector<unsigned long> facets;
+    for (int i = 0; i < count; i++) {
+        auto cube = dynamic_cast<Mesh::Cube*>(doc->addObject("Mesh::Cube"));
+        cube->Length.setValue(1.0 + i);
+        names.emplace_back(cube->getNameInDocument());
+    }
+    doc->recompute();
+    for (const auto& name : names) {
+        auto cube = dynamic_cast<Mesh::Feature*>(doc->getObject(name.c_str()));
+        facets.push_back(cube->Mesh.getValue().countFacets());
+    }
+
+    std::string fileName = Base::FileInfo::getTempFileName() + ".FCStd";
+    EXPECT_TRUE(doc->saveAs(fileName.c_str()));
+    App::GetApplication().closeDocument(doc->getName());
+
+    doc = App::GetApplication().openDocument(fileName.c_str(), false);
+    ASSERT_TRUE(doc);
+    for (int i = 0; i < count; i++) {
+        auto cube = dynamic_cast<Mesh::Feature*>(doc->getObject(names[i].c_str()));
+        ASSERT_TRUE(cube);
+        const Mesh::MeshObject& mesh = cube->Mesh.getValue();
+        EXPECT_EQ(mesh.countFacets(), facets[i]);
+        EXPECT_FLOAT_EQ(mesh.getKernel().GetBoundBox().LengthX(), 1.0F + float(i));
+    }
+
+    App::GetApplication().closeDocument(doc->getName());
+    hGrp->RemoveBool("ParallelCompression");
+    hGrp->RemoveInt("CompressionThreads");
+    Base::FileInfo(fileName).deleteFile();
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,7 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <gp_Trsf.hxx>
+#include <TopLoc_Location.hxx>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
@@ -269,3 +278,84 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testSharedFileKeepsLocation)
+{
+    // Arrange: the same shape at two places
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    PropertyPartShape first;
+    PropertyPartShape second;
+    first.setValue(box);
+    second.setValue(box.Moved(TopLoc_Location(move)));
+    std::stringstream stream;
+    {
+        Base::ZipWriter writer(stream);
+        writer.setMode("DeduplicateFiles");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>\n<Document>\n";
+        first.Save(writer);
+        second.Save(writer);
+        writer.Stream() << "</Document>\n";
+        writer.writeFiles();
+    }
+
+    // Act
+    PropertyPartShape restoredFirst;
+    PropertyPartShape restoredSecond;
+    zipios::ZipInputStream zip(stream);
+    Base::XMLReader reader("Document.xml", zip);
+    reader.readElement("Document");
+    restoredFirst.Restore(reader);
+    restoredSecond.Restore(reader);
+    reader.readFiles(zip);
+
+    // Assert: both share the file and the TShape, but keep their location
+    ASSERT_EQ(reader.FileList.size(), 2);
+    EXPECT_EQ(reader.FileList[0].FileName, reader.FileList[1].FileName);
+    EXPECT_TRUE(restoredFirst.getValue().IsPartner(restoredSecond.getValue()));
+    EXPECT_TRUE(restoredFirst.getValue().Location().IsIdentity());
+    EXPECT_DOUBLE_EQ(restoredSecond.getTransform()[0][3], 10.0);
+    EXPECT_DOUBLE_EQ(getVolume(restoredSecond.getValue()), 6.0);
+}
+
+TEST_F(PropertyTopoShapeTest, testUniqueFileKeepsLocation)
+{
+    // Arrange: a placed shape that shares its file with no other
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    PropertyPartShape prop;
+    prop.setValue(box.Moved(TopLoc_Location(move)));
+    std::stringstream stream;
+    {
+        Base::ZipWriter writer(stream);
+        writer.setMode("DeduplicateFiles");
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>\n<Document>\n";
+        prop.Save(writer);
+        writer.Stream() << "</Document>\n";
+        writer.writeFiles();
+    }
+
+    // Act: read the file like versions that ignore the Location attribute
+    zipios::ZipInputStream zip(stream);
+    Base::XMLReader reader("Document.xml", zip);
+    reader.readElement("Document");
+    reader.readElement("Part");
+    ASSERT_TRUE(reader.hasAttribute("file"));
+    std::string file = reader.getAttribute("file");
+    zipios::ConstEntryPointer entry = zip.getNextEntry();
+    while (entry->isValid() && entry->getName() != file) {
+        entry = zip.getNextEntry();
+    }
+    ASSERT_TRUE(entry->isValid());
+    TopoDS_Shape shape;
+    BRep_Builder builder;
+    BRepTools::Read(shape, zip, builder);
+
+    // Assert: the file still has the location
+    ASSERT_FALSE(shape.IsNull());
+    EXPECT_DOUBLE_EQ(shape.Location().Transformation().TranslationPart().X(), 10.0);
+}
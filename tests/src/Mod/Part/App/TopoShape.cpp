@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include "PartTestHelpers.h"
 #include <Mod/Part/App/TopoShape.h>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <sstream>
 #include "src/App/InitApplication.h"
 
 
@@ -136,4 +139,32 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestExportTriangulation)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    BRepMesh_IncrementalMesh(cube1.getShape(), 0.1);
+    auto hasTriangulation = [](const Part::TopoShape& shape) {
+        TopLoc_Location loc;
+        return !BRep_Tool::Triangulation(TopoDS::Face(shape.getSubShape("Face1")), loc).IsNull();
+    };
+    ASSERT_TRUE(hasTriangulation(cube1));
+    std::stringstream brepWith, brepWithout, binWith, binWithout;
+    Part::TopoShape fromBrepWith, fromBrepWithout, fromBinWith, fromBinWithout;
+    // Act
+    cube1.exportBrep(brepWith, true);
+    cube1.exportBrep(brepWithout);
+    cube1.exportBinary(binWith, true);
+    cube1.exportBinary(binWithout);
+    fromBrepWith.importBrep(brepWith);
+    fromBrepWithout.importBrep(brepWithout);
+    fromBinWith.importBinary(binWith);
+    fromBinWithout.importBinary(binWithout);
+    // Assert
+    EXPECT_TRUE(hasTriangulation(fromBrepWith));
+    EXPECT_FALSE(hasTriangulation(fromBrepWithout));
+    EXPECT_TRUE(hasTriangulation(fromBinWith));
+    EXPECT_FALSE(hasTriangulation(fromBinWithout));
+}
+
 // clang-format on
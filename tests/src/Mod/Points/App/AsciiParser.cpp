@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Base/Exception.h>
+#include <Mod/Points/App/AsciiParser.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+double parse(const char* text)
+{
+    double value = 0;
+    const char* end = text + std::strlen(text);
+    EXPECT_EQ(Points::AsciiParser::parseNumber(text, end, value), end) << text;
+    return value;
+}
+}  // namespace
+
+TEST(AsciiParser, TestNumbers)
+{
+    EXPECT_DOUBLE_EQ(parse("0"), 0.0);
+    EXPECT_DOUBLE_EQ(parse("-1.5"), -1.5);
+    EXPECT_DOUBLE_EQ(parse("+.25"), 0.25);
+    EXPECT_DOUBLE_EQ(parse("3."), 3.0);
+    EXPECT_DOUBLE_EQ(parse("1.25e3"), 1250.0);
+    EXPECT_DOUBLE_EQ(parse("-2E-2"), -0.02);
+    EXPECT_EQ(parse("0.1"), 0.1);
+    EXPECT_EQ(parse("1e23"), 1e23);
+    EXPECT_EQ(parse("3.14159265358979323846"), 3.14159265358979323846);
+    EXPECT_EQ(parse("4278190080"), 4278190080.0);
+}
+
+TEST(AsciiParser, TestInvalidNumbers)
+{
+    double value = 0;
+    for (const char* text : {"", "-", ".", "e5", "1e", "1e+", "#"}) {
+        const char* end = text + std::strlen(text);
+        const char* last = Points::AsciiParser::parseNumber(text, end, value);
+        EXPECT_TRUE(last == nullptr || last != end) << text;
+    }
+}
+
+TEST(AsciiParser, TestSkipInvalidLines)
+{
+    std::string text = "# ASCII\n\n1 2 3\r\n4,5,6,7\n  \n8 9\n10 11 12 x\n13\t14 15";
+    Points::AsciiParser parser(text.data(), text.size());
+    EXPECT_EQ(parser.countColumns(3), 3);
+    EXPECT_EQ(parser.parse(3, 3, Points::AsciiParser::Mode::Skip), 3);
+
+    std::vector<double> values(9);
+    parser.forEachRow([&values](std::size_t row, const double* data) {
+        std::copy(data, data + 3, values.begin() + 3 * row);
+    });
+    EXPECT_EQ(values, std::vector<double>({1, 2, 3, 4, 5, 6, 13, 14, 15}));
+}
+
+TEST(AsciiParser, TestStrictInvalidLine)
+{
+    std::string text = "1 2 3\nx y z\n";
+    Points::AsciiParser parser(text.data(), text.size());
+    EXPECT_THROW(parser.parse(3), Base::BadFormatError);
+    // the invalid line is behind the requested rows
+    EXPECT_EQ(parser.parse(3, 1, Points::AsciiParser::Mode::Strict, 1), 1);
+}
+
+TEST(AsciiParser, TestStream)
+{
+    std::istringstream str("header\n1 2\n\n3\n4 5 6\n");
+    std::string line;
+    std::getline(str, line);
+
+    Points::AsciiParser parser(str);
+    parser.skipLines(1);
+    EXPECT_EQ(parser.parse(2), 2);
+
+    std::vector<double> values(4);
+    parser.forEachRow([&values](std::size_t row, const double* data) {
+        std::copy(data, data + 2, values.begin() + 2 * row);
+    });
+    EXPECT_EQ(values, std::vector<double>({3, 0, 4, 5}));
+}
+
+TEST(AsciiParser, TestBlocks)
+{
+    std::string text = "1 2\n3 4\n5 6\n7 8\n";
+    Points::AsciiParser parser(text.data(), text.size());
+
+    std::vector<double> values;
+    while (parser.parseNext(5, 2)) {
+        EXPECT_LE(parser.size(), 2);
+        parser.forEachRow([&values](std::size_t, const double* data) {
+            values.push_back(data[0]);
+        });
+    }
+    EXPECT_EQ(values, std::vector<double>({1, 3, 5, 7}));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Points/App/PagedPointKernel.h>
+#include <Mod/Points/App/PointsAlgos.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PagedPointKernelTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-10.0F, 10.0F);
+        for (int i = 0; i < 20000; i++) {
+            points.emplace_back(dist(gen), dist(gen), 0.1F * dist(gen));
+        }
+
+        dir.setFile(Base::FileInfo::getTempFileName("PagedPoints"));
+    }
+
+    void TearDown() override
+    {
+        dir.deleteDirectoryRecursive();
+    }
+
+    static bool lessThan(const Base::Vector3f& v1, const Base::Vector3f& v2)
+    {
+        return std::tie(v1.x, v1.y, v1.z) < std::tie(v2.x, v2.y, v2.z);
+    }
+
+    std::vector<Base::Vector3f> points;
+    Base::FileInfo dir;
+};
+
+TEST_F(PagedPointKernelTest, TestBuild)
+{
+    Points::PagedPointKernel kernel(dir.filePath(), 1000);
+    kernel.append(points.data(), 5000);
+    kernel.append(points.data() + 5000, points.size() - 5000);
+    EXPECT_FALSE(kernel.isBuilt());
+    kernel.build();
+
+    EXPECT_TRUE(kernel.isBuilt());
+    EXPECT_EQ(kernel.size(), points.size());
+    EXPECT_GT(kernel.countNodes(), 8);
+    EXPECT_GT(kernel.getMaxDepth(), 0);
+    EXPECT_THROW(kernel.append(points), Base::RuntimeError);
+
+    // all points are stored exactly once
+    std::vector<Base::Vector3f> stored;
+    kernel.forEachPage([&stored](const Base::Vector3f* data, std::size_t count) {
+        EXPECT_LE(count, 1000);
+        stored.insert(stored.end(), data, data + count);
+    });
+    std::sort(stored.begin(), stored.end(), lessThan);
+    std::vector<Base::Vector3f> sorted = points;
+    std::sort(sorted.begin(), sorted.end(), lessThan);
+    EXPECT_EQ(stored, sorted);
+}
+
+TEST_F(PagedPointKernelTest, TestRandomAccess)
+{
+    Points::PagedPointKernel kernel(dir.filePath(), 1000);
+    kernel.append(points);
+    kernel.build();
+
+    std::vector<Base::Vector3f> stored;
+    kernel.forEachPage([&stored](const Base::Vector3f* data, std::size_t count) {
+        stored.insert(stored.end(), data, data + count);
+    });
+    for (std::size_t i = 0; i < stored.size(); i += 7) {
+        EXPECT_EQ(kernel.getPoint(i), stored[i]);
+    }
+    EXPECT_THROW(kernel.getPoint(points.size()), Base::IndexError);
+}
+
+TEST_F(PagedPointKernelTest, TestLevelOfDetail)
+{
+    Points::PagedPointKernel kernel(dir.filePath(), 1000);
+    kernel.append(points);
+    kernel.build();
+
+    std::vector<Base::Vector3f> lod = kernel.getLevelOfDetail(5000);
+    EXPECT_GT(lod.size(), 0);
+    EXPECT_LE(lod.size(), 5000);
+    EXPECT_EQ(kernel.getLevelOfDetail(points.size()).size(), points.size());
+    EXPECT_LE(kernel.getLevelOfDetail(10).size(), 10);
+
+    // the coarse level covers the whole cloud
+    Base::BoundBox3f box;
+    for (const auto& pnt : lod) {
+        box.Add(pnt);
+    }
+    EXPECT_GT(box.LengthX(), 0.9F * kernel.getBoundBox().LengthX());
+    EXPECT_GT(box.LengthY(), 0.9F * kernel.getBoundBox().LengthY());
+
+    Base::BoundBox3f region(0.0F, 0.0F, -1.0F, 5.0F, 5.0F, 1.0F);
+    std::vector<Base::Vector3f> part = kernel.getLevelOfDetail(region, points.size());
+    std::size_t inside = std::count_if(points.begin(), points.end(), [&region](const auto& pnt) {
+        return region.IsInBox(pnt);
+    });
+    EXPECT_EQ(part.size(), inside);
+}
+
+TEST_F(PagedPointKernelTest, TestReopen)
+{
+    std::vector<Base::Vector3f> stored;
+    {
+        Points::PagedPointKernel kernel(dir.filePath(), 1000);
+        kernel.append(points);
+        kernel.build();
+        stored = kernel.getLevelOfDetail(3000);
+    }
+
+    Points::PagedPointKernel kernel(dir.filePath());
+    EXPECT_TRUE(kernel.isBuilt());
+    EXPECT_EQ(kernel.size(), points.size());
+    EXPECT_EQ(kernel.getLevelOfDetail(3000), stored);
+}
+
+TEST_F(PagedPointKernelTest, TestImportPLY)
+{
+    Points::PointKernel cloud;
+    cloud.setBasicPoints(points);
+    std::string name = Base::FileInfo::getTempFileName() + ".ply";
+    Points::PlyWriter writer(cloud);
+    writer.write(name);
+
+    Points::PagedPointKernel kernel(dir.filePath(), 1000);
+    Points::PlyReader reader;
+    reader.read(name, kernel);
+    kernel.build();
+    Base::FileInfo(name).deleteFile();
+
+    EXPECT_EQ(kernel.size(), points.size());
+    Base::BoundBox3d box = cloud.getBoundBox();
+    EXPECT_FLOAT_EQ(kernel.getBoundBox().MinX, float(box.MinX));
+    EXPECT_FLOAT_EQ(kernel.getBoundBox().MaxZ, float(box.MaxZ));
+}
+
+TEST_F(PagedPointKernelTest, TestEmpty)
+{
+    Points::PagedPointKernel kernel(dir.filePath());
+    kernel.build();
+    EXPECT_TRUE(kernel.isBuilt());
+    EXPECT_EQ(kernel.size(), 0);
+    EXPECT_TRUE(kernel.getLevelOfDetail(100).empty());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
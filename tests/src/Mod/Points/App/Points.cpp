@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <Base/FileInfo.h>
+#include <Base/Stream.h>
 #include <Mod/Points/App/Points.h>
 #include <Mod/Points/App/PointsAlgos.h>
 
@@ -138,6 +139,29 @@ TEST_F(PointsTest, TestASCII)
     EXPECT_EQ(reader.getHeight(), 1);
 }
 
+TEST_F(PointsTest, TestASCIIWithColumns)
+{
+    std::string name = getFileName() + ".asc";
+    {
+        Base::ofstream str(Base::FileInfo(name), std::ios::out);
+        str << "# x y z r g b\n";
+        str << "0 0 0 255 0 0\n";
+        str << "1.5 0 0 0 255 0\n";
+        str << "0 1.5e0 -2 0 0 255\n";
+    }
+
+    Points::AscReader reader;
+    reader.read(name);
+
+    EXPECT_TRUE(reader.hasColors());
+    EXPECT_FALSE(reader.hasNormals());
+    EXPECT_FALSE(reader.hasIntensities());
+    EXPECT_EQ(reader.getWidth(), 3);
+    EXPECT_EQ(reader.getPoints().getPoint(2), Base::Vector3d(0, 1.5, -2));
+    EXPECT_FLOAT_EQ(reader.getColors()[1].g, 1.0F);
+    Base::FileInfo(name).deleteFile();
+}
+
 TEST_F(PointsTest, TestPlainPLY)
 {
     std::string name = getFileName();
@@ -1,5 +1,14 @@
 #include "gtest/gtest.h"
+#include <random>
+#include <string>
+#include <vector>
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
 #include <src/App/InitApplication.h>
+#include <Mod/Points/App/PagedFeature.h>
+#include <Mod/Points/App/PagedPointKernel.h>
 #include <Mod/Points/App/PointsFeature.h>
 
 class PointsFeatureTest: public ::testing::Test
@@ -8,6 +17,7 @@ protected:
     static void SetUpTestSuite()
     {
         tests::initApplication();
+        Base::Interpreter().runString("import Points");
     }
 
     void SetUp() override
@@ -33,4 +43,49 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, pagedFeature)
+{
+    Base::FileInfo dir(Base::FileInfo::getTempFileName("PagedPoints"));
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-10.0F, 10.0F);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 20000; i++) {
+            points.emplace_back(dist(gen), dist(gen), dist(gen));
+        }
+
+        Points::PagedPointKernel kernel(dir.filePath(), 1000);
+        kernel.append(points);
+        kernel.build();
+    }
+
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    auto paged = dynamic_cast<Points::PagedFeature*>(doc->addObject("Points::PagedFeature"));
+    ASSERT_NE(paged, nullptr);
+
+    // without a cache the feature fails
+    doc->recompute();
+    EXPECT_TRUE(paged->isError());
+    EXPECT_EQ(paged->getKernel(), nullptr);
+
+    paged->CacheDirectory.setValue(dir.filePath().c_str());
+    paged->MaxPoints.setValue(5000);
+    doc->recompute();
+    EXPECT_FALSE(paged->isError());
+    ASSERT_NE(paged->getKernel(), nullptr);
+    EXPECT_EQ(paged->getKernel()->size(), 20000);
+    std::size_t count = paged->Points.getValue().size();
+    EXPECT_GT(count, 0);
+    EXPECT_LE(count, 5000);
+
+    // a larger limit loads more points
+    paged->MaxPoints.setValue(20000);
+    doc->recompute();
+    EXPECT_EQ(paged->Points.getValue().size(), 20000);
+
+    App::GetApplication().closeDocument(docName.c_str());
+    dir.deleteDirectoryRecursive();
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
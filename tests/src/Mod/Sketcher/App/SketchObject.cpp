@@ -1236,6 +1236,55 @@ TEST_F(SketchObjectTest, testReverseAngleConstraintToSupplementaryExpressionAppl
     EXPECT_EQ(std::string("32 °"), getObject()->getConstraintExpression(id));
 }
 
+TEST_F(SketchObjectTest, testDatumChangeMakesConstraintRedundant)
+{
+    // Arrange: a line of fixed length from the root point through a point whose coordinates are
+    // set by datums. If the point is moved onto the root point the line can rotate and the point
+    // on object constraint becomes redundant.
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(6.0, 8.0, 0.0));
+    int lineId = getObject()->addGeometry(&line);
+    Part::GeomPoint point(Base::Vector3d(3.0, 4.0, 0.0));
+    int pointId = getObject()->addGeometry(&point);
+
+    auto addConstraint = [this](Sketcher::ConstraintType type,
+                                int first,
+                                Sketcher::PointPos firstPos,
+                                int second,
+                                Sketcher::PointPos secondPos,
+                                double value) {
+        auto constraint = std::make_unique<Sketcher::Constraint>();
+        constraint->Type = type;
+        constraint->First = first;
+        constraint->FirstPos = firstPos;
+        constraint->Second = second;
+        constraint->SecondPos = secondPos;
+        constraint->setValue(value);
+        return getObject()->addConstraint(std::move(constraint));
+    };
+    const auto none = Sketcher::PointPos::none;
+    const auto start = Sketcher::PointPos::start;
+    const auto undef = Sketcher::GeoEnum::GeoUndef;
+    addConstraint(Sketcher::Coincident, lineId, start, Sketcher::GeoEnum::RtPnt, start, 0.0);
+    int distanceX = addConstraint(Sketcher::DistanceX, pointId, start, undef, none, 3.0);
+    int distanceY = addConstraint(Sketcher::DistanceY, pointId, start, undef, none, 4.0);
+    addConstraint(Sketcher::PointOnObject, pointId, start, lineId, none, 0.0);
+    addConstraint(Sketcher::Distance, lineId, none, undef, none, 10.0);
+    EXPECT_EQ(getObject()->solve(), 0);
+    EXPECT_EQ(getObject()->getLastDoF(), 0);
+
+    // Act: the structure of the sketch stays the same, so that the diagnosis is reused
+    getObject()->setDatum(distanceX, 0.0);
+    int dofsOnAxis = getObject()->getLastDoF();
+    getObject()->setDatum(distanceY, 0.0);
+
+    // Assert
+    EXPECT_EQ(dofsOnAxis, 0);
+    EXPECT_EQ(getObject()->getLastDoF(), 1);
+    EXPECT_TRUE(getObject()->getLastHasRedundancies()
+                || getObject()->getLastHasPartialRedundancies());
+}
+
 TEST_F(SketchObjectTest, testGetElementName)
 {
     // Arrange
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include "Mod/Sketcher/App/planegcs/GCS.h"
 
 class SystemTest: public GCS::System
@@ -50,3 +52,295 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, transferDiagnosis)  // NOLINT
+{
+    // Arrange
+    auto setUp = [](GCS::System& system, std::vector<double>& values, bool withDistance) {
+        values = {0.0, 0.0, 3.0, 1.0, 5.0};
+        GCS::Point p1 {&values[0], &values[1]};
+        GCS::Point p2 {&values[2], &values[3]};
+        system.addConstraintHorizontal(p1, p2, 1);
+        if (withDistance) {
+            system.addConstraintP2PDistance(p1, p2, &values[4], 2);
+        }
+        GCS::VEC_pD unknowns {&values[0], &values[1], &values[2], &values[3]};
+        system.declareUnknowns(unknowns);
+    };
+
+    std::vector<double> values;
+    setUp(*System(), values, true);
+    System()->initSolution();
+    GCS::System::Diagnosis diagnosis;
+
+    // Act
+    bool hasDiagnosis = System()->getDiagnosis(diagnosis);
+
+    GCS::System sameStructure;
+    std::vector<double> sameValues;
+    setUp(sameStructure, sameValues, true);
+    sameValues[4] = 8.0;
+    bool transferred = sameStructure.setDiagnosis(diagnosis);
+    sameStructure.initSolution();
+    int result = sameStructure.solve();
+
+    GCS::System otherStructure;
+    std::vector<double> otherValues;
+    setUp(otherStructure, otherValues, false);
+    bool transferredOther = otherStructure.setDiagnosis(diagnosis);
+
+    // Assert
+    EXPECT_TRUE(hasDiagnosis);
+    EXPECT_EQ(System()->dofsNumber(), 2);
+    EXPECT_TRUE(transferred);
+    EXPECT_EQ(sameStructure.dofsNumber(), 2);
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_FALSE(transferredOther);
+    EXPECT_EQ(otherStructure.dofsNumber(), -1);
+}
+
+TEST_F(GCSTest, verifyTransferredDiagnosisRank)  // NOLINT
+{
+    // Arrange: a line of fixed length from the origin through a point whose coordinates are
+    // datums. If both datums are zero the point is at the start of the line, so that the
+    // point-on-line constraint becomes redundant and the line can rotate.
+    auto setUp = [](GCS::System& system, std::vector<double>& values) {
+        values = {1.0, -1.0, 6.0, 8.0, 3.0, 4.0, 0.0, 3.0, 4.0, 10.0};
+        GCS::Point start {&values[0], &values[1]};
+        GCS::Point end {&values[2], &values[3]};
+        GCS::Point point {&values[4], &values[5]};
+        system.addConstraintCoordinateX(start, &values[6], 1);
+        system.addConstraintCoordinateY(start, &values[6], 2);
+        system.addConstraintCoordinateX(point, &values[7], 3);
+        system.addConstraintCoordinateY(point, &values[8], 4);
+        system.addConstraintPointOnLine(point, start, end, 5);
+        system.addConstraintP2PDistance(start, end, &values[9], 6);
+        GCS::VEC_pD unknowns;
+        for (int i = 0; i < 6; i++) {
+            unknowns.push_back(&values[i]);
+        }
+        system.declareUnknowns(unknowns);
+    };
+
+    std::vector<double> values;
+    setUp(*System(), values);
+    System()->initSolution();
+    GCS::System::Diagnosis diagnosis;
+    System()->getDiagnosis(diagnosis);
+
+    // Act
+    GCS::System changedDatums;
+    std::vector<double> changedValues;
+    setUp(changedDatums, changedValues);
+    changedValues[7] = 0.0;
+    changedValues[8] = 0.0;
+    bool transferred = changedDatums.setDiagnosis(diagnosis);
+    changedDatums.initSolution();
+    int result = changedDatums.solve();
+    changedDatums.applySolution();
+    bool rankValid = changedDatums.isDiagnosisRankValid();
+
+    changedDatums.invalidatedDiagnosis();
+    changedDatums.initSolution();
+
+    // Assert
+    EXPECT_EQ(System()->dofsNumber(), 0);
+    EXPECT_TRUE(System()->isDiagnosisRankValid());
+    EXPECT_TRUE(transferred);
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_FALSE(rankValid);
+    EXPECT_EQ(changedDatums.dofsNumber(), 1);
+    EXPECT_TRUE(changedDatums.isDiagnosisRankValid());
+}
+
+namespace
+{
+
+// Adds a staircase of points with unit steps starting at the origin, which is fully constrained.
+// values must provide 2 * numPoints + 2 entries, tags are taken from tag on.
+void addStaircase(GCS::System& system,
+                  double* values,
+                  int numPoints,
+                  int tag,
+                  std::vector<GCS::Point>& points,
+                  GCS::VEC_pD& unknowns)
+{
+    double* distance = &values[2 * numPoints];
+    double* origin = &values[2 * numPoints + 1];
+    *distance = 1.0;
+    *origin = 0.0;
+    std::size_t first = points.size();
+    for (int i = 0; i < numPoints; i++) {
+        values[2 * i] = 0.5 * i + 0.1 * (i % 3);
+        values[2 * i + 1] = 0.5 * i - 0.1 * (i % 2);
+        points.emplace_back(&values[2 * i], &values[2 * i + 1]);
+        unknowns.push_back(&values[2 * i]);
+        unknowns.push_back(&values[2 * i + 1]);
+    }
+    system.addConstraintCoordinateX(points[first], origin, tag++);
+    system.addConstraintCoordinateY(points[first], origin, tag++);
+    for (int i = 1; i < numPoints; i++) {
+        GCS::Point& p1 = points[first + i - 1];
+        GCS::Point& p2 = points[first + i];
+        system.addConstraintP2PDistance(p1, p2, distance, tag++);
+        if (i % 2) {
+            system.addConstraintHorizontal(p1, p2, tag++);
+        }
+        else {
+            system.addConstraintVertical(p1, p2, tag++);
+        }
+    }
+}
+
+// Checks that values hold a solved staircase, which starts at the origin if checkOrigin is set
+void checkStaircase(const double* values, int numPoints, bool checkOrigin = true)
+{
+    if (checkOrigin) {
+        EXPECT_NEAR(values[0], 0.0, 1e-8);
+        EXPECT_NEAR(values[1], 0.0, 1e-8);
+    }
+    for (int i = 1; i < numPoints; i++) {
+        double dx = values[2 * i] - values[2 * i - 2];
+        double dy = values[2 * i + 1] - values[2 * i - 1];
+        EXPECT_NEAR(dx * dx + dy * dy, 1.0, 1e-8);
+        EXPECT_NEAR(i % 2 ? dy : dx, 0.0, 1e-8);
+    }
+}
+
+}  // namespace
+
+TEST_F(GCSTest, solveWithSparseMatrices)  // NOLINT
+{
+    const int numPoints {50};
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto matrix : {GCS::EigenDenseMatrix, GCS::EigenSparseMatrix}) {
+            // Arrange
+            GCS::System system;
+            system.solverMatrix = matrix;
+            std::vector<double> values(2 * numPoints + 2);
+            std::vector<GCS::Point> points;
+            GCS::VEC_pD unknowns;
+            addStaircase(system, values.data(), numPoints, 1, points, unknowns);
+
+            // Act
+            int result = system.solve(unknowns, true, alg);
+            system.applySolution();
+
+            // Assert
+            EXPECT_EQ(result, GCS::Success);
+            EXPECT_EQ(system.dofsNumber(), 0);
+            checkStaircase(values.data(), numPoints);
+        }
+    }
+}
+
+TEST_F(GCSTest, solveUnderconstrainedWithSparseMatrices)  // NOLINT
+{
+    const int numPoints {50};
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto matrix : {GCS::EigenDenseMatrix, GCS::EigenSparseMatrix}) {
+            // Arrange: the staircase may slide along the y-axis
+            GCS::System system;
+            system.solverMatrix = matrix;
+            std::vector<double> values(2 * numPoints + 2);
+            std::vector<GCS::Point> points;
+            GCS::VEC_pD unknowns;
+            addStaircase(system, values.data(), numPoints, 1, points, unknowns);
+            system.clearByTag(2);
+
+            // Act
+            int result = system.solve(unknowns, true, alg);
+            system.applySolution();
+
+            // Assert
+            EXPECT_EQ(result, GCS::Success);
+            EXPECT_EQ(system.dofsNumber(), 1);
+            EXPECT_NEAR(values[0], 0.0, 1e-8);
+            checkStaircase(values.data(), numPoints, false);
+        }
+    }
+}
+
+TEST_F(GCSTest, solveOverconstrainedWithSparseMatrices)  // NOLINT
+{
+    const int numPoints {50};
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto matrix : {GCS::EigenDenseMatrix, GCS::EigenSparseMatrix}) {
+            // Arrange: the diagonal of the first step is redundant but consistent
+            GCS::System system;
+            system.solverMatrix = matrix;
+            std::vector<double> values(2 * numPoints + 2);
+            std::vector<GCS::Point> points;
+            GCS::VEC_pD unknowns;
+            addStaircase(system, values.data(), numPoints, 1, points, unknowns);
+            double diagonal = std::sqrt(2.0);
+            system.addConstraintP2PDistance(points[0], points[2], &diagonal, 2 * numPoints);
+
+            // Act
+            int result = system.solve(unknowns, true, alg);
+            system.applySolution();
+
+            // Assert: the redundant constraint is verified before the solution is applied to
+            // the reduced parameters, so the solver may only report convergence
+            EXPECT_NE(result, GCS::Failed);
+            EXPECT_EQ(system.dofsNumber(), 0);
+            EXPECT_FALSE(system.hasConflicting());
+            EXPECT_TRUE(system.hasRedundant());
+            checkStaircase(values.data(), numPoints);
+            double dx = values[4] - values[0];
+            double dy = values[5] - values[1];
+            EXPECT_NEAR(dx * dx + dy * dy, 2.0, 1e-8);
+        }
+    }
+}
+
+TEST_F(GCSTest, solveConflictingWithSparseMatrices)  // NOLINT
+{
+    const int numPoints {50};
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        for (auto matrix : {GCS::EigenDenseMatrix, GCS::EigenSparseMatrix}) {
+            // Arrange: the diagonal of the first step contradicts the staircase
+            GCS::System system;
+            system.solverMatrix = matrix;
+            std::vector<double> values(2 * numPoints + 2);
+            std::vector<GCS::Point> points;
+            GCS::VEC_pD unknowns;
+            addStaircase(system, values.data(), numPoints, 1, points, unknowns);
+            double diagonal = 5.0;
+            system.addConstraintP2PDistance(points[0], points[2], &diagonal, 2 * numPoints);
+
+            // Act
+            int result = system.solve(unknowns, true, alg);
+
+            // Assert
+            EXPECT_NE(result, GCS::Success);
+            EXPECT_TRUE(system.hasConflicting());
+        }
+    }
+}
+
+TEST_F(GCSTest, solveIndependentComponents)  // NOLINT
+{
+    // Arrange: enough decoupled staircases to be solved concurrently
+    const int numPoints {20};
+    const int numStaircases {12};
+    const int stride {2 * numPoints + 2};
+    std::vector<double> values(numStaircases * stride);
+    std::vector<GCS::Point> points;
+    points.reserve(numStaircases * numPoints);
+    GCS::VEC_pD unknowns;
+    for (int i = 0; i < numStaircases; i++) {
+        addStaircase(*System(), &values[i * stride], numPoints, 1 + i * stride, points, unknowns);
+    }
+
+    // Act
+    int result = System()->solve(unknowns);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(result, GCS::Success);
+    EXPECT_EQ(System()->dofsNumber(), 0);
+    for (int i = 0; i < numStaircases; i++) {
+        checkStaircase(&values[i * stride], numPoints);
+    }
+}
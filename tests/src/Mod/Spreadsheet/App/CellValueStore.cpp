@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include <Base/Unit.h>
+#include <Mod/Spreadsheet/App/CellValueStore.h>
+
+using Spreadsheet::CellValueStore;
+
+TEST(CellValueStore, getMissingCell)  // NOLINT
+{
+    CellValueStore store;
+    double value = 1.0;
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(3, 2), value, unit), CellValueStore::None);
+    EXPECT_EQ(value, 1.0);
+    EXPECT_EQ(store.size(), 0U);
+}
+
+TEST(CellValueStore, setAndGet)  // NOLINT
+{
+    CellValueStore store;
+    store.set(App::CellAddress(0, 0), CellValueStore::Integer, 42.0);
+    store.set(App::CellAddress(10, 3), CellValueStore::Float, 1.5);
+    store.set(App::CellAddress(4, 3), CellValueStore::Quantity, 2.0, Base::Unit::Length);
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(0, 0), value, unit), CellValueStore::Integer);
+    EXPECT_EQ(value, 42.0);
+    EXPECT_EQ(store.get(App::CellAddress(10, 3), value, unit), CellValueStore::Float);
+    EXPECT_EQ(value, 1.5);
+    EXPECT_EQ(store.get(App::CellAddress(4, 3), value, unit), CellValueStore::Quantity);
+    EXPECT_EQ(value, 2.0);
+    EXPECT_EQ(unit, Base::Unit::Length);
+    EXPECT_EQ(store.get(App::CellAddress(5, 3), value, unit), CellValueStore::None);
+    EXPECT_EQ(store.size(), 3U);
+}
+
+TEST(CellValueStore, integerIsExact)  // NOLINT
+{
+    // Not representable as a double where long has 64 bits
+    const long large = std::numeric_limits<long>::max();
+    CellValueStore store;
+    store.setInteger(App::CellAddress(2, 0), large);
+
+    long integer {};
+    EXPECT_TRUE(store.getInteger(App::CellAddress(2, 0), integer));
+    EXPECT_EQ(integer, large);
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(2, 0), value, unit), CellValueStore::Integer);
+    EXPECT_EQ(value, static_cast<double>(large));
+
+    store.set(App::CellAddress(2, 0), CellValueStore::Float, 0.5);
+    EXPECT_FALSE(store.getInteger(App::CellAddress(2, 0), integer));
+}
+
+TEST(CellValueStore, overwriteKeepsCount)  // NOLINT
+{
+    CellValueStore store;
+    store.set(App::CellAddress(1, 1), CellValueStore::Integer, 1.0);
+    store.set(App::CellAddress(1, 1), CellValueStore::Float, 0.5);
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(1, 1), value, unit), CellValueStore::Float);
+    EXPECT_EQ(value, 0.5);
+    EXPECT_EQ(store.size(), 1U);
+}
+
+TEST(CellValueStore, erase)  // NOLINT
+{
+    CellValueStore store;
+    store.set(App::CellAddress(2, 0), CellValueStore::Float, 1.0);
+    store.set(App::CellAddress(7, 0), CellValueStore::Float, 2.0);
+
+    store.erase(App::CellAddress(7, 0));
+    store.erase(App::CellAddress(9, 9));
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(7, 0), value, unit), CellValueStore::None);
+    EXPECT_EQ(store.get(App::CellAddress(2, 0), value, unit), CellValueStore::Float);
+    EXPECT_EQ(value, 1.0);
+    EXPECT_EQ(store.size(), 1U);
+
+    store.set(App::CellAddress(2, 0), CellValueStore::None, 0.0);
+    EXPECT_EQ(store.get(App::CellAddress(2, 0), value, unit), CellValueStore::None);
+    EXPECT_EQ(store.size(), 0U);
+}
+
+TEST(CellValueStore, clear)  // NOLINT
+{
+    CellValueStore store;
+    store.set(App::CellAddress(0, 0), CellValueStore::Integer, 1.0);
+    store.set(App::CellAddress(0, 1), CellValueStore::Integer, 2.0);
+    store.clear();
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(store.get(App::CellAddress(0, 0), value, unit), CellValueStore::None);
+    EXPECT_EQ(store.size(), 0U);
+}
+
+TEST(CellValueStore, getAddresses)  // NOLINT
+{
+    CellValueStore store;
+    store.set(App::CellAddress(5, 1), CellValueStore::Float, 1.0);
+    store.set(App::CellAddress(2, 1), CellValueStore::Float, 2.0);
+    store.set(App::CellAddress(3, 0), CellValueStore::Integer, 3.0);
+    store.erase(App::CellAddress(2, 1));
+
+    std::vector<App::CellAddress> addresses = store.getAddresses();
+    ASSERT_EQ(addresses.size(), 2U);
+    EXPECT_EQ(addresses[0], App::CellAddress(3, 0));
+    EXPECT_EQ(addresses[1], App::CellAddress(5, 1));
+}
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+using Spreadsheet::CellValueStore;
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = dynamic_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    bool hasCellProperty(const char* name) const
+    {
+        auto names = _sheet->getDynamicPropertyNames();
+        return std::find(names.begin(), names.end(), name) != names.end();
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, getCellValueDoesNotCreateProperty)  // NOLINT
+{
+    ASSERT_NE(sheet(), nullptr);
+    sheet()->setCell("A1", "=1+2");
+    sheet()->setCell("A2", "=1.5");
+    sheet()->setCell("A3", "=2mm");
+    doc()->recompute();
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(sheet()->getCellValue(App::CellAddress("A1"), value, unit),
+              CellValueStore::Integer);
+    EXPECT_EQ(value, 3.0);
+    EXPECT_EQ(sheet()->getCellValue(App::CellAddress("A2"), value, unit), CellValueStore::Float);
+    EXPECT_EQ(value, 1.5);
+    EXPECT_EQ(sheet()->getCellValue(App::CellAddress("A3"), value, unit),
+              CellValueStore::Quantity);
+    EXPECT_EQ(value, 2.0);
+    EXPECT_EQ(unit, Base::Unit::Length);
+
+    EXPECT_FALSE(hasCellProperty("A1"));
+    EXPECT_FALSE(hasCellProperty("A2"));
+    EXPECT_FALSE(hasCellProperty("A3"));
+}
+
+TEST_F(SheetTest, getPropertyByNameCreatesProperty)  // NOLINT
+{
+    sheet()->setCell("A1", "=1+2");
+    doc()->recompute();
+
+    auto prop = dynamic_cast<App::PropertyInteger*>(sheet()->getPropertyByName("A1"));
+    ASSERT_NE(prop, nullptr);
+    EXPECT_EQ(prop->getValue(), 3);
+    EXPECT_TRUE(hasCellProperty("A1"));
+
+    // The property is kept up to date once it exists
+    sheet()->setCell("A1", "=2+2");
+    doc()->recompute();
+    EXPECT_EQ(prop->getValue(), 4);
+}
+
+TEST_F(SheetTest, lookupIsUndoneSymmetrically)  // NOLINT
+{
+    sheet()->setCell("A1", "=1+2");
+    doc()->recompute();
+
+    doc()->setUndoMode(1);
+    App::GetApplication().setActiveTransaction("Lookup");
+    EXPECT_NE(sheet()->getPropertyByName("A1"), nullptr);
+    EXPECT_TRUE(doc()->hasPendingTransaction());
+    App::GetApplication().closeActiveTransaction();
+
+    ASSERT_EQ(doc()->getAvailableUndos(), 1);
+    doc()->undo();
+    EXPECT_FALSE(hasCellProperty("A1"));
+
+    // The value is still there and the property is created again on the next lookup
+    auto prop = dynamic_cast<App::PropertyInteger*>(sheet()->getPropertyByName("A1"));
+    ASSERT_NE(prop, nullptr);
+    EXPECT_EQ(prop->getValue(), 3);
+}
+
+TEST_F(SheetTest, propertyEnumerationIsReadOnly)  // NOLINT
+{
+    sheet()->setCell("A1", "=2*3");
+    sheet()->setCell("B1", "=A1+1");
+    sheet()->setCell("C1", "text");
+    sheet()->setAlias(App::CellAddress("B1"), "total");
+    doc()->recompute();
+
+    std::vector<std::pair<const char*, App::Property*>> list;
+    sheet()->getPropertyNamedList(list);
+    std::map<std::string, App::Property*> map;
+    sheet()->getPropertyMap(map);
+    std::vector<App::Property*> props;
+    sheet()->getPropertyList(props);
+
+    auto find = [&list](const std::string& name) -> App::Property* {
+        for (const auto& it : list) {
+            if (name == it.first) {
+                return it.second;
+            }
+        }
+        return nullptr;
+    };
+    EXPECT_EQ(find("A1"), nullptr);
+    EXPECT_EQ(find("B1"), nullptr);
+    EXPECT_EQ(find("total"), nullptr);
+    EXPECT_EQ(map.count("A1"), 0U);
+    EXPECT_FALSE(hasCellProperty("A1"));
+    EXPECT_FALSE(hasCellProperty("B1"));
+    EXPECT_NE(dynamic_cast<App::PropertyString*>(find("C1")), nullptr);
+    EXPECT_EQ(map["C1"], find("C1"));
+
+    // Once looked up, the cell is listed by all accessors, under its alias as well
+    auto b1 = sheet()->getPropertyByName("B1");
+    ASSERT_NE(b1, nullptr);
+    list.clear();
+    map.clear();
+    props.clear();
+    sheet()->getPropertyNamedList(list);
+    sheet()->getPropertyMap(map);
+    sheet()->getPropertyList(props);
+    EXPECT_EQ(find("B1"), b1);
+    EXPECT_EQ(find("total"), b1);
+    EXPECT_EQ(map["B1"], b1);
+    EXPECT_EQ(map["total"], b1);
+    EXPECT_NE(std::find(props.begin(), props.end(), b1), props.end());
+    EXPECT_EQ(find("A1"), nullptr);
+}
+
+TEST_F(SheetTest, integerCellKeepsIntegerValue)  // NOLINT
+{
+    sheet()->setCell("A1", "=123456789 * 7");
+    doc()->recompute();
+
+    long value {};
+    EXPECT_TRUE(sheet()->getCellInteger(App::CellAddress("A1"), value));
+    EXPECT_EQ(value, 864197523L);
+    auto prop = dynamic_cast<App::PropertyInteger*>(sheet()->getPropertyByName("A1"));
+    ASSERT_NE(prop, nullptr);
+    EXPECT_EQ(prop->getValue(), value);
+}
+
+TEST_F(SheetTest, clearRemovesCellValue)  // NOLINT
+{
+    sheet()->setCell("A1", "=1+2");
+    doc()->recompute();
+    sheet()->clear(App::CellAddress("A1"));
+
+    double value {};
+    Base::Unit unit;
+    EXPECT_EQ(sheet()->getCellValue(App::CellAddress("A1"), value, unit), CellValueStore::None);
+    EXPECT_EQ(sheet()->getPropertyByName("A1"), nullptr);
+}
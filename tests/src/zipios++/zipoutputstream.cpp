@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <zlib.h>
+#include <zipios++/zipinputstream.h>
+#include <zipios++/zipoutputstream.h>
+
+namespace
+{
+std::string deflateRaw(const std::string& input)
+{
+    z_stream zs {};
+    deflateInit2(&zs, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::string output(deflateBound(&zs, input.size()), '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    zs.avail_in = static_cast<uInt>(input.size());
+    zs.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    zs.avail_out = static_cast<uInt>(output.size());
+    deflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
+    deflateEnd(&zs);
+    return output;
+}
+
+uint32_t crc(const std::string& input)
+{
+    return crc32(crc32(0, Z_NULL, 0),
+                 reinterpret_cast<const Bytef*>(input.data()),
+                 static_cast<uInt>(input.size()));
+}
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+TEST(ZipOutputStream, putRawEntryCanBeReadBack)
+{
+    // Arrange
+    const std::string first = "<?xml version='1.0'?><Document/>";
+    const std::string second(10000, 'x');
+    std::stringstream archive;
+
+    // Act
+    {
+        zipios::ZipOutputStream zos(archive);
+        zos.putNextEntry("Document.xml");
+        zos << first;
+        std::string deflated = deflateRaw(second);
+        zos.putRawEntry(zipios::ZipCDirEntry("Data.bin"),
+                        deflated.data(),
+                        static_cast<uint32_t>(deflated.size()),
+                        static_cast<uint32_t>(second.size()),
+                        crc(second));
+        zos.close();
+    }
+
+    // Assert
+    archive.seekg(0);
+    zipios::ZipInputStream zis(archive);
+    std::string content((std::istreambuf_iterator<char>(zis)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, first);
+    zipios::ConstEntryPointer entry = zis.getNextEntry();
+    ASSERT_TRUE(entry->isValid());
+    EXPECT_EQ(entry->getName(), "Data.bin");
+    EXPECT_EQ(entry->getSize(), second.size());
+    content.assign(std::istreambuf_iterator<char>(zis), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, second);
+}
+
+TEST(ZipInputStream, readRawEntryReturnsCompressedData)
+{
+    // Arrange
+    const std::string data(5000, 'y');
+    const std::string deflated = deflateRaw(data);
+    std::stringstream archive;
+    {
+        zipios::ZipOutputStream zos(archive);
+        zos.putNextEntry("First.txt");
+        zos << "first";
+        zos.putRawEntry(zipios::ZipCDirEntry("Second.bin"),
+                        deflated.data(),
+                        static_cast<uint32_t>(deflated.size()),
+                        static_cast<uint32_t>(data.size()),
+                        crc(data));
+        zos.putNextEntry("Third.txt");
+        zos << "third";
+        zos.close();
+    }
+    archive.seekg(0);
+    zipios::ZipInputStream zis(archive);
+    std::string raw;
+
+    // Act
+    zipios::ConstEntryPointer entry = zis.getNextEntry();
+    bool result = zis.readRawEntry(raw);
+
+    // Assert
+    EXPECT_TRUE(result);
+    EXPECT_EQ(entry->getName(), "Second.bin");
+    EXPECT_EQ(raw, deflated);
+    entry = zis.getNextEntry();
+    ASSERT_TRUE(entry->isValid());
+    EXPECT_EQ(entry->getName(), "Third.txt");
+    std::string content((std::istreambuf_iterator<char>(zis)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, "third");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)